@@ -48,6 +48,9 @@
 #
 #   [IMPORTED]: https://cmake.org/cmake/help/v3.10/prop_tgt/IMPORTED.html#prop_tgt:IMPORTED
 #
+# The function pairwise_aligner_add_simd_kernels () compiles alignment kernels for several simd isas into one target,
+# see pairwise_aligner-simd_kernels.cmake.
+#
 # ============================================================================
 
 cmake_minimum_required (VERSION 3.4...3.12)
@@ -177,6 +180,12 @@ add_library (seqan::pairwise_aligner ALIAS pairwise_aligner)
 # propagate PAIRWISE_ALIGNER_INCLUDE_DIR into PAIRWISE_ALIGNER_INCLUDE_DIRS
 set (PAIRWISE_ALIGNER_INCLUDE_DIRS ${PAIRWISE_ALIGNER_INCLUDE_DIR} ${PAIRWISE_ALIGNER_DEPENDENCY_INCLUDE_DIRS})
 
+# ----------------------------------------------------------------------------
+# Simd kernels selected at runtime
+# ----------------------------------------------------------------------------
+
+include (${CMAKE_CURRENT_LIST_DIR}/pairwise_aligner-simd_kernels.cmake)
+
 # ----------------------------------------------------------------------------
 # Finish find_package call
 # ----------------------------------------------------------------------------
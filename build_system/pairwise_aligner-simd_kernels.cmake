@@ -0,0 +1,124 @@
+# -----------------------------------------------------------------------------------------------------
+# Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+# Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+# This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+# shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+# -----------------------------------------------------------------------------------------------------
+#
+# This CMake module is included by pairwise_aligner-config.cmake and provides:
+#
+#   pairwise_aligner_add_simd_kernels (<target>
+#                                      SOURCES <source>...
+#                                      ENTRY_POINTS <name>...
+#                                      [ISAS <isa>...])
+#
+# Compiles the kernel sources once for every given simd isa and adds the resulting objects to <target>.
+# The isas are named as in the test suite: none, SSE4, AVX2, AVX512BW and AVX512VBMI. By default the kernels are
+# compiled for SSE4, AVX2 and AVX512BW. The simd score models require at least SSE4, such that a kernel compiled for
+# none must use the scalar score models.
+#
+# Every kernel source is compiled with PAIRWISE_ALIGNER_SIMD_KERNEL_ISA set to the lower case isa name, such that
+# PAIRWISE_ALIGNER_SIMD_KERNEL_NAME(<name>) from <pairwise_aligner/simd/simd_isa.hpp> expands to <name>_<isa>.
+# The entry points must be declared with C linkage. Every isa is linked into a single relocatable object in which all
+# symbols but its entry points are made local. Otherwise, the linker would merge the inline functions and template
+# instantiations of all isas and might call the AVX512 variant of a function from the SSE4 kernel.
+# At runtime the kernel is chosen with seqan::pairwise_aligner::select_simd_kernel.
+#
+# The relocatable objects require a Linux toolchain with objcopy. Otherwise, the kernel is only compiled for the
+# lowest of the given isas and linked into <target> directly.
+# For every compiled isa, PAIRWISE_ALIGNER_HAS_SIMD_KERNEL_<ISA> is defined for <target>, e.g.
+# PAIRWISE_ALIGNER_HAS_SIMD_KERNEL_AVX2, such that the kernels of the other isas can be left empty.
+#
+# The isa flags are appended to the flags of the build, which must therefore not select an isa, e.g. -march=native.
+#
+# Example:
+#
+#   pairwise_aligner_add_simd_kernels (my_app SOURCES align_kernel.cpp ENTRY_POINTS compute_scores)
+#
+# ============================================================================
+
+cmake_minimum_required (VERSION 3.7)
+
+include (CMakeFindBinUtils)
+
+function (pairwise_aligner_add_simd_kernels target)
+    cmake_parse_arguments (KERNEL "" "" "SOURCES;ENTRY_POINTS;ISAS" ${ARGN})
+
+    if (NOT KERNEL_SOURCES OR NOT KERNEL_ENTRY_POINTS)
+        message (FATAL_ERROR "pairwise_aligner_add_simd_kernels requires SOURCES and ENTRY_POINTS.")
+    endif ()
+
+    if (NOT KERNEL_ISAS)
+        set (KERNEL_ISAS "SSE4" "AVX2" "AVX512BW")
+    endif ()
+
+    # The isas are those of the test suite, see test/cmake/configure_simd_flags.cmake, but the flags enable only the
+    # extensions that seqan::pairwise_aligner::host_simd_isa checks before a kernel is selected. For example,
+    # -march=icelake-server would also enable VBMI2 and VNNI, which not every processor with VBMI supports.
+    set (SIMD_ISA_LIST "none" "SSE4" "AVX2" "AVX512BW" "AVX512VBMI")
+    set (SIMD_ISA_FLAGS_none "-mno-sse4")
+    set (SIMD_ISA_FLAGS_SSE4 "-msse4")
+    set (SIMD_ISA_FLAGS_AVX2 "-mavx2")
+    set (SIMD_ISA_FLAGS_AVX512BW "-march=skylake-avx512")
+    set (SIMD_ISA_FLAGS_AVX512VBMI "-march=skylake-avx512" "-mavx512vbmi")
+
+    set (lowest_isa_index -1)
+    foreach (isa ${KERNEL_ISAS})
+        list (FIND SIMD_ISA_LIST ${isa} isa_index)
+        if (isa_index EQUAL -1)
+            message (FATAL_ERROR "Unknown simd isa '${isa}'. Valid isas are: ${SIMD_ISA_LIST}.")
+        endif ()
+        if (lowest_isa_index EQUAL -1 OR isa_index LESS lowest_isa_index)
+            set (lowest_isa_index ${isa_index})
+        endif ()
+    endforeach ()
+
+    # Without the relocatable objects the isas cannot be separated, such that only a single isa is compiled.
+    if (NOT (CMAKE_SYSTEM_NAME STREQUAL "Linux" AND CMAKE_OBJCOPY))
+        list (GET SIMD_ISA_LIST ${lowest_isa_index} lowest_isa)
+        message (WARNING "pairwise_aligner_add_simd_kernels: Relocatable kernel objects require Linux and objcopy. "
+                         "The kernels of ${target} are only compiled for ${lowest_isa}.")
+        set (KERNEL_ISAS ${lowest_isa})
+    endif ()
+
+    list (LENGTH KERNEL_ISAS isa_count)
+    foreach (isa ${KERNEL_ISAS})
+        string (TOLOWER ${isa} isa_name)
+        set (kernel_target "${target}_simd_kernel_${isa_name}")
+        set (kernel_object "${CMAKE_CURRENT_BINARY_DIR}/${kernel_target}${CMAKE_CXX_OUTPUT_EXTENSION}")
+
+        add_library (${kernel_target} OBJECT ${KERNEL_SOURCES})
+        target_compile_options (${kernel_target} PRIVATE ${SIMD_ISA_FLAGS_${isa}})
+        target_compile_definitions (${kernel_target} PRIVATE PAIRWISE_ALIGNER_SIMD_KERNEL_ISA=${isa_name})
+        target_link_libraries (${kernel_target} PRIVATE seqan::pairwise_aligner)
+        set_target_properties (${kernel_target} PROPERTIES POSITION_INDEPENDENT_CODE ON)
+        target_compile_definitions (${target} PRIVATE PAIRWISE_ALIGNER_HAS_SIMD_KERNEL_${isa}=1)
+
+        # A single isa is linked as is.
+        if (isa_count EQUAL 1)
+            target_sources (${target} PRIVATE $<TARGET_OBJECTS:${kernel_target}>)
+            continue ()
+        endif ()
+
+        # GCC emits the inline variables as unique global symbols, which objcopy cannot make local.
+        target_compile_options (${kernel_target} PRIVATE $<$<CXX_COMPILER_ID:GNU>:-fno-gnu-unique>)
+
+        set (keep_entry_points "")
+        foreach (entry_point ${KERNEL_ENTRY_POINTS})
+            list (APPEND keep_entry_points "--keep-global-symbol=${entry_point}_${isa_name}")
+        endforeach ()
+
+        # The COMDAT groups are removed, because the linker discards groups by their name even if the symbols are
+        # local, which would leave the references of all but the first isa unresolved.
+        add_custom_command (OUTPUT ${kernel_object}
+                            COMMAND ${CMAKE_LINKER} -r -o ${kernel_object} $<TARGET_OBJECTS:${kernel_target}>
+                            COMMAND ${CMAKE_OBJCOPY} --remove-section=.group ${keep_entry_points} ${kernel_object}
+                            DEPENDS ${kernel_target} $<TARGET_OBJECTS:${kernel_target}>
+                            COMMENT "Linking simd kernel ${kernel_target}"
+                            COMMAND_EXPAND_LISTS
+                            VERBATIM)
+
+        set_source_files_properties (${kernel_object} PROPERTIES EXTERNAL_OBJECT TRUE GENERATED TRUE)
+        target_sources (${target} PRIVATE ${kernel_object})
+    endforeach ()
+endfunction ()
@@ -18,7 +18,12 @@
 
 #include <pairwise_aligner/affine/affine_gap_model.hpp>
 #include <pairwise_aligner/affine/affine_initialisation_strategy.hpp>
+#include <pairwise_aligner/configuration/band_policy.hpp>
+#include <pairwise_aligner/configuration/end_gap_policy.hpp>
+#include <pairwise_aligner/configuration/score_threshold_policy.hpp>
+#include <pairwise_aligner/configuration/suboptimal_alignment_policy.hpp>
 #include <pairwise_aligner/dp_algorithm_template/dp_algorithm_attorney.hpp>
+#include <pairwise_aligner/matrix/dp_trace_matrix.hpp>
 #include <pairwise_aligner/utility/math.hpp>
 
 namespace seqan::pairwise_aligner
@@ -130,6 +135,44 @@ protected:
         return this->make_lane_width();
     }
 
+    constexpr cfg::leading_end_gap leading_gap_setting() const noexcept
+    {
+        return cfg::leading_end_gap{.first_column = this->first_column, .first_row = this->first_row};
+    }
+
+    constexpr cfg::trailing_end_gap trailing_gap_setting() const noexcept
+    {
+        return cfg::trailing_end_gap{.last_column = this->last_column, .last_row = this->last_row};
+    }
+
+    constexpr auto band_setting() const noexcept
+    {
+        if constexpr (requires { this->band_width; })
+            return cfg::adaptive_band{.band_width = this->band_width};
+        else
+            return cfg::static_band{.lower_diagonal = this->lower_diagonal, .upper_diagonal = this->upper_diagonal};
+    }
+
+    // Only available if the suboptimal alignment output was configured.
+    constexpr auto suboptimal_setting() const noexcept
+    {
+        return cfg::suboptimal_alignment_policy{.alignment_count = this->alignment_count};
+    }
+
+    constexpr auto score_threshold_setting() const noexcept
+    {
+        if constexpr (requires { this->threshold; })
+            return cfg::score_threshold_policy{.threshold = this->threshold,
+                                               .max_substitution_score = this->max_substitution_score};
+        else
+            return cfg::no_score_threshold{};
+    }
+
+    constexpr auto gap_setting() const noexcept
+    {
+        return affine_gap_model<decltype(this->gap_open_score)>{this->gap_open_score, this->gap_extension_score};
+    }
+
     template <typename cache_t,
               typename dp_cell_t,
               typename scorer_t,
@@ -154,6 +197,59 @@ protected:
         cache.second = max(static_cast<score_t>(add(cache.second, this->gap_extension_score)), best);
         get<1>(column_cell) = max(static_cast<score_t>(add(get<1>(column_cell), this->gap_extension_score)), best);
     }
+
+    // Same as above, but additionally stores the trace_code of the cell in trace.
+    template <typename cache_t,
+              typename dp_cell_t,
+              typename scorer_t,
+              typename tracker_t,
+              typename seq1_val_t,
+              typename seq2_val_t,
+              typename trace_t>
+    constexpr auto compute_cell(cache_t & cache,
+                                dp_cell_t & column_cell,
+                                scorer_t & scorer,
+                                tracker_t & tracker,
+                                [[maybe_unused]] seq1_val_t const & seq1_val,
+                                [[maybe_unused]] seq2_val_t const & seq2_val,
+                                trace_t & trace) const noexcept
+    {
+        using std::max;
+        using score_t = typename dp_cell_t::score_type;
+        using trace_value_t = typename trace_t::value_type;
+
+        trace_t const no_trace{static_cast<trace_value_t>(trace_code::diagonal)};
+
+        score_t const diagonal = scorer.score(cache.first, seq1_val, seq2_val);
+        score_t best = max(max(diagonal, cache.second), get<1>(column_cell));
+        // On ties the diagonal is preferred over the vertical and the vertical over the horizontal predecessor.
+        trace = blend(best.eq(diagonal),
+                      no_trace,
+                      blend(best.eq(cache.second),
+                            trace_t{static_cast<trace_value_t>(trace_code::up)},
+                            trace_t{static_cast<trace_value_t>(trace_code::left)}));
+        // A local alignment starts in the cell whose score was reset to zero by the substitution model.
+        if constexpr (requires { scorer.local_zero(); })
+            trace |= blend(best.eq(scorer.local_zero()),
+                           trace_t{static_cast<trace_value_t>(trace_code::stop)},
+                           no_trace);
+
+        cache.first = get<0>(column_cell); // cache next diagonal score!
+        get<0>(column_cell) = tracker.track(best);
+        best = add(best, (this->gap_open_score + this->gap_extension_score));
+
+        score_t const vertical_extension = static_cast<score_t>(add(cache.second, this->gap_extension_score));
+        score_t const horizontal_extension = static_cast<score_t>(add(get<1>(column_cell),
+                                                                      this->gap_extension_score));
+        trace |= blend(best.lt(vertical_extension),
+                       trace_t{static_cast<trace_value_t>(trace_code::up_extension)},
+                       no_trace);
+        trace |= blend(best.lt(horizontal_extension),
+                       trace_t{static_cast<trace_value_t>(trace_code::left_extension)},
+                       no_trace);
+        cache.second = max(vertical_extension, best);
+        get<1>(column_cell) = max(horizontal_extension, best);
+    }
 };
 
 } // inline namespace v1
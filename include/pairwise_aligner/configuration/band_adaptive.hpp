@@ -0,0 +1,156 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::cfg::band_adaptive.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include <pairwise_aligner/configuration/band_policy.hpp>
+#include <pairwise_aligner/configuration/initial.hpp>
+#include <pairwise_aligner/configuration/rule_band.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_banded.hpp>
+#include <pairwise_aligner/type_traits.hpp>
+#include <pairwise_aligner/utility/type_list.hpp>
+
+namespace seqan::pairwise_aligner {
+inline namespace v1
+{
+namespace cfg
+{
+namespace _band_adaptive
+{
+
+// ----------------------------------------------------------------------------
+// traits
+// ----------------------------------------------------------------------------
+
+/*!\brief Restricts the computation to a band that follows the best score through the dp matrix.
+ *
+ * Every lane of the dp matrix computes band width plus lane width many rows, placed around the row of the best score
+ * in the last column of the previous lane. Work and memory are thus linear in the sequence lengths times the band
+ * width, while alignments drifting away from the main diagonal, e.g. due to many indels, stay within the band.
+ * The last lane computes all remaining rows, such that the last cell of the matrix is always part of the band.
+ * Only supported for global alignments with scalar score models.
+ */
+struct traits
+{
+    static constexpr cfg::detail::rule_category category = cfg::detail::rule_category::band;
+
+    adaptive_band _band;
+
+    constexpr adaptive_band configure_band_policy() const noexcept
+    {
+        return _band;
+    }
+
+    //!\brief The algorithm template skipping the cells outside of the band.
+    template <typename score_t>
+    using dp_algorithm_template_type = lazy_algorithm_template<dp_algorithm_template_banded>;
+};
+
+// ----------------------------------------------------------------------------
+// configurator
+// ----------------------------------------------------------------------------
+
+template <typename next_configurator_t, typename traits_t>
+struct _configurator
+{
+    struct type;
+};
+
+template <typename next_configurator_t, typename traits_t>
+using configurator_t = typename _configurator<next_configurator_t, traits_t>::type;
+
+template <typename next_configurator_t, typename traits_t>
+struct _configurator<next_configurator_t, traits_t>::type
+{
+    next_configurator_t _next_configurator;
+    traits_t _traits;
+
+    template <typename ...values_t>
+    void set_config(values_t && ... values) noexcept
+    {
+        std::forward<next_configurator_t>(_next_configurator).set_config(std::forward<values_t>(values)..., _traits);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// rule
+// ----------------------------------------------------------------------------
+
+template <typename predecessor_t, typename traits_t>
+struct _rule
+{
+    struct type;
+};
+
+template <typename predecessor_t, typename traits_t>
+using rule = typename _rule<predecessor_t, traits_t>::type;
+
+template <typename predecessor_t, typename traits_t>
+struct _rule<predecessor_t, traits_t>::type : cfg::band::rule<predecessor_t>
+{
+    predecessor_t _predecessor;
+    traits_t _traits;
+
+    using traits_type = type_list<traits_t>;
+
+    template <template <typename ...> typename type_list_t>
+    using configurator_types = typename concat_type_lists_t<configurator_types_t<std::remove_cvref_t<predecessor_t>,
+                                                                                 type_list>,
+                                                            traits_type>::template apply<type_list_t>;
+
+    template <typename next_configurator_t>
+    auto apply(next_configurator_t && next_configurator) const
+    {
+        return _predecessor.apply(configurator_t<next_configurator_t, traits_t>{
+                    std::forward<next_configurator_t>(next_configurator),
+                    _traits
+                });
+    }
+};
+
+// ----------------------------------------------------------------------------
+// CPO
+// ----------------------------------------------------------------------------
+
+namespace _cpo
+{
+struct _fn
+{
+    // implementation of function style connection
+    template <typename predecessor_t>
+    constexpr auto operator()(predecessor_t && predecessor, std::ptrdiff_t const band_width) const
+    {
+        if (band_width < 0)
+            throw std::invalid_argument{"The band width must not be negative."};
+
+        return _band_adaptive::rule<predecessor_t, traits>{{},
+                                                           std::forward<predecessor_t>(predecessor),
+                                                           traits{adaptive_band{.band_width = band_width}}};
+    }
+
+    constexpr auto operator()(std::ptrdiff_t const band_width) const
+    {
+        return this->operator()(cfg::initial, band_width);
+    }
+};
+} // namespace _cpo
+} // namespace _band_adaptive
+
+inline constexpr _band_adaptive::_cpo::_fn band_adaptive{};
+
+} // namespace cfg
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -0,0 +1,38 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::cfg::static_band and seqan::pairwise_aligner::cfg::adaptive_band.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace seqan::pairwise_aligner {
+inline namespace v1 {
+namespace cfg {
+
+//!\brief The lower and upper diagonal of a band, where the diagonal of the cell (i, j) is j - i.
+struct static_band
+{
+    std::ptrdiff_t lower_diagonal{};
+    std::ptrdiff_t upper_diagonal{};
+};
+
+/*!\brief The number of rows that are computed around the best score of the previous lane, in addition to the rows
+ *        the alignment can advance within the current lane.
+ */
+struct adaptive_band
+{
+    std::ptrdiff_t band_width{};
+};
+
+} // namespace cfg
+} // inline namespace v1
+} // namespace seqan::pairwise_aligner
@@ -0,0 +1,160 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::cfg::band_static.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include <pairwise_aligner/configuration/band_policy.hpp>
+#include <pairwise_aligner/configuration/initial.hpp>
+#include <pairwise_aligner/configuration/rule_band.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_banded.hpp>
+#include <pairwise_aligner/type_traits.hpp>
+#include <pairwise_aligner/utility/type_list.hpp>
+
+namespace seqan::pairwise_aligner {
+inline namespace v1
+{
+namespace cfg
+{
+namespace _band_static
+{
+
+// ----------------------------------------------------------------------------
+// traits
+// ----------------------------------------------------------------------------
+
+/*!\brief Restricts the computation to the cells between the given lower and upper diagonal.
+ *
+ * The diagonal of the cell (i, j) is j - i, where i indexes the first and j the second sequence. Blocks and lanes of
+ * the dp matrix that lie completely outside of the band are skipped and the remaining cells outside of the band are
+ * set to minus infinity. The band must contain the main diagonal. Pairs whose last cell lies outside of the band get
+ * a score below any valid alignment score.
+ * Only supported for global alignments with scalar or non-saturated simd score models and without the lane refill,
+ * whose lanes start the pairs at different columns of the band.
+ */
+struct traits
+{
+    static constexpr cfg::detail::rule_category category = cfg::detail::rule_category::band;
+
+    static_band _band;
+
+    constexpr static_band configure_band_policy() const noexcept
+    {
+        return _band;
+    }
+
+    //!\brief The algorithm template skipping the cells outside of the band.
+    template <typename score_t>
+    using dp_algorithm_template_type = lazy_algorithm_template<dp_algorithm_template_banded>;
+};
+
+// ----------------------------------------------------------------------------
+// configurator
+// ----------------------------------------------------------------------------
+
+template <typename next_configurator_t, typename traits_t>
+struct _configurator
+{
+    struct type;
+};
+
+template <typename next_configurator_t, typename traits_t>
+using configurator_t = typename _configurator<next_configurator_t, traits_t>::type;
+
+template <typename next_configurator_t, typename traits_t>
+struct _configurator<next_configurator_t, traits_t>::type
+{
+    next_configurator_t _next_configurator;
+    traits_t _traits;
+
+    template <typename ...values_t>
+    void set_config(values_t && ... values) noexcept
+    {
+        std::forward<next_configurator_t>(_next_configurator).set_config(std::forward<values_t>(values)..., _traits);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// rule
+// ----------------------------------------------------------------------------
+
+template <typename predecessor_t, typename traits_t>
+struct _rule
+{
+    struct type;
+};
+
+template <typename predecessor_t, typename traits_t>
+using rule = typename _rule<predecessor_t, traits_t>::type;
+
+template <typename predecessor_t, typename traits_t>
+struct _rule<predecessor_t, traits_t>::type : cfg::band::rule<predecessor_t>
+{
+    predecessor_t _predecessor;
+    traits_t _traits;
+
+    using traits_type = type_list<traits_t>;
+
+    template <template <typename ...> typename type_list_t>
+    using configurator_types = typename concat_type_lists_t<configurator_types_t<std::remove_cvref_t<predecessor_t>,
+                                                                                 type_list>,
+                                                            traits_type>::template apply<type_list_t>;
+
+    template <typename next_configurator_t>
+    auto apply(next_configurator_t && next_configurator) const
+    {
+        return _predecessor.apply(configurator_t<next_configurator_t, traits_t>{
+                    std::forward<next_configurator_t>(next_configurator),
+                    _traits
+                });
+    }
+};
+
+// ----------------------------------------------------------------------------
+// CPO
+// ----------------------------------------------------------------------------
+
+namespace _cpo
+{
+struct _fn
+{
+    // implementation of function style connection
+    template <typename predecessor_t>
+    constexpr auto operator()(predecessor_t && predecessor,
+                              std::ptrdiff_t const lower_diagonal,
+                              std::ptrdiff_t const upper_diagonal) const
+    {
+        if (lower_diagonal > 0 || upper_diagonal < 0)
+            throw std::invalid_argument{"The band must contain the main diagonal."};
+
+        return _band_static::rule<predecessor_t, traits>{{},
+                                                         std::forward<predecessor_t>(predecessor),
+                                                         traits{static_band{.lower_diagonal = lower_diagonal,
+                                                                            .upper_diagonal = upper_diagonal}}};
+    }
+
+    constexpr auto operator()(std::ptrdiff_t const lower_diagonal, std::ptrdiff_t const upper_diagonal) const
+    {
+        return this->operator()(cfg::initial, lower_diagonal, upper_diagonal);
+    }
+};
+} // namespace _cpo
+} // namespace _band_static
+
+inline constexpr _band_static::_cpo::_fn band_static{};
+
+} // namespace cfg
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -13,13 +13,20 @@
 #pragma once
 
 #include <concepts>
+#include <limits>
 #include <type_traits>
 
 #include <seqan3/utility/type_pack/traits.hpp>
 #include <seqan3/utility/type_traits/lazy_conditional.hpp>
 
+#include <pairwise_aligner/affine/affine_gap_model.hpp>
+#include <pairwise_aligner/configuration/band_policy.hpp>
 #include <pairwise_aligner/configuration/end_gap_policy.hpp>
 #include <pairwise_aligner/configuration/rule_category.hpp>
+#include <pairwise_aligner/configuration/score_threshold_policy.hpp>
+#include <pairwise_aligner/interface/interface_many_to_many_batch.hpp>
+#include <pairwise_aligner/simd/concept.hpp>
+#include <pairwise_aligner/type_traits.hpp>
 #include <pairwise_aligner/utility/type_list.hpp>
 
 namespace seqan::pairwise_aligner
@@ -67,6 +74,18 @@ private:
         template <typename configuration_t>
         using is_method_configuration = is_configuration<configuration_t, cfg::detail::rule_category::method>;
 
+        template <typename configuration_t>
+        using is_execution_configuration = is_configuration<configuration_t, cfg::detail::rule_category::execution>;
+
+        template <typename configuration_t>
+        using is_output_configuration = is_configuration<configuration_t, cfg::detail::rule_category::output>;
+
+        template <typename configuration_t>
+        using is_band_configuration = is_configuration<configuration_t, cfg::detail::rule_category::band>;
+
+        template <typename configuration_t>
+        using is_threshold_configuration = is_configuration<configuration_t, cfg::detail::rule_category::threshold>;
+
         // now we need to iterate over list and find_if type
         using substitution_configuration_t =
             typename seqan3::pack_traits::at<seqan3::pack_traits::find_if<is_score_configuration, _configurations_t...>,
@@ -80,6 +99,18 @@ private:
         static constexpr std::ptrdiff_t method_configuration_index =
             seqan3::pack_traits::find_if<is_method_configuration, _configurations_t...>;
 
+        static constexpr std::ptrdiff_t execution_configuration_index =
+            seqan3::pack_traits::find_if<is_execution_configuration, _configurations_t...>;
+
+        static constexpr std::ptrdiff_t output_configuration_index =
+            seqan3::pack_traits::find_if<is_output_configuration, _configurations_t...>;
+
+        static constexpr std::ptrdiff_t band_configuration_index =
+            seqan3::pack_traits::find_if<is_band_configuration, _configurations_t...>;
+
+        static constexpr std::ptrdiff_t threshold_configuration_index =
+            seqan3::pack_traits::find_if<is_threshold_configuration, _configurations_t...>;
+
         template <typename index_t>
         using at_wrapper = seqan3::pack_traits::at<index_t::value, _configurations_t...>;
 
@@ -96,16 +127,73 @@ private:
                                                seqan3::detail::lazy<is_local_type, method_configuration_type>,
                                                std::false_type>::value;
 
+        using output_configuration_type =
+            seqan3::detail::lazy_conditional_t<output_configuration_index != -1,
+                seqan3::detail::lazy<at_wrapper, std::integral_constant<std::ptrdiff_t, output_configuration_index>>,
+                std::void_t<>>;
+
+        template <typename configuration_t>
+        using is_begin_coordinate_output_type = typename configuration_t::is_begin_coordinate_output_type;
+
+        static constexpr bool is_begin_coordinate_output =
+            seqan3::detail::lazy_conditional_t<output_configuration_index != -1,
+                                               seqan3::detail::lazy<is_begin_coordinate_output_type,
+                                                                    output_configuration_type>,
+                                               std::false_type>::value;
+
+        static constexpr bool is_suboptimal_output =
+            requires { typename output_configuration_type::suboptimal_policy_type; };
+
+        static constexpr bool is_alignment_output =
+            output_configuration_index != -1 && !is_begin_coordinate_output && !is_suboptimal_output;
+
         using score_type = typename substitution_configuration_t::score_type;
 
+        // The fixed simd score models compute all columns in one block, unless the score threshold is checked after
+        // every column block.
+        static constexpr size_t column_block_size = (threshold_configuration_index != -1)
+                                                  ? score_threshold_policy::column_block_size
+                                                  : std::numeric_limits<size_t>::max();
+
+        static constexpr bool is_saturated = requires { typename substitution_configuration_t::block_handler_t; };
+
+        static constexpr bool is_affine = requires (typename gap_configuration_t::gap_model_type gap_model) {
+            { gap_model } -> std::same_as<affine_gap_model<decltype(gap_model.gap_open_score)> &>;
+        };
+
         template <typename score_t>
         using dp_cell_column_type = typename gap_configuration_t::dp_cell_column_type<score_t>;
 
         template <typename score_t>
         using dp_cell_row_type = typename gap_configuration_t::dp_cell_row_type<score_t>;
 
+        using band_configuration_type =
+            seqan3::detail::lazy_conditional_t<band_configuration_index != -1,
+                seqan3::detail::lazy<at_wrapper, std::integral_constant<std::ptrdiff_t, band_configuration_index>>,
+                std::void_t<>>;
+
+        template <typename configuration_t>
+        using dp_algorithm_template_type_of = typename configuration_t::template dp_algorithm_template_type<score_type>;
+
+        // The band and the output rules replace the algorithm template of the score model with the one provided by
+        // their traits. The band takes precedence, since it can not be combined with an output.
+        using replacing_algorithm_template_type =
+            seqan3::detail::lazy_conditional_t<band_configuration_index != -1,
+                seqan3::detail::lazy<dp_algorithm_template_type_of, band_configuration_type>,
+            seqan3::detail::lazy_conditional_t<output_configuration_index != -1,
+                seqan3::detail::lazy<dp_algorithm_template_type_of, output_configuration_type>,
+                std::void_t<>>>;
+
+        template <template <typename ...> typename algorithm_template_t>
+        using selected_algorithm_template_type =
+            std::conditional_t<std::same_as<replacing_algorithm_template_type, std::void_t<>>,
+                               lazy_algorithm_template<algorithm_template_t>,
+                               replacing_algorithm_template_type>;
+
         template <template <typename ...> typename algorithm_template_t, typename ...policies_t>
-        using algorithm_type = typename gap_configuration_t::dp_kernel_type<algorithm_template_t, policies_t...>;
+        using algorithm_type =
+            typename gap_configuration_t::dp_kernel_type<
+                selected_algorithm_template_type<algorithm_template_t>::template type, policies_t...>;
 
         auto leading_gap_setting() const noexcept {
             if constexpr (std::same_as<method_configuration_type, std::void_t<>>)
@@ -120,6 +208,27 @@ private:
             else
                 return this->configure_trailing_gap_policy();
         }
+
+        // Only read by the banded algorithm template, which is selected if a band was configured.
+        auto band_setting() const noexcept {
+            if constexpr (band_configuration_index == -1)
+                return static_band{};
+            else
+                return this->configure_band_policy();
+        }
+
+        // Only passed to the algorithm if a score threshold was configured.
+        auto score_threshold_setting() const noexcept {
+            return this->configure_score_threshold_policy(this->max_substitution_score());
+        }
+
+        template <size_t max_bulk_size, typename dp_algorithm_t>
+        auto bulk_interface(dp_algorithm_t algorithm) const noexcept {
+            if constexpr (execution_configuration_index == -1)
+                return interface_many_to_many_batch<dp_algorithm_t, max_bulk_size>{std::move(algorithm)};
+            else
+                return this->template configure_bulk_interface<max_bulk_size>(*this, std::move(algorithm));
+        }
     };
 
     using accessor_t = accessor<configurations_t...>;
@@ -135,6 +244,48 @@ public:
 
     auto configure() const
     {
+        static_assert(!accessor_t::is_alignment_output || !accessor_t::is_local ||
+                      simd::simd_type<typename accessor_t::score_type>,
+                      "The alignment output of local alignments is only supported for simd score models!");
+        static_assert(!accessor_t::is_alignment_output || accessor_t::is_affine,
+                      "The alignment output is only supported for the affine gap model!");
+        static_assert(!accessor_t::is_alignment_output || accessor_t::execution_configuration_index == -1,
+                      "The alignment output can not be combined with an execution configuration!");
+        static_assert(!accessor_t::is_begin_coordinate_output || accessor_t::is_local,
+                      "The begin coordinate output is only supported for local alignments!");
+        static_assert(!accessor_t::is_begin_coordinate_output || simd::simd_type<typename accessor_t::score_type>,
+                      "The begin coordinate output is only supported for simd score models!");
+        static_assert(!accessor_t::is_begin_coordinate_output || accessor_t::execution_configuration_index == -1,
+                      "The begin coordinate output can not be combined with an execution configuration!");
+        static_assert(!accessor_t::is_suboptimal_output || accessor_t::is_local,
+                      "The suboptimal alignment output is only supported for local alignments!");
+        static_assert(!accessor_t::is_suboptimal_output || !simd::simd_type<typename accessor_t::score_type>,
+                      "The suboptimal alignment output is only supported for scalar score models!");
+        static_assert(!accessor_t::is_suboptimal_output || accessor_t::is_affine,
+                      "The suboptimal alignment output is only supported for the affine gap model!");
+        static_assert(accessor_t::threshold_configuration_index == -1 || accessor_t::is_local,
+                      "The score threshold is only supported for local alignments!");
+        static_assert(accessor_t::threshold_configuration_index == -1 ||
+                      simd::simd_type<typename accessor_t::score_type>,
+                      "The score threshold is only supported for simd score models!");
+        static_assert(accessor_t::threshold_configuration_index == -1 ||
+                      accessor_t::output_configuration_index == -1,
+                      "The score threshold can not be combined with an output configuration!");
+        static_assert(accessor_t::threshold_configuration_index == -1 ||
+                      accessor_t::execution_configuration_index == -1,
+                      "The score threshold can not be combined with an execution configuration!");
+        static_assert(accessor_t::band_configuration_index == -1 || !accessor_t::is_local,
+                      "The band is not supported for local alignments!");
+        static_assert(accessor_t::band_configuration_index == -1 || !accessor_t::is_saturated,
+                      "The band is not supported for saturated score models!");
+        static_assert(accessor_t::band_configuration_index == -1 || accessor_t::output_configuration_index == -1,
+                      "The band can not be combined with the alignment output!");
+        static_assert(accessor_t::band_configuration_index == -1 || accessor_t::execution_configuration_index == -1,
+                      "The band can not be combined with an execution configuration!");
+        static_assert(!std::same_as<decltype(_configurations_accessor.band_setting()), adaptive_band> ||
+                      !simd::simd_type<typename accessor_t::score_type>,
+                      "The adaptive band is only supported for scalar score models!");
+
         auto substitution_policy = _configurations_accessor.configure_substitution_policy(_configurations_accessor);
         auto gap_policy = _configurations_accessor.configure_gap_policy();
         auto result_factory_policy = _configurations_accessor.configure_result_factory_policy(_configurations_accessor);
@@ -148,13 +299,27 @@ public:
             trailing_gap_policy = _configurations_accessor.configure_trailing_gap_policy();
         }
 
-        return _configurations_accessor.configure_algorithm(_configurations_accessor,
-                                                            std::move(dp_vector_policy),
-                                                            std::move(leading_gap_policy),
-                                                            std::move(trailing_gap_policy),
-                                                            std::move(result_factory_policy),
-                                                            std::move(gap_policy),
-                                                            std::move(substitution_policy));
+        // The number of suboptimal alignments and the score threshold are only passed to the algorithm if they are
+        // configured.
+        accessor_t const & configurations = _configurations_accessor;
+        auto configure_algorithm = [&] (auto && ...output_policies) {
+            return configurations.configure_algorithm(configurations,
+                                                      std::move(dp_vector_policy),
+                                                      std::move(leading_gap_policy),
+                                                      std::move(trailing_gap_policy),
+                                                      configurations.band_setting(),
+                                                      std::move(result_factory_policy),
+                                                      std::move(gap_policy),
+                                                      std::move(substitution_policy),
+                                                      std::forward<decltype(output_policies)>(output_policies)...);
+        };
+
+        if constexpr (accessor_t::is_suboptimal_output)
+            return configure_algorithm(configurations.configure_suboptimal_policy());
+        else if constexpr (accessor_t::threshold_configuration_index != -1)
+            return configure_algorithm(configurations.score_threshold_setting());
+        else
+            return configure_algorithm();
     }
 };
 
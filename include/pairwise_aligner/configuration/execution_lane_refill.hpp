@@ -0,0 +1,146 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::cfg::execution_lane_refill.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <limits>
+#include <type_traits>
+
+#include <pairwise_aligner/configuration/end_gap_policy.hpp>
+#include <pairwise_aligner/configuration/rule_execution.hpp>
+#include <pairwise_aligner/interface/interface_many_to_many_refill.hpp>
+#include <pairwise_aligner/type_traits.hpp>
+#include <pairwise_aligner/utility/type_list.hpp>
+
+namespace seqan::pairwise_aligner {
+inline namespace v1
+{
+namespace cfg
+{
+namespace _execution_lane_refill
+{
+
+// ----------------------------------------------------------------------------
+// traits
+// ----------------------------------------------------------------------------
+
+struct traits
+{
+    static constexpr cfg::detail::rule_category category = cfg::detail::rule_category::execution;
+
+    size_t _segment_width;
+
+    template <size_t max_bulk_size, typename configuration_t, typename dp_algorithm_t>
+    constexpr auto configure_bulk_interface(configuration_t const & configuration,
+                                            dp_algorithm_t algorithm) const noexcept
+    {
+        size_t segment_width = _segment_width;
+        if constexpr (!configuration_t::is_local) {
+            // With free trailing gaps the score depends on the complete last row, so lanes are not refilled early.
+            trailing_end_gap trailing_gap = configuration.trailing_gap_setting();
+            if (trailing_gap.last_column == end_gap::free || trailing_gap.last_row == end_gap::free)
+                segment_width = std::numeric_limits<size_t>::max();
+        }
+
+        return interface_many_to_many_refill<dp_algorithm_t, max_bulk_size, configuration_t::is_local>{
+                std::move(algorithm),
+                segment_width};
+    }
+};
+
+// ----------------------------------------------------------------------------
+// configurator
+// ----------------------------------------------------------------------------
+
+template <typename next_configurator_t, typename traits_t>
+struct _configurator
+{
+    struct type;
+};
+
+template <typename next_configurator_t, typename traits_t>
+using configurator_t = typename _configurator<next_configurator_t, traits_t>::type;
+
+template <typename next_configurator_t, typename traits_t>
+struct _configurator<next_configurator_t, traits_t>::type
+{
+    next_configurator_t _next_configurator;
+    traits_t _traits;
+
+    template <typename ...values_t>
+    void set_config(values_t && ... values) noexcept
+    {
+        std::forward<next_configurator_t>(_next_configurator).set_config(std::forward<values_t>(values)..., _traits);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// rule
+// ----------------------------------------------------------------------------
+
+template <typename predecessor_t, typename traits_t>
+struct _rule
+{
+    struct type;
+};
+
+template <typename predecessor_t, typename traits_t>
+using rule = typename _rule<predecessor_t, traits_t>::type;
+
+template <typename predecessor_t, typename traits_t>
+struct _rule<predecessor_t, traits_t>::type : cfg::execution::rule<predecessor_t>
+{
+    predecessor_t _predecessor;
+    traits_t _traits;
+
+    using traits_type = type_list<traits_t>;
+
+    template <template <typename ...> typename type_list_t>
+    using configurator_types = typename concat_type_lists_t<configurator_types_t<std::remove_cvref_t<predecessor_t>,
+                                                                                 type_list>,
+                                                            traits_type>::template apply<type_list_t>;
+
+    template <typename next_configurator_t>
+    auto apply(next_configurator_t && next_configurator) const
+    {
+        return _predecessor.apply(configurator_t<next_configurator_t, traits_t>{
+                    std::forward<next_configurator_t>(next_configurator),
+                    _traits
+                });
+    }
+};
+
+// ----------------------------------------------------------------------------
+// CPO
+// ----------------------------------------------------------------------------
+
+namespace _cpo
+{
+struct _fn
+{
+    // implementation of function style connection
+    template <typename predecessor_t>
+    constexpr auto operator()(predecessor_t && predecessor, size_t const segment_width = 64) const
+    {
+        return _execution_lane_refill::rule<predecessor_t, traits>{{},
+                                                                   std::forward<predecessor_t>(predecessor),
+                                                                   traits{segment_width}};
+    }
+};
+} // namespace _cpo
+} // namespace _execution_lane_refill
+
+inline constexpr _execution_lane_refill::_cpo::_fn execution_lane_refill{};
+
+} // namespace cfg
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
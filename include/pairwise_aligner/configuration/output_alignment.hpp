@@ -0,0 +1,134 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::cfg::output_alignment.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <type_traits>
+
+#include <pairwise_aligner/configuration/rule_output.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_hirschberg.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_traceback.hpp>
+#include <pairwise_aligner/simd/concept.hpp>
+#include <pairwise_aligner/type_traits.hpp>
+#include <pairwise_aligner/utility/type_list.hpp>
+
+namespace seqan::pairwise_aligner {
+inline namespace v1
+{
+namespace cfg
+{
+namespace _output_alignment
+{
+
+/*!\brief Outputs the alignment of every pair in addition to its score.
+ *
+ * For simd score models the dp kernel records the trace codes of all cells, from which the CIGAR string and the
+ * begin and end coordinate of every alignment is reconstructed. The trace back starts in the cell of the optimal
+ * score, such that free trailing gaps and local alignments are supported.
+ * For scalar score models the alignment is computed in linear memory with the divide-and-conquer strategy of
+ * Myers and Miller, which requires penalised leading and trailing gaps and a global alignment.
+ */
+struct traits
+{
+    static constexpr cfg::detail::rule_category category = cfg::detail::rule_category::output;
+
+    using is_begin_coordinate_output_type = std::false_type;
+
+    //!\brief Simd score models record the trace codes and scalar score models align in linear memory.
+    template <typename score_t>
+    using dp_algorithm_template_type = std::conditional_t<simd::simd_type<score_t>,
+                                                          lazy_algorithm_template<dp_algorithm_template_traceback>,
+                                                          lazy_algorithm_template<dp_algorithm_template_hirschberg>>;
+};
+
+
+template <typename next_configurator_t, typename traits_t>
+struct _configurator
+{
+    struct type;
+};
+
+template <typename next_configurator_t, typename traits_t>
+using configurator_t = typename _configurator<next_configurator_t, traits_t>::type;
+
+template <typename next_configurator_t, typename traits_t>
+struct _configurator<next_configurator_t, traits_t>::type
+{
+    next_configurator_t _next_configurator;
+    traits_t _traits;
+
+    template <typename ...values_t>
+    void set_config(values_t && ... values) noexcept
+    {
+        std::forward<next_configurator_t>(_next_configurator).set_config(std::forward<values_t>(values)..., _traits);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// rule
+// ----------------------------------------------------------------------------
+
+template <typename predecessor_t, typename traits_t>
+struct _rule
+{
+    struct type;
+};
+
+template <typename predecessor_t, typename traits_t>
+using rule = typename _rule<predecessor_t, traits_t>::type;
+
+template <typename predecessor_t, typename traits_t>
+struct _rule<predecessor_t, traits_t>::type : cfg::output::rule<predecessor_t>
+{
+    predecessor_t _predecessor;
+    traits_t _traits;
+
+    using traits_type = type_list<traits_t>;
+
+    template <template <typename ...> typename type_list_t>
+    using configurator_types = typename concat_type_lists_t<configurator_types_t<std::remove_cvref_t<predecessor_t>,
+                                                                                 type_list>,
+                                                            traits_type>::template apply<type_list_t>;
+
+    template <typename next_configurator_t>
+    auto apply(next_configurator_t && next_configurator) const
+    {
+        return _predecessor.apply(configurator_t<next_configurator_t, traits_t>{
+                    std::forward<next_configurator_t>(next_configurator),
+                    _traits
+                });
+    }
+};
+
+// ----------------------------------------------------------------------------
+// CPO
+// ----------------------------------------------------------------------------
+
+namespace _cpo
+{
+struct _fn
+{
+    // implementation of function style connection
+    template <typename predecessor_t>
+    constexpr auto operator()(predecessor_t && predecessor) const
+    {
+        return _output_alignment::rule<predecessor_t, traits>{{}, std::forward<predecessor_t>(predecessor), traits{}};
+    }
+};
+} // namespace _cpo
+} // namespace _output_alignment
+
+inline constexpr _output_alignment::_cpo::_fn output_alignment{};
+
+} // namespace cfg
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
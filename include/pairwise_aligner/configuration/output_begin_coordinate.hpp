@@ -0,0 +1,129 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::cfg::output_begin_coordinate.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <type_traits>
+
+#include <pairwise_aligner/configuration/rule_output.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_begin_coordinate.hpp>
+#include <pairwise_aligner/type_traits.hpp>
+#include <pairwise_aligner/utility/type_list.hpp>
+
+namespace seqan::pairwise_aligner {
+inline namespace v1
+{
+namespace cfg
+{
+namespace _output_begin_coordinate
+{
+
+/*!\brief Outputs the begin coordinate of every local alignment in addition to its score and end coordinate.
+ *
+ * The begin coordinates are found by a second bulk, which aligns the reversed prefixes ending in the end coordinates
+ * of all lanes at once. Only local alignments with a simd score model are supported.
+ */
+struct traits
+{
+    static constexpr cfg::detail::rule_category category = cfg::detail::rule_category::output;
+
+    using is_begin_coordinate_output_type = std::true_type;
+
+    //!\brief The algorithm template appending the reverse pass to the one of the score model.
+    template <typename score_t>
+    using dp_algorithm_template_type = lazy_algorithm_template<dp_algorithm_template_begin_coordinate>;
+};
+
+
+template <typename next_configurator_t, typename traits_t>
+struct _configurator
+{
+    struct type;
+};
+
+template <typename next_configurator_t, typename traits_t>
+using configurator_t = typename _configurator<next_configurator_t, traits_t>::type;
+
+template <typename next_configurator_t, typename traits_t>
+struct _configurator<next_configurator_t, traits_t>::type
+{
+    next_configurator_t _next_configurator;
+    traits_t _traits;
+
+    template <typename ...values_t>
+    void set_config(values_t && ... values) noexcept
+    {
+        std::forward<next_configurator_t>(_next_configurator).set_config(std::forward<values_t>(values)..., _traits);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// rule
+// ----------------------------------------------------------------------------
+
+template <typename predecessor_t, typename traits_t>
+struct _rule
+{
+    struct type;
+};
+
+template <typename predecessor_t, typename traits_t>
+using rule = typename _rule<predecessor_t, traits_t>::type;
+
+template <typename predecessor_t, typename traits_t>
+struct _rule<predecessor_t, traits_t>::type : cfg::output::rule<predecessor_t>
+{
+    predecessor_t _predecessor;
+    traits_t _traits;
+
+    using traits_type = type_list<traits_t>;
+
+    template <template <typename ...> typename type_list_t>
+    using configurator_types = typename concat_type_lists_t<configurator_types_t<std::remove_cvref_t<predecessor_t>,
+                                                                                 type_list>,
+                                                            traits_type>::template apply<type_list_t>;
+
+    template <typename next_configurator_t>
+    auto apply(next_configurator_t && next_configurator) const
+    {
+        return _predecessor.apply(configurator_t<next_configurator_t, traits_t>{
+                    std::forward<next_configurator_t>(next_configurator),
+                    _traits
+                });
+    }
+};
+
+// ----------------------------------------------------------------------------
+// CPO
+// ----------------------------------------------------------------------------
+
+namespace _cpo
+{
+struct _fn
+{
+    // implementation of function style connection
+    template <typename predecessor_t>
+    constexpr auto operator()(predecessor_t && predecessor) const
+    {
+        return _output_begin_coordinate::rule<predecessor_t, traits>{{},
+                                                                     std::forward<predecessor_t>(predecessor),
+                                                                     traits{}};
+    }
+};
+} // namespace _cpo
+} // namespace _output_begin_coordinate
+
+inline constexpr _output_begin_coordinate::_cpo::_fn output_begin_coordinate{};
+
+} // namespace cfg
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -0,0 +1,141 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::cfg::output_suboptimal_alignments.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include <pairwise_aligner/configuration/rule_output.hpp>
+#include <pairwise_aligner/configuration/suboptimal_alignment_policy.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_suboptimal.hpp>
+#include <pairwise_aligner/type_traits.hpp>
+#include <pairwise_aligner/utility/type_list.hpp>
+
+namespace seqan::pairwise_aligner {
+inline namespace v1
+{
+namespace cfg
+{
+namespace _output_suboptimal_alignments
+{
+
+/*!\brief Outputs up to a given number of non-overlapping local alignments of every pair.
+ *
+ * The alignments are enumerated with the declumping strategy of Waterman and Eggert: after an alignment was reported,
+ * the cells it aligns are excluded from all further alignments and only the cells depending on them are recomputed.
+ * Hence, no two alignments share a pair of aligned symbols. Only local alignments with a scalar score model and the
+ * affine gap model are supported.
+ */
+struct traits
+{
+    static constexpr cfg::detail::rule_category category = cfg::detail::rule_category::output;
+
+    using is_begin_coordinate_output_type = std::false_type;
+    using suboptimal_policy_type = cfg::suboptimal_alignment_policy;
+
+    //!\brief The algorithm template keeping the full dp matrix for the declumping.
+    template <typename score_t>
+    using dp_algorithm_template_type = lazy_algorithm_template<dp_algorithm_template_suboptimal>;
+
+    size_t _alignment_count{};
+
+    constexpr suboptimal_policy_type configure_suboptimal_policy() const noexcept
+    {
+        return suboptimal_policy_type{.alignment_count = _alignment_count};
+    }
+};
+
+
+template <typename next_configurator_t, typename traits_t>
+struct _configurator
+{
+    struct type;
+};
+
+template <typename next_configurator_t, typename traits_t>
+using configurator_t = typename _configurator<next_configurator_t, traits_t>::type;
+
+template <typename next_configurator_t, typename traits_t>
+struct _configurator<next_configurator_t, traits_t>::type
+{
+    next_configurator_t _next_configurator;
+    traits_t _traits;
+
+    template <typename ...values_t>
+    void set_config(values_t && ... values) noexcept
+    {
+        std::forward<next_configurator_t>(_next_configurator).set_config(std::forward<values_t>(values)..., _traits);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// rule
+// ----------------------------------------------------------------------------
+
+template <typename predecessor_t, typename traits_t>
+struct _rule
+{
+    struct type;
+};
+
+template <typename predecessor_t, typename traits_t>
+using rule = typename _rule<predecessor_t, traits_t>::type;
+
+template <typename predecessor_t, typename traits_t>
+struct _rule<predecessor_t, traits_t>::type : cfg::output::rule<predecessor_t>
+{
+    predecessor_t _predecessor;
+    traits_t _traits;
+
+    using traits_type = type_list<traits_t>;
+
+    template <template <typename ...> typename type_list_t>
+    using configurator_types = typename concat_type_lists_t<configurator_types_t<std::remove_cvref_t<predecessor_t>,
+                                                                                 type_list>,
+                                                            traits_type>::template apply<type_list_t>;
+
+    template <typename next_configurator_t>
+    auto apply(next_configurator_t && next_configurator) const
+    {
+        return _predecessor.apply(configurator_t<next_configurator_t, traits_t>{
+                    std::forward<next_configurator_t>(next_configurator),
+                    _traits
+                });
+    }
+};
+
+// ----------------------------------------------------------------------------
+// CPO
+// ----------------------------------------------------------------------------
+
+namespace _cpo
+{
+struct _fn
+{
+    // implementation of function style connection
+    template <typename predecessor_t>
+    constexpr auto operator()(predecessor_t && predecessor, size_t const alignment_count) const
+    {
+        return _output_suboptimal_alignments::rule<predecessor_t, traits>{{},
+                                                                          std::forward<predecessor_t>(predecessor),
+                                                                          traits{alignment_count}};
+    }
+};
+} // namespace _cpo
+} // namespace _output_suboptimal_alignments
+
+inline constexpr _output_suboptimal_alignments::_cpo::_fn output_suboptimal_alignments{};
+
+} // namespace cfg
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
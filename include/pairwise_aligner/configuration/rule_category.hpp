@@ -26,7 +26,11 @@ enum struct rule_category : uint8_t
     score_model = 0,
     gap_model = 1,
     method = 2,
-    size = 3
+    execution = 3,
+    output = 4,
+    band = 5,
+    threshold = 6,
+    size = 7
 };
 
 } // namespace cfg::detail
@@ -12,8 +12,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
 
 namespace seqan::pairwise_aligner {
 inline namespace v1
@@ -23,6 +27,12 @@ namespace cfg
 namespace detail
 {
 
+/*!\brief Computes the block sizes and zero offsets of the saturated score models.
+ *
+ * The bounds are derived for the value range of `saturated_score_t`, which is the scalar type of the saturated
+ * simd scores. A wider type allows larger blocks, such that the offsets of the dp vectors are updated less often.
+ */
+template <typename saturated_score_t = int8_t>
 struct saturated_block_handler
 {
 public:
@@ -30,7 +40,19 @@ public:
     template <typename score_t>
     static auto lowest_viable_local_score(score_t const gap_open, score_t const gap_extension) noexcept
     {
-        return std::numeric_limits<int8_t>::lowest() - gap_open - (2 * gap_extension);
+        return std::numeric_limits<saturated_score_t>::lowest() - gap_open - (2 * gap_extension);
+    }
+
+    // Uses the highest local score of both pieces, if the gap model has a second affine piece.
+    template <typename configuration_t>
+    static auto lowest_viable_local_score(configuration_t const & configuration) noexcept
+    {
+        auto local_score = lowest_viable_local_score(configuration._gap_open_score,
+                                                     configuration._gap_extension_score);
+        if constexpr (requires { configuration._long_gap_open_score; })
+            local_score = std::max(local_score, lowest_viable_local_score(configuration._long_gap_open_score,
+                                                                          configuration._long_gap_extension_score));
+        return local_score;
     }
 
     template <typename score_t, typename gap_score_t>
@@ -39,22 +61,48 @@ public:
                                                  gap_score_t const gap_open,
                                                  gap_score_t const gap_extension) noexcept
     {
-        auto [block_size_gap, zero_offset_gap] = max_block_size_with_gaps(match,
-                                                                          std::abs(gap_open),
-                                                                          std::abs(gap_extension));
-        auto [block_size_mismatch, zero_offset_mismatch] = max_block_size_with_mismatch(match, std::abs(mismatch));
+        return select_block_size(max_block_size_with_gaps(match, std::abs(gap_open), std::abs(gap_extension)),
+                                 max_block_size_with_mismatch(match, std::abs(mismatch)));
+    }
+
+    // Reads the gap scores from the configuration. The cells store the gap scores of both pieces of a dual affine
+    // gap model, such that the piece with the smaller block size limits the gaps in a block.
+    template <typename score_t, typename configuration_t>
+    static constexpr auto compute_max_block_size(score_t const match,
+                                                 score_t const mismatch,
+                                                 configuration_t const & configuration) noexcept
+    {
+        auto block_gap = max_block_size_with_gaps(match,
+                                                  std::abs(configuration._gap_open_score),
+                                                  std::abs(configuration._gap_extension_score));
+        if constexpr (requires { configuration._long_gap_open_score; }) {
+            auto block_long_gap = max_block_size_with_gaps(match,
+                                                           std::abs(configuration._long_gap_open_score),
+                                                           std::abs(configuration._long_gap_extension_score));
+            if (block_long_gap.first < block_gap.first)
+                block_gap = block_long_gap;
+        }
+
+        return select_block_size(block_gap, max_block_size_with_mismatch(match, std::abs(mismatch)));
+    }
+
+private:
+    static constexpr auto select_block_size(std::pair<size_t, saturated_score_t> const block_gap,
+                                            std::pair<size_t, saturated_score_t> const block_mismatch) noexcept
+    {
+        auto [block_size_gap, zero_offset_gap] = block_gap;
+        auto [block_size_mismatch, zero_offset_mismatch] = block_mismatch;
 
         // Choose the max of both block sizes since due to the recursion the largest negative distance is affected
         // by the lowest negative score with the given block size.
         // Also set the corresponding zero offset accordingly.
-        int8_t zero_offset{};
+        saturated_score_t zero_offset{};
         size_t max_block_size = (block_size_gap < block_size_mismatch)
                               ? (zero_offset = zero_offset_mismatch, block_size_mismatch)
                               : (zero_offset = zero_offset_gap, block_size_gap);
         return std::pair{zero_offset, max_block_size};
     }
 
-private:
     static constexpr auto max_block_size_with_gaps(float const match,
                                                    float const gap_open,
                                                    float const gap_extension) noexcept
@@ -65,20 +113,20 @@ private:
 
         // This formula computes the maximal block size and the respective zero offset for which the scores during
         // the computation of the alignment blocks in saturated mode are guaranteed to not exceed the value range
-        // of the machines int8_t type, under the condition of having only gaps in a single block.
-        // It is derived from solving the following equations:
+        // of the saturated score type, under the condition of having only gaps in a single block.
+        // It is derived from solving the following equations, here given for int8_t:
         //  I: 127 >= x + match * block_size + gap_open + gap_extension * block_size
         // II: -128 <= x - 2 * (gap_open + gap_extension * block_size)
         // Here x represents the zero offset for which the block size is maximised.
 
-        float const max_score = std::numeric_limits<int8_t>::max();
-        float const min_score = std::numeric_limits<int8_t>::lowest();
+        float const max_score = std::numeric_limits<saturated_score_t>::max();
+        float const min_score = std::numeric_limits<saturated_score_t>::lowest();
         float const upper_score_limit = max_score - gap_open;
         float const block_divisor = match + gap_extension;
         float const block_scale = 2 * gap_extension / block_divisor;
 
-        int8_t const zero_offset = std::ceil((min_score + 2 * gap_open + (block_scale * upper_score_limit)) /
-                                             (1 + block_scale));
+        saturated_score_t const zero_offset =
+            std::ceil((min_score + 2 * gap_open + (block_scale * upper_score_limit)) / (1 + block_scale));
         size_t const block_size = std::floor((upper_score_limit - zero_offset) / block_divisor);
 
         return std::pair{block_size, zero_offset};
@@ -91,17 +139,17 @@ private:
 
         // This formula computes the maximal block size and the respective zero offset for which the scores during
         // the computation of the alignment blocks in saturated mode are guaranteed to not exceed the value range
-        // of the machines int8_t type, under the condition of having only mismatches in a single block.
-        // It is derived from solving the following equations:
+        // of the saturated score type, under the condition of having only mismatches in a single block.
+        // It is derived from solving the following equations, here given for int8_t:
         //  I: 127 >= x + match * block_size + mismatch * block_size
         // II: -128 <= x - mismatch * block_size
         // Here x represents the zero offset for which the block size is maximised.
 
-        float const max_score = std::numeric_limits<int8_t>::max();
-        float const min_score = std::numeric_limits<int8_t>::lowest();
+        float const max_score = std::numeric_limits<saturated_score_t>::max();
+        float const min_score = std::numeric_limits<saturated_score_t>::lowest();
         float const block_scale = mismatch / (match + mismatch);
 
-        int8_t const zero_offset = std::ceil((min_score + max_score * block_scale) / (1 + block_scale));
+        saturated_score_t const zero_offset = std::ceil((min_score + max_score * block_scale) / (1 + block_scale));
         size_t const block_size = std::floor((max_score - zero_offset) / (match + mismatch));
 
         return std::pair{block_size, zero_offset};
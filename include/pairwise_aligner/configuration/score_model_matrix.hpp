@@ -6,7 +6,8 @@
 // -----------------------------------------------------------------------------------------------------
 
 /*!\file
- * \brief Provides seqan::pairwise_aligner::cfg::score_model_matrix.
+ * \brief Provides seqan::pairwise_aligner::cfg::score_model_matrix and
+ *        seqan::pairwise_aligner::cfg::score_model_matrix_anti_diagonal.
  * \author Rene Rahn <rahn AT molgen.mpg.de>
  */
 
@@ -19,6 +20,7 @@
 #include <pairwise_aligner/alphabet_conversion/alphabet_rank_map_scalar.hpp>
 #include <pairwise_aligner/configuration/initial.hpp>
 #include <pairwise_aligner/configuration/rule_score_model.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_anti_diagonal.hpp>
 #include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_standard.hpp>
 #include <pairwise_aligner/interface/interface_one_to_one_single.hpp>
 #include <pairwise_aligner/matrix/dp_matrix_block.hpp>
@@ -48,7 +50,7 @@ namespace _score_model_matrix
 // traits
 // ----------------------------------------------------------------------------
 
-template <typename matrix_t, typename rank_map_t, size_t dimension_v>
+template <typename matrix_t, typename rank_map_t, size_t dimension_v, bool is_anti_diagonal = false>
 struct traits
 {
     static constexpr cfg::detail::rule_category category = cfg::detail::rule_category::score_model;
@@ -120,7 +122,11 @@ struct traits
 
         using dp_matrix_policy_t =
                 dp_matrix_policies<std::remove_reference_t<std::invoke_result_t<decltype(make_dp_matrix_policy)>>>;
-        using algorithm_t = typename configuration_t::algorithm_type<dp_algorithm_template_standard,
+        using algorithm_template_t =
+                std::conditional_t<is_anti_diagonal,
+                                   lazy_algorithm_template<dp_algorithm_template_anti_diagonal>,
+                                   lazy_algorithm_template<dp_algorithm_template_standard>>;
+        using algorithm_t = typename configuration_t::algorithm_type<algorithm_template_t::template type,
                                                                      dp_matrix_policy_t,
                                                                      std::remove_cvref_t<policies_t>...>;
 
@@ -197,6 +203,7 @@ struct _rule<predecessor_t, traits_t>::type : cfg::score_model::rule<predecessor
 
 namespace _cpo
 {
+template <bool is_anti_diagonal = false>
 struct _fn
 {
     template <typename predecessor_t, typename alphabet_t, typename score_t, size_t dimension>
@@ -220,7 +227,7 @@ struct _fn
                                 linear_matrix.data() + (rank * dimension));
         };
 
-        using traits_t = traits<substitution_matrix_t, alphabet_rank_map_scalar, dimension>;
+        using traits_t = traits<substitution_matrix_t, alphabet_rank_map_scalar, dimension, is_anti_diagonal>;
         return _score_model_matrix::rule<predecessor_t, traits_t>{{},
                                                                    std::forward<predecessor_t>(predecessor),
                                                                    traits_t{std::move(linear_matrix),
@@ -238,7 +245,13 @@ struct _fn
 } // namespace _cpo
 } // namespace _score_model
 
-inline constexpr _score_model_matrix::_cpo::_fn score_model_matrix{};
+inline constexpr _score_model_matrix::_cpo::_fn<> score_model_matrix{};
+
+/*!\brief Configures the substitution matrix score model, which computes the anti-diagonals with simd vectors.
+ *
+ * See seqan::pairwise_aligner::cfg::score_model_unitary_anti_diagonal.
+ */
+inline constexpr _score_model_matrix::_cpo::_fn<true> score_model_matrix_anti_diagonal{};
 
 } // namespace cfg
 } // inline namespace v1
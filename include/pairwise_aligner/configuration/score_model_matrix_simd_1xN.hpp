@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <ranges>
 #include <type_traits>
 #include <utility>
@@ -92,6 +93,15 @@ struct traits
 
     using result_factory_type = tracker::global_simd_fixed::factory<score_type>;
 
+    // The best score of a single aligned pair, which bounds the score the remaining cells of a pair can add.
+    constexpr int32_t max_substitution_score() const noexcept
+    {
+        int32_t max_score = std::numeric_limits<int32_t>::lowest();
+        for (auto const & matrix_row : _substitution_matrix)
+            max_score = std::max<int32_t>(max_score, std::ranges::max(matrix_row.second));
+        return max_score;
+    }
+
     template <typename configuration_t>
     constexpr auto configure_substitution_policy([[maybe_unused]] configuration_t const & configuration) const noexcept
     {
@@ -145,7 +155,8 @@ struct traits
                             rank_map),
                     dp_vector_bulk_factory(
                         dp_vector_rank_transformation_factory(
-                            dp_vector_chunk_factory(dp_vector_single<row_cell_t, buffer_t<row_cell_t>>{}),
+                            dp_vector_chunk_factory(dp_vector_single<row_cell_t, buffer_t<row_cell_t>>{},
+                                                    configuration_t::column_block_size),
                             rank_map),
                         index_type{padding_symbol})
         };
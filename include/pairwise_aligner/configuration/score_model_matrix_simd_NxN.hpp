@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <ranges>
 #include <type_traits>
 #include <utility>
@@ -22,7 +23,7 @@
 #include <pairwise_aligner/configuration/rule_score_model.hpp>
 #include <pairwise_aligner/alphabet_conversion/alphabet_rank_map_simd.hpp>
 #include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_standard.hpp>
-#include <pairwise_aligner/interface/interface_one_to_one_bulk.hpp>
+#include <pairwise_aligner/interface/interface_many_to_many_batch.hpp>
 #include <pairwise_aligner/matrix/dp_matrix_block.hpp>
 #include <pairwise_aligner/matrix/dp_matrix_column.hpp>
 #include <pairwise_aligner/matrix/dp_matrix_lane.hpp>
@@ -84,10 +85,19 @@ struct traits
     using dp_vector_row_type = dp_vector_bulk<dp_vector_t, score_type>;
 
     template <typename dp_algorithm_t>
-    using dp_interface_type = interface_one_to_one_bulk<dp_algorithm_t, score_type::size_v>;
+    using dp_interface_type = interface_many_to_many_batch<dp_algorithm_t, score_type::size_v>;
 
     using result_factory_type = tracker::global_simd_fixed::factory<score_type>;
 
+    // The best score of a single aligned pair, which bounds the score the remaining cells of a pair can add.
+    constexpr int32_t max_substitution_score() const noexcept
+    {
+        int32_t max_score = std::numeric_limits<int32_t>::lowest();
+        for (auto const & matrix_row : _substitution_matrix)
+            max_score = std::max<int32_t>(max_score, std::ranges::max(matrix_row.second));
+        return max_score;
+    }
+
     template <typename configuration_t>
     constexpr auto configure_substitution_policy([[maybe_unused]] configuration_t const & configuration) const noexcept
     {
@@ -139,21 +149,24 @@ struct traits
                         dp_vector_rank_transformation_factory(
                             dp_vector_offset_transformation(
                                 dp_vector_chunk_factory(dp_vector_single<column_cell_t>{}),
-                                offset_transform{dimension, matrix_size}
+                                offset_transform{dimension, matrix_size},
+                                std::type_identity<index_type>{}
                             ), rank_map
                         ), index_type{padding_symbol}),
                     dp_vector_bulk_factory(
                         dp_vector_rank_transformation_factory(
                             dp_vector_offset_transformation(
-                                dp_vector_chunk_factory(dp_vector_single<row_cell_t>{}),
-                                offset_transform{dimension, matrix_size}
+                                dp_vector_chunk_factory(dp_vector_single<row_cell_t>{},
+                                                        configuration_t::column_block_size),
+                                offset_transform{dimension, matrix_size},
+                                std::type_identity<index_type>{}
                             ), rank_map
                         ), index_type{padding_symbol})
         };
     }
 
     template <typename configuration_t, typename ...policies_t>
-    constexpr auto configure_algorithm(configuration_t const &, policies_t && ...policies) const noexcept
+    constexpr auto configure_algorithm(configuration_t const & configuration, policies_t && ...policies) const noexcept
     {
         auto make_dp_matrix_policy = [&] () constexpr {
 
@@ -173,8 +186,8 @@ struct traits
                                                                      dp_matrix_policy_t,
                                                                      std::remove_cvref_t<policies_t>...>;
 
-        return interface_one_to_one_bulk<algorithm_t, score_type::size_v>{
-                algorithm_t{dp_matrix_policy_t{make_dp_matrix_policy()}, std::move(policies)...}};
+        return configuration.template bulk_interface<score_type::size_v>(
+                algorithm_t{dp_matrix_policy_t{make_dp_matrix_policy()}, std::move(policies)...});
     }
 };
 
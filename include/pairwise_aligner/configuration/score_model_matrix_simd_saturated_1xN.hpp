@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <ranges>
 #include <type_traits>
 #include <utility>
@@ -69,7 +70,7 @@ struct traits
     using matrix_row_t = typename substitution_matrix_t::value_type;
     using symbol_t = std::tuple_element_t<0, matrix_row_t>;
     using score_t = typename std::tuple_element_t<1, matrix_row_t>::value_type;
-    using block_handler_t = detail::saturated_block_handler;
+    using block_handler_t = detail::saturated_block_handler<>;
 
     // simd score typ: use full range?
     using index_type = simd_score<int8_t>;
@@ -92,6 +93,15 @@ struct traits
     template <typename dp_vector_t>
     using dp_vector_row_type = dp_vector_bulk<dp_vector_t, score_type>;
 
+    // The best score of a single aligned pair, which bounds the score the remaining cells of a pair can add.
+    constexpr int32_t max_substitution_score() const noexcept
+    {
+        int32_t max_score = std::numeric_limits<int32_t>::lowest();
+        for (auto const & matrix_row : _substitution_matrix)
+            max_score = std::max<int32_t>(max_score, std::ranges::max(matrix_row.second));
+        return max_score;
+    }
+
     template <typename configuration_t>
     constexpr auto configure_substitution_policy([[maybe_unused]] configuration_t const & configuration) const noexcept
     {
@@ -107,8 +117,7 @@ struct traits
         });
 
         // We need to select the profile!
-        int8_t local_zero = block_handler_t::lowest_viable_local_score(configuration._gap_open_score,
-                                                                       configuration._gap_extension_score);
+        int8_t local_zero = block_handler_t::lowest_viable_local_score(configuration);
         return score_model_type{tmp, static_cast<score_type>(local_zero)};
     }
 
@@ -127,8 +136,7 @@ struct traits
         auto [global_zero, max_block_size] =
             block_handler_t::compute_max_block_size(max_match_score,
                                                     min_mismatch_score,
-                                                    configuration._gap_open_score,
-                                                    configuration._gap_extension_score);
+                                                    configuration);
 
         if constexpr (configuration_t::is_local) {
             return tracker::local_simd_saturated::factory<score_type, original_score_type>{};
@@ -161,8 +169,7 @@ struct traits
         auto [global_zero, max_block_size] =
             block_handler_t::compute_max_block_size(max_match_score,
                                                     min_mismatch_score,
-                                                    configuration._gap_open_score,
-                                                    configuration._gap_extension_score);
+                                                    configuration);
         // Add padding symbol: Assuming the symbols are sorted lexicographically, take the last symbol plus one
         // (only char?).
         // TODO: Find some unused values between ranks/symbols!
@@ -180,9 +187,10 @@ struct traits
             using orginal_cell_t = typename decltype(original_cell_type)::type;
             using base_vector_t = decltype(base_vector);
             if constexpr (configuration_t::is_local) {
-                int8_t local_zero = block_handler_t::lowest_viable_local_score(configuration._gap_open_score,
-                                                                               configuration._gap_extension_score);
-                int8_t threshold = std::numeric_limits<int8_t>::max() - (max_block_size * _match_padding_score);
+                int8_t local_zero = block_handler_t::lowest_viable_local_score(configuration);
+                // A block keeps the scores relative to the local zero, as long as its offset cell lies below the
+                // global zero offset. Then all scores of the block fit into the saturated range.
+                int8_t threshold = global_zero;
                 return dp_vector_saturated_local_factory<orginal_cell_t>(std::forward<base_vector_t>(base_vector),
                                                                          local_zero,
                                                                          global_zero,
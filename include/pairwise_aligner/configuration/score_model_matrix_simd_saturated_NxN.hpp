@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <ranges>
 #include <type_traits>
 #include <utility>
@@ -23,7 +24,7 @@
 #include <pairwise_aligner/configuration/saturated_block_handler.hpp>
 #include <pairwise_aligner/alphabet_conversion/alphabet_rank_map_simd.hpp>
 #include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_standard.hpp>
-#include <pairwise_aligner/interface/interface_one_to_one_bulk.hpp>
+#include <pairwise_aligner/interface/interface_many_to_many_batch.hpp>
 // #include <pairwise_aligner/matrix/dp_matrix_block_cached_profile.hpp>
 #include <pairwise_aligner/matrix/dp_matrix_block.hpp>
 #include <pairwise_aligner/matrix/dp_matrix_column_saturated_local.hpp>
@@ -73,7 +74,7 @@ struct traits
     using matrix_row_t = typename substitution_matrix_t::value_type;
     using symbol_t = std::tuple_element_t<0, matrix_row_t>;
     using score_t = typename std::tuple_element_t<1, matrix_row_t>::value_type;
-    using block_handler_t = detail::saturated_block_handler;
+    using block_handler_t = detail::saturated_block_handler<>;
 
     // simd score typ: use full range?
     using score_type = simd_score<int8_t>;
@@ -96,6 +97,15 @@ struct traits
     template <typename dp_vector_t>
     using dp_vector_row_type = dp_vector_bulk<dp_vector_t, score_type>;
 
+    // The best score of a single aligned pair, which bounds the score the remaining cells of a pair can add.
+    constexpr int32_t max_substitution_score() const noexcept
+    {
+        int32_t max_score = std::numeric_limits<int32_t>::lowest();
+        for (auto const & matrix_row : _substitution_matrix)
+            max_score = std::max<int32_t>(max_score, std::ranges::max(matrix_row.second));
+        return max_score;
+    }
+
     template <typename configuration_t>
     constexpr auto configure_substitution_policy([[maybe_unused]] configuration_t const & configuration) const noexcept
     {
@@ -128,8 +138,7 @@ struct traits
         auto [global_zero, max_block_size] =
             block_handler_t::compute_max_block_size(max_match_score,
                                                     min_mismatch_score,
-                                                    configuration._gap_open_score,
-                                                    configuration._gap_extension_score);
+                                                    configuration);
         if constexpr (configuration_t::is_local) {
             return tracker::local_simd_saturated::factory<score_type, original_score_type>{};
         } else {
@@ -161,8 +170,7 @@ struct traits
         auto [global_zero, max_block_size] =
             block_handler_t::compute_max_block_size(max_match_score,
                                                     min_mismatch_score,
-                                                    configuration._gap_open_score,
-                                                    configuration._gap_extension_score);
+                                                    configuration);
         // Add padding symbol: Assuming the symbols are sorted lexicographically, take the last symbol plus one
         // (only char?).
         // TODO: Find some unused values between ranks/symbols!
@@ -182,9 +190,10 @@ struct traits
             using orginal_cell_t = typename decltype(original_cell_type)::type;
             using base_vector_t = decltype(base_vector);
             if constexpr (configuration_t::is_local) {
-                int8_t local_zero = block_handler_t::lowest_viable_local_score(configuration._gap_open_score,
-                                                                               configuration._gap_extension_score);
-                int8_t threshold = std::numeric_limits<int8_t>::max() - (max_block_size * _match_padding_score);
+                int8_t local_zero = block_handler_t::lowest_viable_local_score(configuration);
+                // A block keeps the scores relative to the local zero, as long as its offset cell lies below the
+                // global zero offset. Then all scores of the block fit into the saturated range.
+                int8_t threshold = global_zero;
                 return dp_vector_saturated_local_factory<orginal_cell_t>(std::forward<base_vector_t>(base_vector),
                                                                          local_zero,
                                                                          global_zero,
@@ -203,7 +212,8 @@ struct traits
                                     saturated_vector(std::type_identity<original_column_cell_t>{},
                                                      dp_vector_single<column_cell_t>{}),
                                     max_block_size),
-                                offset_transform{dimension, matrix_size}),
+                                offset_transform{dimension, matrix_size},
+                                std::type_identity<index_type>{}),
                             rank_map),
                         index_type{padding_symbol}),
                     dp_vector_bulk_factory(
@@ -213,14 +223,15 @@ struct traits
                                     saturated_vector(std::type_identity<original_row_cell_t>{},
                                                      dp_vector_single<row_cell_t>{}),
                                     max_block_size),
-                                offset_transform{dimension, matrix_size}),
+                                offset_transform{dimension, matrix_size},
+                                std::type_identity<index_type>{}),
                             rank_map),
                         index_type{padding_symbol})
         };
     }
 
     template <typename configuration_t, typename ...policies_t>
-    constexpr auto configure_algorithm(configuration_t const &, policies_t && ...policies) const noexcept
+    constexpr auto configure_algorithm(configuration_t const & configuration, policies_t && ...policies) const noexcept
     {
         auto make_dp_matrix_policy = [&] () constexpr {
             if constexpr (configuration_t::is_local)
@@ -241,10 +252,17 @@ struct traits
                                                                      lane_width_policy<4>,
                                                                      std::remove_cvref_t<policies_t>...>;
 
-        return interface_one_to_one_bulk<algorithm_t, score_type::size_v>{
-                algorithm_t{dp_matrix_policy_t{make_dp_matrix_policy()},
-                            lane_width_policy<4>{},
-                            std::move(policies)...}};
+        // The saturated local dp vector tracks its offset per bulk, so its lanes cannot be refilled.
+        if constexpr (configuration_t::is_local)
+            return interface_many_to_many_batch<algorithm_t, score_type::size_v>{
+                    algorithm_t{dp_matrix_policy_t{make_dp_matrix_policy()},
+                                lane_width_policy<4>{},
+                                std::move(policies)...}};
+        else
+            return configuration.template bulk_interface<score_type::size_v>(
+                    algorithm_t{dp_matrix_policy_t{make_dp_matrix_policy()},
+                                lane_width_policy<4>{},
+                                std::move(policies)...});
     }
 };
 
@@ -0,0 +1,100 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::cfg::score_model_matrix_striped.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+#include <pairwise_aligner/configuration/initial.hpp>
+#include <pairwise_aligner/configuration/score_model_matrix.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_striped.hpp>
+#include <pairwise_aligner/interface/interface_one_to_one_single.hpp>
+#include <pairwise_aligner/matrix/dp_matrix_block.hpp>
+#include <pairwise_aligner/matrix/dp_matrix_column.hpp>
+#include <pairwise_aligner/matrix/dp_matrix_lane.hpp>
+#include <pairwise_aligner/matrix/dp_matrix_local.hpp>
+
+namespace seqan::pairwise_aligner {
+inline namespace v1
+{
+namespace cfg
+{
+namespace _score_model_matrix_striped
+{
+
+// ----------------------------------------------------------------------------
+// traits
+// ----------------------------------------------------------------------------
+
+// Same as the traits of the scalar matrix score model, but selects the striped algorithm template.
+template <typename matrix_traits_t>
+struct traits : matrix_traits_t
+{
+    template <typename configuration_t, typename ...policies_t>
+    constexpr auto configure_algorithm(configuration_t const &, policies_t && ...policies) const noexcept
+    {
+        static_assert(configuration_t::is_local, "The striped score model is only supported for local alignments!");
+
+        using dp_matrix_policy_t =
+            dp_matrix_policies<decltype(dp_matrix::matrix_local(dp_matrix::column(dp_matrix::block(dp_matrix::lane))))>;
+        using algorithm_t = typename configuration_t::algorithm_type<dp_algorithm_template_striped,
+                                                                     dp_matrix_policy_t,
+                                                                     std::remove_cvref_t<policies_t>...>;
+
+        return interface_one_to_one_single<algorithm_t>{
+                algorithm_t{dp_matrix_policy_t{dp_matrix::matrix_local(dp_matrix::column(dp_matrix::block(
+                                dp_matrix::lane)))},
+                            std::move(policies)...}};
+    }
+};
+
+// ----------------------------------------------------------------------------
+// CPO
+// ----------------------------------------------------------------------------
+
+namespace _cpo
+{
+struct _fn
+{
+    template <typename predecessor_t, typename alphabet_t, typename score_t, size_t dimension>
+    constexpr auto operator()(predecessor_t && predecessor,
+                              std::array<std::pair<alphabet_t, std::array<score_t, dimension>>, dimension> const &
+                                    substitution_matrix) const
+    {
+        auto matrix_rule = cfg::score_model_matrix(std::forward<predecessor_t>(predecessor), substitution_matrix);
+
+        using traits_t = traits<std::remove_cvref_t<decltype(matrix_rule._traits)>>;
+        return _score_model_matrix::rule<predecessor_t, traits_t>{{},
+                                                                   std::forward<predecessor_t>(
+                                                                        matrix_rule._predecessor),
+                                                                   traits_t{std::move(matrix_rule._traits)}};
+    }
+
+    template <typename alphabet_t, typename score_t, size_t dimension>
+    constexpr auto operator()(std::array<std::pair<alphabet_t, std::array<score_t, dimension>>, dimension> const &
+                                substitution_matrix)
+        const
+    {
+        return this->operator()(cfg::initial, substitution_matrix);
+    }
+};
+} // namespace _cpo
+} // namespace _score_model_matrix_striped
+
+//!\brief Configures the scalar matrix score model, which computes local alignments with a striped query profile.
+inline constexpr _score_model_matrix_striped::_cpo::_fn score_model_matrix_striped{};
+
+} // namespace cfg
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
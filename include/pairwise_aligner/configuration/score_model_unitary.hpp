@@ -6,7 +6,8 @@
 // -----------------------------------------------------------------------------------------------------
 
 /*!\file
- * \brief Provides seqan::pairwise_aligner::cfg::score_model_unitary.
+ * \brief Provides seqan::pairwise_aligner::cfg::score_model_unitary and
+ *        seqan::pairwise_aligner::cfg::score_model_unitary_anti_diagonal.
  * \author Rene Rahn <rahn AT molgen.mpg.de>
  */
 
@@ -17,6 +18,7 @@
 
 #include <pairwise_aligner/configuration/initial.hpp>
 #include <pairwise_aligner/configuration/rule_score_model.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_anti_diagonal.hpp>
 #include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_standard.hpp>
 #include <pairwise_aligner/interface/interface_one_to_one_single.hpp>
 #include <pairwise_aligner/matrix/dp_matrix_block.hpp>
@@ -45,7 +47,7 @@ namespace _score_model_unitary
 // traits
 // ----------------------------------------------------------------------------
 
-template <typename score_t>
+template <typename score_t, bool is_anti_diagonal = false>
 struct traits
 {
     static constexpr cfg::detail::rule_category category = cfg::detail::rule_category::score_model;
@@ -107,7 +109,11 @@ struct traits
 
         using dp_matrix_policy_t =
                 dp_matrix_policies<std::remove_reference_t<std::invoke_result_t<decltype(make_dp_matrix_policy)>>>;
-        using algorithm_t = typename configuration_t::algorithm_type<dp_algorithm_template_standard,
+        using algorithm_template_t =
+                std::conditional_t<is_anti_diagonal,
+                                   lazy_algorithm_template<dp_algorithm_template_anti_diagonal>,
+                                   lazy_algorithm_template<dp_algorithm_template_standard>>;
+        using algorithm_t = typename configuration_t::algorithm_type<algorithm_template_t::template type,
                                                                      dp_matrix_policy_t,
                                                                      std::remove_cvref_t<policies_t>...>;
 
@@ -184,6 +190,7 @@ struct _rule<predecessor_t, traits_t>::type : cfg::score_model::rule<predecessor
 
 namespace _cpo
 {
+template <bool is_anti_diagonal = false>
 struct _fn
 {
     template <typename predecessor_t, typename score_t>
@@ -191,7 +198,7 @@ struct _fn
                               score_t const match_score,
                               score_t const mismatch_score) const
     {
-        using traits_t = traits<score_t>;
+        using traits_t = traits<score_t, is_anti_diagonal>;
         return _score_model_unitary::rule<predecessor_t, traits_t>{{},
                                                                    std::forward<predecessor_t>(predecessor),
                                                                    traits_t{match_score, mismatch_score}};
@@ -206,7 +213,16 @@ struct _fn
 } // namespace _cpo
 } // namespace _score_model
 
-inline constexpr _score_model_unitary::_cpo::_fn score_model_unitary{};
+inline constexpr _score_model_unitary::_cpo::_fn<> score_model_unitary{};
+
+/*!\brief Configures the unitary score model, which computes the cells of an anti-diagonal with simd vectors.
+ *
+ * Uses seqan::pairwise_aligner::dp_algorithm_template_anti_diagonal for single pairs with affine gaps and integral
+ * scores of at least 32 bit. The scores and the last dp column and row equal those of
+ * seqan::pairwise_aligner::cfg::score_model_unitary, but among several cells with the optimal score another end
+ * coordinate might be reported.
+ */
+inline constexpr _score_model_unitary::_cpo::_fn<true> score_model_unitary_anti_diagonal{};
 
 } // namespace cfg
 } // inline namespace v1
@@ -12,13 +12,14 @@
 
 #pragma once
 
+#include <cstdint>
 #include <type_traits>
 #include <utility>
 
 #include <pairwise_aligner/configuration/initial.hpp>
 #include <pairwise_aligner/configuration/rule_score_model.hpp>
 #include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_standard.hpp>
-#include <pairwise_aligner/interface/interface_one_to_one_bulk.hpp>
+#include <pairwise_aligner/interface/interface_many_to_many_batch.hpp>
 #include <pairwise_aligner/matrix/dp_matrix_block.hpp>
 #include <pairwise_aligner/matrix/dp_matrix_column.hpp>
 #include <pairwise_aligner/matrix/dp_matrix_lane.hpp>
@@ -70,10 +71,16 @@ struct traits
     using dp_vector_row_type = dp_vector_bulk<dp_vector_t, score_type>;
 
     template <typename dp_algorithm_t>
-    using dp_interface_type = interface_one_to_one_bulk<dp_algorithm_t, score_type::size_v>;
+    using dp_interface_type = interface_many_to_many_batch<dp_algorithm_t, score_type::size_v>;
 
     using result_factory_type = tracker::global_simd_fixed::factory<score_type>;
 
+    // The best score of a single aligned pair, which bounds the score the remaining cells of a pair can add.
+    constexpr int32_t max_substitution_score() const noexcept
+    {
+        return static_cast<int32_t>(_match_score);
+    }
+
     template <typename configuration_t>
     constexpr auto configure_substitution_policy([[maybe_unused]] configuration_t const & configuration) const noexcept
     {
@@ -105,13 +112,14 @@ struct traits
         return dp_vector_policy{
             dp_vector_bulk_factory(dp_vector_chunk_factory(dp_vector_single<column_cell_t>{}),
                                    score_type{padding_symbol_column}),
-            dp_vector_bulk_factory(dp_vector_chunk_factory(dp_vector_single<row_cell_t>{}),
+            dp_vector_bulk_factory(dp_vector_chunk_factory(dp_vector_single<row_cell_t>{},
+                                                           configuration_t::column_block_size),
                                    score_type{padding_symbol_row})
         };
     }
 
     template <typename configuration_t, typename ...policies_t>
-    constexpr auto configure_algorithm(configuration_t const &, policies_t && ...policies) const noexcept
+    constexpr auto configure_algorithm(configuration_t const & configuration, policies_t && ...policies) const noexcept
     {
         auto make_dp_matrix_policy = [&] () constexpr {
 
@@ -131,8 +139,8 @@ struct traits
                                                                      dp_matrix_policy_t,
                                                                      std::remove_cvref_t<policies_t>...>;
 
-        return interface_one_to_one_bulk<algorithm_t, score_type::size_v>{
-                algorithm_t{dp_matrix_policy_t{make_dp_matrix_policy()}, std::move(policies)...}};
+        return configuration.template bulk_interface<score_type::size_v>(
+                algorithm_t{dp_matrix_policy_t{make_dp_matrix_policy()}, std::move(policies)...});
     }
 };
 
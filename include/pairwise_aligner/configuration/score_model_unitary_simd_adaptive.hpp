@@ -0,0 +1,285 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::cfg::score_model_unitary_simd_adaptive.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <pairwise_aligner/configuration/initial.hpp>
+#include <pairwise_aligner/configuration/rule_score_model.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_standard.hpp>
+#include <pairwise_aligner/interface/interface_many_to_many_adaptive.hpp>
+#include <pairwise_aligner/interface/interface_many_to_many_batch.hpp>
+#include <pairwise_aligner/matrix/dp_matrix_block.hpp>
+#include <pairwise_aligner/matrix/dp_matrix_column.hpp>
+#include <pairwise_aligner/matrix/dp_matrix_lane.hpp>
+#include <pairwise_aligner/matrix/dp_matrix_local.hpp>
+#include <pairwise_aligner/matrix/dp_vector_bulk.hpp>
+#include <pairwise_aligner/matrix/dp_vector_chunk.hpp>
+#include <pairwise_aligner/matrix/dp_vector_policy.hpp>
+#include <pairwise_aligner/matrix/dp_vector_single.hpp>
+#include <pairwise_aligner/score_model/score_model_unitary_simd_local.hpp>
+#include <pairwise_aligner/simd/simd_score_type.hpp>
+#include <pairwise_aligner/tracker/tracker_local_simd_fixed.hpp>
+#include <pairwise_aligner/type_traits.hpp>
+#include <pairwise_aligner/utility/type_list.hpp>
+
+namespace seqan::pairwise_aligner {
+inline namespace v1
+{
+namespace cfg
+{
+namespace _score_model_unitary_simd_adaptive
+{
+
+// ----------------------------------------------------------------------------
+// traits
+// ----------------------------------------------------------------------------
+
+/* The pairs are computed with saturated 8 bit scores first. A local score never drops below zero, such that only
+ * the gap scores can reach the lower bound, which never yields a positive cell. A clamped cell at the upper bound
+ * is recorded by the tracker, such that every pair whose score reaches the saturation score is computed again with
+ * saturated 16 bit scores and eventually with 32 bit scores. If the substitution or gap scores do not fit into the
+ * 8 bit or 16 bit scores, the pairs are computed with the first precision that can represent them.
+ */
+template <typename score_t>
+struct traits
+{
+    static constexpr cfg::detail::rule_category category = cfg::detail::rule_category::score_model;
+
+    score_t _match_score;
+    score_t _mismatch_score;
+
+    // The score type of the narrowest precision, which computes all pairs.
+    using score_type = simd_score_saturated<int8_t>;
+
+    template <typename level_score_t>
+    using score_model_type = seqan::pairwise_aligner::score_model_unitary_simd_local<level_score_t>;
+
+    template <typename configuration_t, typename level_score_t = score_type>
+    constexpr auto configure_substitution_policy([[maybe_unused]] configuration_t const & configuration) const noexcept
+    {
+        return score_model_type<level_score_t>{static_cast<level_score_t>(_match_score),
+                                               static_cast<level_score_t>(_mismatch_score)};
+    }
+
+    template <typename configuration_t, typename level_score_t = score_type>
+    constexpr auto configure_result_factory_policy([[maybe_unused]] configuration_t const & configuration)
+        const noexcept
+    {
+        return tracker::local_simd_fixed::factory<level_score_t>{};
+    }
+
+    template <typename configuration_t, typename level_score_t = score_type>
+    constexpr auto configure_dp_vector_policy([[maybe_unused]] configuration_t const & configuration) const noexcept
+    {
+        using value_t = typename level_score_t::value_type;
+        using column_cell_t = typename configuration_t::dp_cell_column_type<level_score_t>;
+        using row_cell_t = typename configuration_t::dp_cell_row_type<level_score_t>;
+
+        constexpr value_t padding_symbol_column = std::numeric_limits<value_t>::lowest();
+        constexpr value_t padding_symbol_row = padding_symbol_column + 1;
+
+        return dp_vector_policy{
+            dp_vector_bulk_factory(dp_vector_chunk_factory(dp_vector_single<column_cell_t>{}),
+                                   level_score_t{padding_symbol_column}),
+            dp_vector_bulk_factory(dp_vector_chunk_factory(dp_vector_single<row_cell_t>{}),
+                                   level_score_t{padding_symbol_row})
+        };
+    }
+
+    template <typename configuration_t, typename ...policies_t>
+    constexpr auto configure_algorithm(configuration_t const & configuration, policies_t && ...policies) const
+    {
+        static_assert(configuration_t::is_local,
+                      "The adaptive score model is only supported for local alignments!");
+        static_assert(configuration_t::output_configuration_index == -1,
+                      "The adaptive score model can not be combined with an output configuration!");
+        static_assert(configuration_t::execution_configuration_index == -1,
+                      "The adaptive score model can not be combined with an execution configuration!");
+        static_assert(configuration_t::threshold_configuration_index == -1,
+                      "The adaptive score model can not be combined with a score threshold!");
+
+        using wide_score_t = simd_score_saturated<int16_t>;
+        using widest_score_t = simd_score<int32_t>;
+
+        size_t const first_level = fits_scores<int8_t>(configuration) ? 0 :
+                                   fits_scores<int16_t>(configuration) ? 1 : 2;
+
+        return interface_many_to_many_adaptive<int32_t,
+                                               decltype(make_interface<configuration_t, score_type>(policies...)),
+                                               decltype(configure_level<wide_score_t>(configuration)),
+                                               decltype(configure_level<widest_score_t>(configuration))>{
+                first_level,
+                {std::numeric_limits<int8_t>::max(),
+                 std::numeric_limits<int16_t>::max(),
+                 std::numeric_limits<int32_t>::max()},
+                make_interface<configuration_t, score_type>(std::move(policies)...),
+                configure_level<wide_score_t>(configuration),
+                configure_level<widest_score_t>(configuration)};
+    }
+
+private:
+
+    // Whether the substitution scores and the gap scores, including the score to open a gap, fit into value_t.
+    template <typename value_t, typename configuration_t>
+    bool fits_scores(configuration_t const & configuration) const noexcept
+    {
+        auto fits = [] (int64_t const score) {
+            return score >= std::numeric_limits<value_t>::lowest() && score <= std::numeric_limits<value_t>::max();
+        };
+        auto fits_gap = [&] (int64_t const gap_open_score, int64_t const gap_extension_score) {
+            return fits(gap_open_score) && fits(gap_extension_score) && fits(gap_open_score + gap_extension_score);
+        };
+
+        auto const gap_model = configuration.configure_gap_policy();
+        bool fits_long_gap = true;
+        if constexpr (requires { gap_model.long_gap_open_score; })
+            fits_long_gap = fits_gap(gap_model.long_gap_open_score, gap_model.long_gap_extension_score);
+
+        return fits(_match_score) && fits(_mismatch_score) &&
+               fits_gap(gap_model.gap_open_score, gap_model.gap_extension_score) && fits_long_gap;
+    }
+
+    // Configures the policies depending on the score type for the given precision.
+    template <typename level_score_t, typename configuration_t>
+    auto configure_level(configuration_t const & configuration) const
+    {
+        return make_interface<configuration_t, level_score_t>(
+                configure_dp_vector_policy<configuration_t, level_score_t>(configuration),
+                configuration.leading_gap_setting(),
+                configuration.trailing_gap_setting(),
+                configuration.band_setting(),
+                configure_result_factory_policy<configuration_t, level_score_t>(configuration),
+                configuration.configure_gap_policy(),
+                configure_substitution_policy<configuration_t, level_score_t>(configuration));
+    }
+
+    template <typename configuration_t, typename level_score_t, typename ...policies_t>
+    static auto make_interface(policies_t && ...policies)
+    {
+        using dp_matrix_policy_t =
+            dp_matrix_policies<decltype(dp_matrix::matrix_local(dp_matrix::column(dp_matrix::block(dp_matrix::lane))))>;
+        using algorithm_t = typename configuration_t::algorithm_type<dp_algorithm_template_standard,
+                                                                     dp_matrix_policy_t,
+                                                                     std::remove_cvref_t<policies_t>...>;
+
+        return interface_many_to_many_batch<algorithm_t, level_score_t::size_v>{
+                algorithm_t{dp_matrix_policy_t{dp_matrix::matrix_local(dp_matrix::column(dp_matrix::block(
+                                dp_matrix::lane)))},
+                            std::forward<policies_t>(policies)...}};
+    }
+};
+
+// ----------------------------------------------------------------------------
+// configurator
+// ----------------------------------------------------------------------------
+
+template <typename next_configurator_t, typename traits_t>
+struct _configurator
+{
+    struct type;
+};
+
+template <typename next_configurator_t, typename traits_t>
+using configurator_t = typename _configurator<next_configurator_t, traits_t>::type;
+
+template <typename next_configurator_t, typename traits_t>
+struct _configurator<next_configurator_t, traits_t>::type
+{
+    next_configurator_t _next_configurator;
+    traits_t _traits;
+
+    template <typename ...values_t>
+    void set_config(values_t && ... values) noexcept
+    {
+        std::forward<next_configurator_t>(_next_configurator).set_config(std::forward<values_t>(values)..., _traits);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// rule
+// ----------------------------------------------------------------------------
+
+template <typename predecessor_t, typename traits_t>
+struct _rule
+{
+    struct type;
+};
+
+template <typename predecessor_t, typename traits_t>
+using rule = typename _rule<predecessor_t, traits_t>::type;
+
+template <typename predecessor_t, typename traits_t>
+struct _rule<predecessor_t, traits_t>::type : cfg::score_model::rule<predecessor_t>
+{
+    predecessor_t _predecessor;
+    traits_t _traits;
+
+    using traits_type = type_list<traits_t>;
+
+    template <template <typename ...> typename type_list_t>
+    using configurator_types = typename concat_type_lists_t<configurator_types_t<std::remove_cvref_t<predecessor_t>,
+                                                                                 type_list>,
+                                                            traits_type>::template apply<type_list_t>;
+
+    template <typename next_configurator_t>
+    auto apply(next_configurator_t && next_configurator) const
+    {
+        return _predecessor.apply(configurator_t<next_configurator_t, traits_t>{
+                    std::forward<next_configurator_t>(next_configurator),
+                    _traits
+                });
+    }
+};
+
+// ----------------------------------------------------------------------------
+// CPO
+// ----------------------------------------------------------------------------
+
+namespace _cpo
+{
+struct _fn
+{
+    template <typename predecessor_t, typename score_t>
+    constexpr auto operator()(predecessor_t && predecessor,
+                              score_t const match_score,
+                              score_t const mismatch_score) const
+    {
+        using traits_t = traits<score_t>;
+        return _score_model_unitary_simd_adaptive::
+            rule<predecessor_t, traits_t>{{},
+                                          std::forward<predecessor_t>(predecessor),
+                                          traits_t{match_score, mismatch_score}};
+    }
+
+    template <typename score_t>
+    constexpr auto operator()(score_t const match_score, score_t const mismatch_score) const
+    {
+        return this->operator()(cfg::initial, match_score, mismatch_score);
+    }
+};
+} // namespace _cpo
+} // namespace _score_model_unitary_simd_adaptive
+
+/*!\brief Configures the unitary simd score model, which computes local alignments with the narrowest score type
+ *        whose range suffices for the respective pair.
+ */
+inline constexpr _score_model_unitary_simd_adaptive::_cpo::_fn score_model_unitary_simd_adaptive{};
+
+} // namespace cfg
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -0,0 +1,215 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::cfg::score_model_unitary_simd_difference.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <pairwise_aligner/configuration/initial.hpp>
+#include <pairwise_aligner/configuration/rule_score_model.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_difference.hpp>
+#include <pairwise_aligner/interface/interface_many_to_many_batch.hpp>
+#include <pairwise_aligner/matrix/dp_matrix_block.hpp>
+#include <pairwise_aligner/matrix/dp_matrix_column.hpp>
+#include <pairwise_aligner/matrix/dp_matrix_lane.hpp>
+#include <pairwise_aligner/matrix/dp_matrix.hpp>
+#include <pairwise_aligner/matrix/dp_vector_bulk.hpp>
+#include <pairwise_aligner/matrix/dp_vector_chunk.hpp>
+#include <pairwise_aligner/matrix/dp_vector_policy.hpp>
+#include <pairwise_aligner/matrix/dp_vector_single.hpp>
+#include <pairwise_aligner/score_model/score_model_unitary_simd.hpp>
+#include <pairwise_aligner/simd/simd_score_type.hpp>
+#include <pairwise_aligner/tracker/tracker_global_simd_fixed.hpp>
+#include <pairwise_aligner/type_traits.hpp>
+#include <pairwise_aligner/utility/type_list.hpp>
+
+namespace seqan::pairwise_aligner {
+inline namespace v1
+{
+namespace cfg
+{
+namespace _score_model_unitary_simd_difference
+{
+
+// ----------------------------------------------------------------------------
+// traits
+// ----------------------------------------------------------------------------
+
+/* The differences are computed with 8 bit scores, such that a bulk holds as many pairs as a simd vector of 8 bit
+ * scores. The scores of the pairs are reported as 32 bit scores, which are also used if the algorithm falls back to
+ * the standard algorithm template.
+ */
+template <typename score_t>
+struct traits
+{
+    static constexpr cfg::detail::rule_category category = cfg::detail::rule_category::score_model;
+
+    score_t _match_score;
+    score_t _mismatch_score;
+
+    using symbol_type = simd_score<int8_t>;
+    using score_type = simd_score<int32_t, symbol_type::size_v>;
+    using score_model_type = seqan::pairwise_aligner::score_model_unitary_simd<score_type>;
+
+    template <typename configuration_t>
+    constexpr auto configure_substitution_policy([[maybe_unused]] configuration_t const & configuration) const noexcept
+    {
+        return score_model_type{static_cast<score_type>(_match_score), static_cast<score_type>(_mismatch_score)};
+    }
+
+    template <typename configuration_t>
+    constexpr auto configure_result_factory_policy([[maybe_unused]] configuration_t const & configuration)
+        const noexcept
+    {
+        return tracker::global_simd_fixed::factory<score_type>{static_cast<score_type>(_match_score),
+                                                               configuration.trailing_gap_setting()};
+    }
+
+    template <typename configuration_t>
+    constexpr auto configure_dp_vector_policy([[maybe_unused]] configuration_t const & configuration) const noexcept
+    {
+        using column_cell_t = typename configuration_t::dp_cell_column_type<score_type>;
+        using row_cell_t = typename configuration_t::dp_cell_row_type<score_type>;
+
+        // The score type spans several simd vectors, such that the sequences are transposed into the 8 bit symbol
+        // type, which covers all lanes with a single simd vector.
+        constexpr symbol_type padding_symbol{std::numeric_limits<int8_t>::lowest()};
+
+        return dp_vector_policy{
+            dp_vector_bulk_factory(dp_vector_chunk_factory(dp_vector_single<column_cell_t>{}), padding_symbol),
+            dp_vector_bulk_factory(dp_vector_chunk_factory(dp_vector_single<row_cell_t>{},
+                                                           configuration_t::column_block_size),
+                                   padding_symbol)
+        };
+    }
+
+    template <typename configuration_t, typename ...policies_t>
+    constexpr auto configure_algorithm(configuration_t const &, policies_t && ...policies) const noexcept
+    {
+        static_assert(!configuration_t::is_local,
+                      "The difference score model is only supported for global alignments!");
+
+        using dp_matrix_policy_t =
+            dp_matrix_policies<decltype(dp_matrix::matrix(dp_matrix::column(dp_matrix::block(dp_matrix::lane))))>;
+        using algorithm_t = typename configuration_t::algorithm_type<dp_algorithm_template_difference,
+                                                                     dp_matrix_policy_t,
+                                                                     std::remove_cvref_t<policies_t>...>;
+
+        return interface_many_to_many_batch<algorithm_t, score_type::size_v>{
+                algorithm_t{dp_matrix_policy_t{dp_matrix::matrix(dp_matrix::column(dp_matrix::block(
+                                dp_matrix::lane)))},
+                            std::move(policies)...}};
+    }
+};
+
+// ----------------------------------------------------------------------------
+// configurator
+// ----------------------------------------------------------------------------
+
+template <typename next_configurator_t, typename traits_t>
+struct _configurator
+{
+    struct type;
+};
+
+template <typename next_configurator_t, typename traits_t>
+using configurator_t = typename _configurator<next_configurator_t, traits_t>::type;
+
+template <typename next_configurator_t, typename traits_t>
+struct _configurator<next_configurator_t, traits_t>::type
+{
+    next_configurator_t _next_configurator;
+    traits_t _traits;
+
+    template <typename ...values_t>
+    void set_config(values_t && ... values) noexcept
+    {
+        std::forward<next_configurator_t>(_next_configurator).set_config(std::forward<values_t>(values)..., _traits);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// rule
+// ----------------------------------------------------------------------------
+
+template <typename predecessor_t, typename traits_t>
+struct _rule
+{
+    struct type;
+};
+
+template <typename predecessor_t, typename traits_t>
+using rule = typename _rule<predecessor_t, traits_t>::type;
+
+template <typename predecessor_t, typename traits_t>
+struct _rule<predecessor_t, traits_t>::type : cfg::score_model::rule<predecessor_t>
+{
+    predecessor_t _predecessor;
+    traits_t _traits;
+
+    using traits_type = type_list<traits_t>;
+
+    template <template <typename ...> typename type_list_t>
+    using configurator_types = typename concat_type_lists_t<configurator_types_t<std::remove_cvref_t<predecessor_t>,
+                                                                                 type_list>,
+                                                            traits_type>::template apply<type_list_t>;
+
+    template <typename next_configurator_t>
+    auto apply(next_configurator_t && next_configurator) const
+    {
+        return _predecessor.apply(configurator_t<next_configurator_t, traits_t>{
+                    std::forward<next_configurator_t>(next_configurator),
+                    _traits
+                });
+    }
+};
+
+// ----------------------------------------------------------------------------
+// CPO
+// ----------------------------------------------------------------------------
+
+namespace _cpo
+{
+struct _fn
+{
+    template <typename predecessor_t, typename score_t>
+    constexpr auto operator()(predecessor_t && predecessor,
+                              score_t const match_score,
+                              score_t const mismatch_score) const
+    {
+        using traits_t = traits<score_t>;
+        return _score_model_unitary_simd_difference::
+            rule<predecessor_t, traits_t>{{},
+                                          std::forward<predecessor_t>(predecessor),
+                                          traits_t{match_score, mismatch_score}};
+    }
+
+    template <typename score_t>
+    constexpr auto operator()(score_t const match_score, score_t const mismatch_score) const
+    {
+        return this->operator()(cfg::initial, match_score, mismatch_score);
+    }
+};
+} // namespace _cpo
+} // namespace _score_model_unitary_simd_difference
+
+/*!\brief Configures the unitary simd score model, which computes the scores of global alignments with the
+ *        difference recurrence on 8 bit scores.
+ */
+inline constexpr _score_model_unitary_simd_difference::_cpo::_fn score_model_unitary_simd_difference{};
+
+} // namespace cfg
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -13,6 +13,9 @@
 #pragma once
 
 #include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
 
 #include <pairwise_aligner/configuration/score_model_unitary_simd.hpp>
 #include <pairwise_aligner/configuration/saturated_block_handler.hpp>
@@ -43,8 +46,9 @@ namespace _score_model_unitary_simd_saturated
 // traits
 // ----------------------------------------------------------------------------
 
-
-template <typename score_t>
+// The scores are computed with `saturated_scalar_t`, which is either int8_t or int16_t. The latter halves the number
+// of lanes, but allows much larger blocks for scoring schemes with large scores.
+template <typename score_t, typename saturated_scalar_t>
 struct traits
 {
     static constexpr cfg::detail::rule_category category = cfg::detail::rule_category::score_model;
@@ -53,19 +57,30 @@ struct traits
     score_t _mismatch_score;
 
     // Offer the score type here.
-    using score_type = simd_score<int8_t>;
+    using score_type = simd_score<saturated_scalar_t>;
 
     template <bool is_local>
-    using score_type_sat_t = std::conditional_t<is_local, simd_score_saturated<int8_t>, simd_score<int8_t>>;
+    using score_type_sat_t = std::conditional_t<is_local,
+                                                simd_score_saturated<saturated_scalar_t>,
+                                                simd_score<saturated_scalar_t>>;
+
+    // The regular scores must be wider than the saturated ones, since the local zero offset is negated.
+    using regular_scalar_t = std::conditional_t<(sizeof(score_t) > sizeof(saturated_scalar_t)), score_t, int32_t>;
 
     template <bool is_local>
     using original_score_t = std::conditional_t<is_local,
-                                                simd_score_saturated<score_t, score_type::size_v>,
-                                                simd_score<score_t, score_type::size_v>>;
+                                                simd_score_saturated<regular_scalar_t, score_type::size_v>,
+                                                simd_score<regular_scalar_t, score_type::size_v>>;
 
     // result_factory configurator
     // using result_factory_type = tracker::global_simd_saturated::factory<original_score_type>;
-    using block_handler_t = detail::saturated_block_handler;
+    using block_handler_t = detail::saturated_block_handler<saturated_scalar_t>;
+
+    // The best score of a single aligned pair, which bounds the score the remaining cells of a pair can add.
+    constexpr int32_t max_substitution_score() const noexcept
+    {
+        return static_cast<int32_t>(_match_score);
+    }
 
     template <typename configuration_t>
     constexpr auto configure_substitution_policy([[maybe_unused]] configuration_t const & configuration) const noexcept
@@ -93,8 +108,7 @@ struct traits
             auto [global_zero, max_block_size] =
             block_handler_t::compute_max_block_size(_match_score,
                                                     _mismatch_score,
-                                                    configuration._gap_open_score,
-                                                    configuration._gap_extension_score);
+                                                    configuration);
 
             return tracker::global_simd_saturated::factory<_original_score_type>{
                 static_cast<_original_score_type>(_match_score),
@@ -114,7 +128,7 @@ struct traits
         using column_cell_t = typename configuration_t::dp_cell_column_type<_score_type>;
         using original_column_cell_t = typename configuration_t::dp_cell_column_type<_original_score_type>;
 
-        constexpr _score_type padding_symbol_column{static_cast<int8_t>(1ull << 7)};
+        constexpr _score_type padding_symbol_column{std::numeric_limits<saturated_scalar_t>::lowest()};
         constexpr _score_type padding_symbol_row{padding_symbol_column + configuration_t::is_local};
 
         auto column_vector =
@@ -129,8 +143,12 @@ struct traits
     }
 
     template <typename configuration_t, typename ...policies_t>
-    constexpr auto configure_algorithm(configuration_t const &, policies_t && ...policies) const noexcept
+    constexpr auto configure_algorithm(configuration_t const & configuration, policies_t && ...policies) const noexcept
     {
+        // The global tracker locates the best cell of the last row and column with 8 bit positions per chunk.
+        static_assert(std::same_as<saturated_scalar_t, int8_t> || configuration_t::is_local,
+                      "The 16 bit saturated score model is only supported for local alignments!");
+
         auto make_dp_matrix_policy = [&] () constexpr {
             if constexpr (configuration_t::is_local)
                 return dp_matrix::matrix(dp_matrix::column_saturated_local(dp_matrix::block(dp_matrix::lane)));
@@ -146,10 +164,17 @@ struct traits
                                                                      lane_width_policy<>,
                                                                      std::remove_cvref_t<policies_t>...>;
 
-        return interface_one_to_one_bulk<algorithm_t, score_type::size_v>{
-                algorithm_t{dp_matrix_policy_t{make_dp_matrix_policy()},
-                                               lane_width_policy<>{},
-                                               std::move(policies)...}};
+        // The saturated local dp vector tracks its offset per bulk, so its lanes cannot be refilled.
+        if constexpr (configuration_t::is_local)
+            return interface_many_to_many_batch<algorithm_t, score_type::size_v>{
+                    algorithm_t{dp_matrix_policy_t{make_dp_matrix_policy()},
+                                                   lane_width_policy<>{},
+                                                   std::move(policies)...}};
+        else
+            return configuration.template bulk_interface<score_type::size_v>(
+                    algorithm_t{dp_matrix_policy_t{make_dp_matrix_policy()},
+                                                   lane_width_policy<>{},
+                                                   std::move(policies)...});
     }
 
 private:
@@ -159,7 +184,7 @@ private:
     {
         static_assert(configuration_t::is_local);
 
-        return std::numeric_limits<int8_t>::lowest();
+        return std::numeric_limits<saturated_scalar_t>::lowest();
         //  - configuration._gap_open_score -
         //             (2 * configuration._gap_extension_score);
     }
@@ -170,13 +195,14 @@ private:
         auto [global_zero, max_block_size] =
             block_handler_t::compute_max_block_size(_match_score,
                                                     _mismatch_score,
-                                                    configuration._gap_open_score,
-                                                    configuration._gap_extension_score);
+                                                    configuration);
 
         auto saturated_dp_vector = [&] () {
             if constexpr (configuration_t::is_local) {
-                int8_t local_zero = lowest_viable_local_score(configuration);
-                int8_t threshold = std::numeric_limits<int8_t>::max() - (max_block_size * _match_score);
+                saturated_scalar_t local_zero = lowest_viable_local_score(configuration);
+                // A block keeps the scores relative to the local zero, as long as its offset cell lies below the
+                // global zero offset. Then all scores of the block fit into the saturated range.
+                saturated_scalar_t threshold = global_zero;
                 return dp_vector_saturated_local_factory<regular_cell_t>(dp_vector_single<saturated_cell_t>{},
                                                                          local_zero,
                                                                          global_zero,
@@ -258,6 +284,7 @@ struct _rule<predecessor_t, traits_t>::type : cfg::score_model::rule<predecessor
 
 namespace _cpo
 {
+template <typename saturated_scalar_t>
 struct _fn
 {
     template <typename predecessor_t, typename score_t>
@@ -265,7 +292,7 @@ struct _fn
                               score_t const match_score,
                               score_t const mismatch_score) const
     {
-        using traits_t = traits<score_t>;
+        using traits_t = traits<score_t, saturated_scalar_t>;
         return _score_model_unitary_simd_saturated::
             rule<predecessor_t, traits_t>{{},
                                           std::forward<predecessor_t>(predecessor),
@@ -281,7 +308,20 @@ struct _fn
 } // namespace _cpo
 } // namespace _score_model_unitary_simd_saturated
 
-inline constexpr _score_model_unitary_simd_saturated::_cpo::_fn score_model_unitary_simd_saturated{};
+inline constexpr _score_model_unitary_simd_saturated::_cpo::_fn<int8_t> score_model_unitary_simd_saturated{};
+
+/*!\brief Configures the unitary saturated score model with 16 bit scores.
+ *
+ * \details
+ *
+ * The 16 bit scores allow blocks of hundreds to thousands of rows even for large scores, such that the offsets are
+ * rarely updated. The model is only supported for local alignments. Global alignments are out of scope, since the
+ * global saturated tracker locates the best cell of the last row and column with 8 bit positions per chunk, which
+ * do not cover the larger blocks. A 16 bit variant of the saturated substitution matrix models
+ * (score_model_matrix_simd_saturated_1xN and score_model_matrix_simd_saturated_NxN) is out of scope as well, since
+ * their profiles store 8 bit scores, which are looked up by 8 bit symbol ranks.
+ */
+inline constexpr _score_model_unitary_simd_saturated::_cpo::_fn<int16_t> score_model_unitary_simd_saturated_int16{};
 
 } // namespace cfg
 } // inline namespace v1
@@ -0,0 +1,203 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::cfg::score_model_wavefront.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include <pairwise_aligner/configuration/initial.hpp>
+#include <pairwise_aligner/configuration/rule_score_model.hpp>
+#include <pairwise_aligner/interface/interface_one_to_one_single.hpp>
+#include <pairwise_aligner/matrix/dp_vector_policy.hpp>
+#include <pairwise_aligner/matrix/dp_vector_single.hpp>
+#include <pairwise_aligner/score_model/score_model_unitary.hpp>
+#include <pairwise_aligner/tracker/tracker_global_scalar.hpp>
+#include <pairwise_aligner/type_traits.hpp>
+#include <pairwise_aligner/utility/type_list.hpp>
+#include <pairwise_aligner/wavefront/wavefront_algorithm.hpp>
+
+namespace seqan::pairwise_aligner {
+inline namespace v1
+{
+namespace cfg
+{
+namespace _score_model_wavefront
+{
+
+// ----------------------------------------------------------------------------
+// traits
+// ----------------------------------------------------------------------------
+
+struct traits
+{
+    static constexpr cfg::detail::rule_category category = cfg::detail::rule_category::score_model;
+
+    using score_type = int32_t;
+
+    score_type _match_score{};
+    score_type _mismatch_score{};
+
+    template <typename configuration_t>
+    constexpr auto configure_substitution_policy([[maybe_unused]] configuration_t const & configuration) const noexcept
+    {
+        return score_model_unitary<score_type>{_match_score, _mismatch_score};
+    }
+
+    template <typename configuration_t>
+    constexpr auto configure_result_factory_policy([[maybe_unused]] configuration_t const & configuration)
+        const noexcept
+    {
+        return tracker::global_scalar::factory{configuration.trailing_gap_setting()};
+    }
+
+    template <typename configuration_t>
+    constexpr auto configure_dp_vector_policy([[maybe_unused]] configuration_t const & configuration) const noexcept
+    {
+        using column_cell_t = typename configuration_t::dp_cell_column_type<score_type>;
+        using row_cell_t = typename configuration_t::dp_cell_row_type<score_type>;
+
+        return dp_vector_policy{dp_vector_single<column_cell_t>{}, dp_vector_single<row_cell_t>{}};
+    }
+
+    template <typename configuration_t, typename ...policies_t>
+    constexpr auto configure_algorithm(configuration_t const &, policies_t && ...policies) const noexcept
+    {
+        check_configuration<configuration_t>();
+
+        using algorithm_t = wavefront_algorithm<1, std::remove_cvref_t<policies_t>...>;
+        return interface_one_to_one_single<algorithm_t>{algorithm_t{std::move(policies)...}};
+    }
+
+    template <typename configuration_t>
+    static constexpr void check_configuration() noexcept
+    {
+        using gap_model_t = typename configuration_t::gap_configuration_t::gap_model_type;
+
+        static_assert(!configuration_t::is_local, "The wavefront alignment is not supported for local alignments!");
+        static_assert(configuration_t::output_configuration_index == -1,
+                      "The wavefront alignment does not support an output configuration!");
+        static_assert(configuration_t::band_configuration_index == -1,
+                      "The wavefront alignment does not support a band!");
+        static_assert(configuration_t::execution_configuration_index == -1,
+                      "The wavefront alignment can not be combined with an execution configuration!");
+        static_assert(!requires (gap_model_t gap_model) { gap_model.long_gap_open_score; },
+                      "The wavefront alignment does not support the dual affine gap model!");
+    }
+};
+
+// ----------------------------------------------------------------------------
+// configurator
+// ----------------------------------------------------------------------------
+
+template <typename next_configurator_t, typename traits_t>
+struct _configurator
+{
+    struct type;
+};
+
+template <typename next_configurator_t, typename traits_t>
+using configurator_t = typename _configurator<next_configurator_t, traits_t>::type;
+
+template <typename next_configurator_t, typename traits_t>
+struct _configurator<next_configurator_t, traits_t>::type
+{
+    next_configurator_t _next_configurator;
+    traits_t _traits;
+
+    template <typename ...values_t>
+    void set_config(values_t && ... values) noexcept
+    {
+        std::forward<next_configurator_t>(_next_configurator).set_config(std::forward<values_t>(values)..., _traits);
+    }
+};
+
+// ----------------------------------------------------------------------------
+// rule
+// ----------------------------------------------------------------------------
+
+template <typename predecessor_t, typename traits_t>
+struct _rule
+{
+    struct type;
+};
+
+template <typename predecessor_t, typename traits_t>
+using rule = typename _rule<predecessor_t, traits_t>::type;
+
+template <typename predecessor_t, typename traits_t>
+struct _rule<predecessor_t, traits_t>::type : cfg::score_model::rule<predecessor_t>
+{
+    predecessor_t _predecessor;
+    traits_t _traits;
+
+    using traits_type = type_list<traits_t>;
+
+    template <template <typename ...> typename type_list_t>
+    using configurator_types = typename concat_type_lists_t<configurator_types_t<std::remove_cvref_t<predecessor_t>,
+                                                                                 type_list>,
+                                                            traits_type>::template apply<type_list_t>;
+
+    template <typename next_configurator_t>
+    auto apply(next_configurator_t && next_configurator) const
+    {
+        return _predecessor.apply(configurator_t<next_configurator_t, traits_t>{
+                    std::forward<next_configurator_t>(next_configurator),
+                    _traits
+                });
+    }
+};
+
+// ----------------------------------------------------------------------------
+// CPO
+// ----------------------------------------------------------------------------
+
+namespace _cpo
+{
+struct _fn
+{
+    template <typename predecessor_t, std::integral score_t>
+    constexpr auto operator()(predecessor_t && predecessor,
+                              score_t const match_score,
+                              score_t const mismatch_score) const
+    {
+        return _score_model_wavefront::rule<predecessor_t, traits>{{},
+                                                                   std::forward<predecessor_t>(predecessor),
+                                                                   traits{static_cast<int32_t>(match_score),
+                                                                          static_cast<int32_t>(mismatch_score)}};
+    }
+
+    template <std::integral score_t>
+    constexpr auto operator()(score_t const match_score, score_t const mismatch_score) const
+    {
+        return this->operator()(cfg::initial, match_score, mismatch_score);
+    }
+};
+} // namespace _cpo
+} // namespace _score_model_wavefront
+
+/*!\brief Configures the unitary score model computed with the wavefront algorithm for a single pair.
+ *
+ * Computes the same score as seqan::pairwise_aligner::cfg::score_model_unitary with the affine or the linear gap
+ * model, but with a cost that grows with the number of differences instead of the size of the dp matrix. Hence, it
+ * pays off for pairs of high identity. The match score must be greater than the mismatch score and than twice the
+ * gap extension score and the gap open score must not be positive, otherwise the computation throws
+ * std::invalid_argument. The same holds for free end gaps. Local alignments, a band and the output
+ * configurations are not supported.
+ */
+inline constexpr _score_model_wavefront::_cpo::_fn score_model_wavefront{};
+
+} // namespace cfg
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -0,0 +1,90 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::cfg::score_model_wavefront_simd.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include <pairwise_aligner/configuration/initial.hpp>
+#include <pairwise_aligner/configuration/score_model_wavefront.hpp>
+#include <pairwise_aligner/interface/interface_many_to_many_batch.hpp>
+#include <pairwise_aligner/simd/simd_score_type.hpp>
+#include <pairwise_aligner/wavefront/wavefront_algorithm.hpp>
+
+namespace seqan::pairwise_aligner {
+inline namespace v1
+{
+namespace cfg
+{
+namespace _score_model_wavefront_simd
+{
+
+// ----------------------------------------------------------------------------
+// traits
+// ----------------------------------------------------------------------------
+
+// Same as the traits of the scalar wavefront score model, but computes a bulk with one pair per simd lane.
+struct traits : _score_model_wavefront::traits
+{
+    template <typename configuration_t, typename ...policies_t>
+    constexpr auto configure_algorithm(configuration_t const &, policies_t && ...policies) const noexcept
+    {
+        check_configuration<configuration_t>();
+
+        using algorithm_t = wavefront_algorithm<simd_score<int32_t>::size_v, std::remove_cvref_t<policies_t>...>;
+        return interface_many_to_many_batch<algorithm_t, algorithm_t::lane_count>{
+                algorithm_t{std::move(policies)...}};
+    }
+};
+
+// ----------------------------------------------------------------------------
+// CPO
+// ----------------------------------------------------------------------------
+
+namespace _cpo
+{
+struct _fn
+{
+    template <typename predecessor_t, std::integral score_t>
+    constexpr auto operator()(predecessor_t && predecessor,
+                              score_t const match_score,
+                              score_t const mismatch_score) const
+    {
+        return _score_model_wavefront::rule<predecessor_t, traits>{{},
+                                                                   std::forward<predecessor_t>(predecessor),
+                                                                   traits{{static_cast<int32_t>(match_score),
+                                                                           static_cast<int32_t>(mismatch_score)}}};
+    }
+
+    template <std::integral score_t>
+    constexpr auto operator()(score_t const match_score, score_t const mismatch_score) const
+    {
+        return this->operator()(cfg::initial, match_score, mismatch_score);
+    }
+};
+} // namespace _cpo
+} // namespace _score_model_wavefront_simd
+
+/*!\brief Configures the unitary score model computed with the wavefront algorithm for many pairs at once.
+ *
+ * Same as seqan::pairwise_aligner::cfg::score_model_wavefront, but the offsets of the wavefronts of one bulk of
+ * pairs are stored in the lanes of a simd vector and computed together. Only the extension along the matching
+ * symbols is done per pair.
+ */
+inline constexpr _score_model_wavefront_simd::_cpo::_fn score_model_wavefront_simd{};
+
+} // namespace cfg
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -0,0 +1,53 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::cfg::score_threshold_policy.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace seqan::pairwise_aligner {
+inline namespace v1 {
+namespace cfg {
+
+/*!\brief The minimal score of the pairs the caller is interested in.
+ *
+ * An alignment ending in one of the remaining columns consists of a prefix ending in an already computed cell, whose
+ * score is at most the best score so far, and of at most one aligned pair per remaining column, since the gaps never
+ * increase the score. A pair whose best score so far plus the maximal substitution score per remaining aligned pair
+ * stays below the threshold can not reach it anymore.
+ */
+struct score_threshold_policy
+{
+    //!\brief The number of columns computed between two checks of the threshold by the fixed simd score models.
+    static constexpr size_t column_block_size = 64;
+
+    int32_t threshold{};
+    int32_t max_substitution_score{};
+
+    template <typename score_t>
+    constexpr bool is_unreachable(score_t const best_score, std::ptrdiff_t const remaining_pair_count) const noexcept
+    {
+        int64_t const upper_bound = std::max<int64_t>(best_score, 0) +
+                                    int64_t{max_substitution_score} * remaining_pair_count;
+        return upper_bound < threshold;
+    }
+};
+
+//!\brief Returned as score threshold setting by the algorithms without a configured score threshold.
+struct no_score_threshold
+{};
+
+} // namespace cfg
+} // inline namespace v1
+} // namespace seqan::pairwise_aligner
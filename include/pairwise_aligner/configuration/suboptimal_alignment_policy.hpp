@@ -0,0 +1,29 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::cfg::suboptimal_alignment_policy.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace seqan::pairwise_aligner {
+inline namespace v1 {
+namespace cfg {
+
+//!\brief The maximal number of non-overlapping local alignments reported for every pair.
+struct suboptimal_alignment_policy
+{
+    size_t alignment_count{};
+};
+
+} // namespace cfg
+} // inline namespace v1
+} // namespace seqan::pairwise_aligner
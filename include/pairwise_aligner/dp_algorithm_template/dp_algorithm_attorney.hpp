@@ -24,6 +24,30 @@ inline namespace v1
 template <typename dp_algorithm_impl_t>
 struct _dp_algorithm_template_base;
 
+template <typename dp_algorithm_impl_t>
+struct _dp_algorithm_template_standard;
+
+template <typename dp_algorithm_impl_t>
+struct _dp_algorithm_template_traceback;
+
+template <typename dp_algorithm_impl_t>
+struct _dp_algorithm_template_hirschberg;
+
+template <typename dp_algorithm_impl_t>
+struct _dp_algorithm_template_banded;
+
+template <typename dp_algorithm_impl_t>
+struct _dp_algorithm_template_anti_diagonal;
+
+template <typename dp_algorithm_impl_t>
+struct _dp_algorithm_template_striped;
+
+template <typename dp_algorithm_impl_t>
+struct _dp_algorithm_template_suboptimal;
+
+template <typename dp_algorithm_impl_t>
+struct _dp_algorithm_template_difference;
+
 // ----------------------------------------------------------------------------
 // Definition of the algorithm attorney managing access to the client.
 // ----------------------------------------------------------------------------
@@ -34,6 +58,14 @@ class dp_algorithm_attorney
 private:
     // Classes that have been granted access (grantees) to the algorithm implementation (client/grantor).
     friend _dp_algorithm_template_base<algorithm_client_t>;
+    friend _dp_algorithm_template_standard<algorithm_client_t>;
+    friend _dp_algorithm_template_traceback<algorithm_client_t>;
+    friend _dp_algorithm_template_hirschberg<algorithm_client_t>;
+    friend _dp_algorithm_template_banded<algorithm_client_t>;
+    friend _dp_algorithm_template_anti_diagonal<algorithm_client_t>;
+    friend _dp_algorithm_template_striped<algorithm_client_t>;
+    friend _dp_algorithm_template_suboptimal<algorithm_client_t>;
+    friend _dp_algorithm_template_difference<algorithm_client_t>;
 
     // Member functions the grantees can access.
     template <typename ...args_t>
@@ -85,6 +117,48 @@ private:
         return client.initialise_row_vector(std::forward<args_t>(args)...);
     }
 
+    template <typename ...args_t>
+    constexpr static auto leading_gap_setting(algorithm_client_t const & client, args_t && ...args)
+        noexcept(noexcept(client.leading_gap_setting(std::forward<args_t>(args)...)))
+    {
+        return client.leading_gap_setting(std::forward<args_t>(args)...);
+    }
+
+    template <typename ...args_t>
+    constexpr static auto trailing_gap_setting(algorithm_client_t const & client, args_t && ...args)
+        noexcept(noexcept(client.trailing_gap_setting(std::forward<args_t>(args)...)))
+    {
+        return client.trailing_gap_setting(std::forward<args_t>(args)...);
+    }
+
+    template <typename ...args_t>
+    constexpr static auto band_setting(algorithm_client_t const & client, args_t && ...args)
+        noexcept(noexcept(client.band_setting(std::forward<args_t>(args)...)))
+    {
+        return client.band_setting(std::forward<args_t>(args)...);
+    }
+
+    template <typename ...args_t>
+    constexpr static auto suboptimal_setting(algorithm_client_t const & client, args_t && ...args)
+        noexcept(noexcept(client.suboptimal_setting(std::forward<args_t>(args)...)))
+    {
+        return client.suboptimal_setting(std::forward<args_t>(args)...);
+    }
+
+    template <typename ...args_t>
+    constexpr static auto score_threshold_setting(algorithm_client_t const & client, args_t && ...args)
+        noexcept(noexcept(client.score_threshold_setting(std::forward<args_t>(args)...)))
+    {
+        return client.score_threshold_setting(std::forward<args_t>(args)...);
+    }
+
+    template <typename ...args_t>
+    constexpr static auto gap_setting(algorithm_client_t const & client, args_t && ...args)
+        noexcept(noexcept(client.gap_setting(std::forward<args_t>(args)...)))
+    {
+        return client.gap_setting(std::forward<args_t>(args)...);
+    }
+
     template <typename ...args_t>
     constexpr static auto lane_width(algorithm_client_t const & client, args_t && ...args)
         noexcept(noexcept(client.lane_width(std::forward<args_t>(args)...)))
@@ -0,0 +1,277 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::dp_algorithm_template_anti_diagonal.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <pairwise_aligner/affine/affine_gap_model.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_attorney.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_base.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_standard.hpp>
+#include <pairwise_aligner/matrix/dp_matrix_cpo.hpp>
+#include <pairwise_aligner/simd/simd_score_type.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief Computes a single pair with simd vectors along the anti-diagonals of the dp matrix.
+ *
+ * The cells of an anti-diagonal only depend on the two previous anti-diagonals and are therefore computed with
+ * simd vectors of the scalar score type. The first sequence and the reversed second sequence are stored in buffers,
+ * such that the symbols of consecutive cells of an anti-diagonal are consecutive in memory. The substitution model
+ * scores all cells of a vector at once.
+ * The dp column and the dp row hold the same values as after the computation with
+ * seqan::pairwise_aligner::dp_algorithm_template_standard, which is used for pairs shorter than a simd vector, for
+ * score types without a simd vector and for symbols that can not be converted into the score type.
+ */
+template <typename algorithm_impl_t>
+struct _dp_algorithm_template_anti_diagonal
+{
+    class type;
+};
+
+template <typename algorithm_impl_t>
+using dp_algorithm_template_anti_diagonal = typename _dp_algorithm_template_anti_diagonal<algorithm_impl_t>::type;
+
+template <typename algorithm_impl_t>
+class _dp_algorithm_template_anti_diagonal<algorithm_impl_t>::type :
+    public dp_algorithm_template_standard<algorithm_impl_t>
+{
+private:
+    using algorithm_attorney_t = dp_algorithm_attorney<algorithm_impl_t>;
+    using standard_t = dp_algorithm_template_standard<algorithm_impl_t>;
+
+protected:
+
+    using base_t = dp_algorithm_template_base<algorithm_impl_t>;
+
+    template <typename sequence1_t, typename sequence2_t, typename dp_column_t, typename dp_row_t>
+    auto run(sequence1_t && sequence1, sequence2_t && sequence2, dp_column_t dp_column, dp_row_t dp_row) const
+    {
+        using score_t = typename std::remove_cvref_t<decltype(dp_column[0][0])>::score_type;
+
+        if constexpr (!is_vectorisable<score_t, sequence1_t, sequence2_t>()) {
+            return standard_t::run(std::forward<sequence1_t>(sequence1),
+                                   std::forward<sequence2_t>(sequence2),
+                                   std::move(dp_column),
+                                   std::move(dp_row));
+        } else {
+            constexpr std::ptrdiff_t simd_size = simd_score<score_t>::size_v;
+            if (std::ranges::distance(sequence1) < simd_size || std::ranges::distance(sequence2) < simd_size)
+                return standard_t::run(std::forward<sequence1_t>(sequence1),
+                                       std::forward<sequence2_t>(sequence2),
+                                       std::move(dp_column),
+                                       std::move(dp_row));
+
+            // ----------------------------------------------------------------------------
+            // Initialisation
+            // ----------------------------------------------------------------------------
+
+            auto transformed_seq1 = base_t::initialise_column(sequence1, dp_column);
+            auto transformed_seq2 = base_t::initialise_row(sequence2, dp_row);
+
+            auto matrix = base_t::initialise_dp_matrix(dp_column, dp_row, transformed_seq1, transformed_seq2);
+
+            // ----------------------------------------------------------------------------
+            // Recursion
+            // ----------------------------------------------------------------------------
+
+            compute_anti_diagonals(dp_column[0],
+                                   dp_row[0],
+                                   transformed_seq1,
+                                   transformed_seq2,
+                                   dp_matrix::substitution_model(matrix),
+                                   dp_matrix::tracker(matrix));
+
+            // ----------------------------------------------------------------------------
+            // Create result
+            // ----------------------------------------------------------------------------
+
+            return base_t::make_result(std::move(dp_matrix::tracker(matrix)),
+                                       std::forward<sequence1_t>(sequence1),
+                                       std::forward<sequence2_t>(sequence2),
+                                       std::move(dp_column),
+                                       std::move(dp_row));
+        }
+    }
+
+private:
+
+    template <typename score_t, typename sequence1_t, typename sequence2_t>
+    static constexpr bool is_vectorisable() noexcept
+    {
+        using gap_model_t = decltype(algorithm_attorney_t::gap_setting(std::declval<algorithm_impl_t const &>()));
+
+        if constexpr (detail::max_simd_size > 1 && std::signed_integral<score_t> && sizeof(score_t) >= 4)
+            return std::same_as<gap_model_t, affine_gap_model<score_t>> &&
+                   std::convertible_to<std::ranges::range_value_t<sequence1_t>, score_t> &&
+                   std::convertible_to<std::ranges::range_value_t<sequence2_t>, score_t>;
+        else
+            return false;
+    }
+
+    /*!\brief Computes all anti-diagonals and writes the last column and the last row into the dp vectors.
+     *
+     * Every buffer stores one anti-diagonal indexed by the row of the cell, with a padding of one simd vector at both
+     * ends. The horizontal and the vertical gap buffers store the gap scores of the cell to the right respectively
+     * below, like the dp vectors. The cells of the first row and the first column are read from the initialised dp
+     * vectors. The vectors reaching beyond the last cell of an anti-diagonal compute values that are never read.
+     */
+    template <typename dp_column_t,
+              typename dp_row_t,
+              typename sequence1_t,
+              typename sequence2_t,
+              typename scorer_t,
+              typename tracker_t>
+    void compute_anti_diagonals(dp_column_t & dp_column,
+                                dp_row_t & dp_row,
+                                sequence1_t const & sequence1,
+                                sequence2_t const & sequence2,
+                                scorer_t const & scorer,
+                                tracker_t & tracker) const
+    {
+        using score_t = typename std::remove_cvref_t<decltype(dp_column[0])>::score_type;
+        using simd_score_t = simd_score<score_t>;
+        constexpr std::ptrdiff_t simd_size = simd_score_t::size_v;
+
+        auto const [gap_open_score, gap_extension_score] = algorithm_attorney_t::gap_setting(as_algorithm());
+        score_t const gap_open_extension_score = gap_open_score + gap_extension_score;
+        score_t const infinity = std::numeric_limits<score_t>::lowest() / 2;
+
+        std::ptrdiff_t const row_count = std::ranges::distance(sequence1);
+        std::ptrdiff_t const column_count = std::ranges::distance(sequence2);
+
+        // All buffers share one allocation: the symbol buffers are followed by seven anti-diagonal buffers.
+        // The symbol of the cell (i, j) is at position i - 1 in the first and m - j in the reversed second buffer.
+        std::ptrdiff_t const symbols1_size = row_count + simd_size;
+        std::ptrdiff_t const symbols2_size = column_count + simd_size;
+        std::ptrdiff_t const buffer_size = row_count + 1 + 2 * simd_size;
+        std::vector<score_t> buffers(symbols1_size + symbols2_size + 7 * buffer_size, infinity);
+
+        score_t * const symbols1 = buffers.data();
+        score_t * const symbols2 = symbols1 + symbols1_size;
+        std::ranges::fill(symbols1, symbols2 + symbols2_size, score_t{});
+        std::ranges::copy(sequence1 | std::views::transform([] (auto const & symbol) {
+            return static_cast<score_t>(symbol);
+        }), symbols1);
+        std::ranges::copy(sequence2 | std::views::reverse | std::views::transform([] (auto const & symbol) {
+            return static_cast<score_t>(symbol);
+        }), symbols2);
+
+        score_t * best_scores = symbols2 + symbols2_size;
+        score_t * previous_best_scores = best_scores + buffer_size;
+        score_t * diagonal_scores = previous_best_scores + buffer_size;
+        score_t * horizontal_scores = diagonal_scores + buffer_size;
+        score_t * previous_horizontal_scores = horizontal_scores + buffer_size;
+        score_t * vertical_scores = previous_horizontal_scores + buffer_size;
+        score_t * previous_vertical_scores = vertical_scores + buffer_size;
+
+        // The last column and the last row overwrite the initial values of the dp vectors.
+        score_t const first_row_last_score = get<0>(dp_row[column_count]);
+        score_t const first_column_last_score = get<0>(dp_column[row_count]);
+
+        best_scores[simd_size] = get<0>(dp_column[0]);
+        horizontal_scores[simd_size] = get<1>(dp_column[0]);
+        vertical_scores[simd_size] = get<1>(dp_row[0]);
+
+        // The anti-diagonal and the first row of the vector holding the best score of every lane.
+        simd_score_t max_scores{infinity};
+        simd_score_t max_rows{};
+        simd_score_t max_anti_diagonals{};
+        for (std::ptrdiff_t anti_diagonal = 1; anti_diagonal <= row_count + column_count; ++anti_diagonal) {
+            std::swap(diagonal_scores, previous_best_scores);
+            std::swap(previous_best_scores, best_scores);
+            std::swap(previous_horizontal_scores, horizontal_scores);
+            std::swap(previous_vertical_scores, vertical_scores);
+
+            std::ptrdiff_t const first_row = std::max<std::ptrdiff_t>(1, anti_diagonal - column_count);
+            std::ptrdiff_t const last_row = std::min<std::ptrdiff_t>(row_count, anti_diagonal - 1);
+
+            for (std::ptrdiff_t row = first_row; row <= last_row; row += simd_size) {
+                std::ptrdiff_t const position = simd_size + row;
+
+                simd_score_t diagonal, horizontal, vertical, symbol1, symbol2;
+                diagonal.load(diagonal_scores + position - 1);
+                horizontal.load(previous_horizontal_scores + position);
+                vertical.load(previous_vertical_scores + position - 1);
+                symbol1.load(symbols1 + row - 1);
+                symbol2.load(symbols2 + column_count - anti_diagonal + row);
+
+                simd_score_t best = max(max(scorer.score(diagonal, symbol1, symbol2), vertical), horizontal);
+                best.store(best_scores + position);
+
+                simd_score_t const open = best + gap_open_extension_score;
+                max(horizontal + gap_extension_score, open).store(horizontal_scores + position);
+                max(vertical + gap_extension_score, open).store(vertical_scores + position);
+
+                if (row + simd_size <= last_row + 1) {
+                    auto const is_better = max_scores.lt(best);
+                    max_scores = max(max_scores, best);
+                    max_rows = blend(is_better, simd_score_t{static_cast<score_t>(row)}, max_rows);
+                    max_anti_diagonals = blend(is_better, simd_score_t{static_cast<score_t>(anti_diagonal)},
+                                               max_anti_diagonals);
+                } else { // Only the first cells of the last vector are within the anti-diagonal.
+                    for (std::ptrdiff_t cell_row = row; cell_row <= last_row; ++cell_row) {
+                        tracker.move_to(cell_row, anti_diagonal - cell_row);
+                        tracker.track(best_scores[simd_size + cell_row]);
+                    }
+                }
+            }
+
+            if (anti_diagonal <= column_count) { // The cell in the first row.
+                best_scores[simd_size] = get<0>(dp_row[anti_diagonal]);
+                vertical_scores[simd_size] = get<1>(dp_row[anti_diagonal]);
+            }
+
+            if (anti_diagonal <= row_count) { // The cell in the first column.
+                best_scores[simd_size + anti_diagonal] = get<0>(dp_column[anti_diagonal]);
+                horizontal_scores[simd_size + anti_diagonal] = get<1>(dp_column[anti_diagonal]);
+            }
+
+            if (std::ptrdiff_t const row = anti_diagonal - column_count; row > 0) { // The cell in the last column.
+                get<0>(dp_column[row]) = best_scores[simd_size + row];
+                get<1>(dp_column[row]) = horizontal_scores[simd_size + row];
+            }
+
+            if (std::ptrdiff_t const column = anti_diagonal - row_count; column > 0) { // The cell in the last row.
+                get<0>(dp_row[column]) = best_scores[simd_size + row_count];
+                get<1>(dp_row[column]) = vertical_scores[simd_size + row_count];
+            }
+        }
+
+        get<0>(dp_column[0]) = first_row_last_score;
+        get<0>(dp_row[0]) = first_column_last_score;
+
+        for (std::ptrdiff_t lane = 0; lane < simd_size; ++lane) {
+            std::ptrdiff_t const max_row = max_rows[lane] + lane;
+            tracker.move_to(max_row, max_anti_diagonals[lane] - max_row);
+            tracker.track(max_scores[lane]);
+        }
+    }
+
+    constexpr algorithm_impl_t const & as_algorithm() const noexcept
+    {
+        return static_cast<algorithm_impl_t const &>(*this);
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
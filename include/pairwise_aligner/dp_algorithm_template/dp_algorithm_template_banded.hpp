@@ -0,0 +1,346 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::dp_algorithm_template_banded.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <limits>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+
+#include <pairwise_aligner/configuration/band_policy.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_attorney.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_base.hpp>
+#include <pairwise_aligner/matrix/dp_matrix_cpo.hpp>
+#include <pairwise_aligner/simd/concept.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief Computes the dp matrix like seqan::pairwise_aligner::dp_algorithm_template_standard, but only the cells
+ *        within a band.
+ *
+ * Every lane only computes the rows that contain a cell of the band. The cells of these rows that lie outside of the
+ * band as well as the dp vectors of the skipped rows are set to minus infinity, such that no alignment can pass
+ * through a cell outside of the band.
+ * A seqan::pairwise_aligner::cfg::static_band is the same for all pairs of a simd bulk, since all of them start in
+ * the same cell. A seqan::pairwise_aligner::cfg::adaptive_band places the rows of every lane around the best score in
+ * the last column of the previous lane, such that the band follows the alignment even if it drifts away from the main
+ * diagonal. The last lane computes all remaining rows, such that the last cell is always reached.
+ */
+template <typename algorithm_impl_t>
+struct _dp_algorithm_template_banded
+{
+    class type;
+};
+
+template <typename algorithm_impl_t>
+using dp_algorithm_template_banded = typename _dp_algorithm_template_banded<algorithm_impl_t>::type;
+
+template <typename algorithm_impl_t>
+class _dp_algorithm_template_banded<algorithm_impl_t>::type : public dp_algorithm_template_base<algorithm_impl_t>
+{
+private:
+    using algorithm_attorney_t = dp_algorithm_attorney<algorithm_impl_t>;
+
+    // The half-open interval of the rows computed by a lane.
+    struct lane_rows
+    {
+        std::ptrdiff_t first{};
+        std::ptrdiff_t last{};
+    };
+
+protected:
+
+    using base_t = dp_algorithm_template_base<algorithm_impl_t>;
+
+    template <typename sequence1_t, typename sequence2_t, typename dp_column_t, typename dp_row_t>
+    auto run(sequence1_t && sequence1, sequence2_t && sequence2, dp_column_t dp_column, dp_row_t dp_row) const
+    {
+        auto const band = algorithm_attorney_t::band_setting(as_algorithm());
+
+        // ----------------------------------------------------------------------------
+        // Initialisation
+        // ----------------------------------------------------------------------------
+
+        auto transformed_seq1 = base_t::initialise_column(sequence1, dp_column);
+        auto transformed_seq2 = base_t::initialise_row(sequence2, dp_row);
+
+        initialise_band(dp_column, dp_row, band);
+
+        auto matrix = base_t::initialise_dp_matrix(dp_column, dp_row, transformed_seq1, transformed_seq2);
+
+        // ----------------------------------------------------------------------------
+        // Recursion
+        // ----------------------------------------------------------------------------
+
+        lane_rows rows{};
+        std::ptrdiff_t column_offset = 0;
+        for (std::ptrdiff_t column_idx = 0; column_idx < dp_matrix::column_count(matrix); ++column_idx) {
+            auto current_column = dp_matrix::column_at(matrix, column_idx);
+            std::ptrdiff_t row_offset = 0;
+            std::ptrdiff_t column_width = 0;
+            for (std::ptrdiff_t row_idx = 0; row_idx < dp_matrix::row_count(current_column); ++row_idx) {
+                auto dp_block = dp_matrix::row_at(current_column, row_idx);
+                compute_block(dp_block, band, rows, row_offset, column_offset);
+                row_offset += std::ranges::distance(dp_matrix::column_sequence(dp_block));
+                column_width = std::ranges::distance(dp_matrix::row_sequence(dp_block));
+            }
+            column_offset += column_width;
+        }
+
+        // ----------------------------------------------------------------------------
+        // Create result
+        // ----------------------------------------------------------------------------
+
+        return base_t::make_result(std::move(dp_matrix::tracker(matrix)),
+                                   std::forward<sequence1_t>(sequence1),
+                                   std::forward<sequence2_t>(sequence2),
+                                   std::move(dp_column),
+                                   std::move(dp_row));
+    }
+
+private:
+
+    template <typename dp_block_t, typename band_t>
+    void compute_block(dp_block_t && dp_block,
+                       band_t const & band,
+                       lane_rows & rows,
+                       std::ptrdiff_t const row_offset,
+                       std::ptrdiff_t const column_offset) const noexcept
+    {
+        constexpr std::ptrdiff_t lane_width = std::remove_reference_t<dp_block_t>::lane_width;
+        auto && tracker = dp_matrix::tracker(dp_block);
+        auto && scorer = dp_matrix::substitution_model(dp_block);
+
+        std::ptrdiff_t const lane_count = dp_matrix::column_count(dp_block);
+        for (std::ptrdiff_t lane_index = 0; lane_index < lane_count - 1; ++lane_index) {
+            auto dp_lane = dp_matrix::column_at(dp_block, lane_index);
+            compute_lane(dp_lane, scorer, tracker, band, rows, row_offset, column_offset + lane_index * lane_width,
+                         false);
+        }
+
+        auto final_dp_lane = dp_block.final_lane();
+        compute_lane(final_dp_lane,
+                     scorer,
+                     tracker,
+                     band,
+                     rows,
+                     row_offset,
+                     column_offset + (lane_count - 1) * lane_width,
+                     true);
+    }
+
+    /*!\brief Computes the rows of the lane that intersect with the band.
+     *
+     * The cell (i, j) of the lane has the global coordinate (row_offset + i + 1, column_offset + j + 1).
+     * The rows above the band were computed by the previous lanes, which therefore provide the diagonal score of the
+     * first computed row. The rows that were below the band of the previous lane are set to minus infinity before
+     * they are computed for the first time.
+     */
+    template <typename dp_lane_t, typename scorer_t, typename tracker_t, typename band_t>
+    void compute_lane(dp_lane_t & dp_lane,
+                      scorer_t const & scorer,
+                      tracker_t & tracker,
+                      band_t const & band,
+                      lane_rows & rows,
+                      std::ptrdiff_t const row_offset,
+                      std::ptrdiff_t const column_offset,
+                      bool const is_final_lane) const noexcept
+    {
+        auto && dp_column = dp_matrix::dp_column(dp_lane);
+        auto && dp_row = dp_matrix::dp_row(dp_lane);
+        auto && seq2_slice = dp_matrix::row_sequence(dp_lane);
+
+        using score_t = typename std::remove_cvref_t<decltype(dp_column[0])>::score_type;
+        score_t const infinity = minus_infinity<score_t>();
+
+        std::ptrdiff_t const row_count = dp_matrix::row_count(dp_lane);
+        std::ptrdiff_t const lane_size = std::ranges::distance(seq2_slice);
+        lane_rows const previous_rows = rows;
+        rows = select_rows(band, previous_rows, dp_column, row_offset, column_offset, lane_size, row_count);
+
+        if constexpr (std::same_as<band_t, cfg::adaptive_band>) {
+            if (is_final_lane)
+                rows.last = row_count;
+        }
+
+        if (rows.first > 0) { // Continue from the last row above the band, which is outside of the band except for
+                              // the diagonal score of the first cell.
+            for (std::ptrdiff_t idx = 0; idx < lane_size; ++idx) {
+                mask_cell(dp_row[idx], infinity);
+            }
+            get<0>(dp_row[0]) = get<0>(dp_column[rows.first]);
+
+            // The rows computed by the previous lane that left the band now.
+            for (std::ptrdiff_t i = previous_rows.first; i < rows.first; ++i) {
+                mask_cell(dp_column[i + 1], infinity);
+            }
+        }
+
+        if (column_offset > 0) { // The rows entering the band have no predecessor in the previous column.
+            for (std::ptrdiff_t i = std::max(previous_rows.last, rows.first); i < rows.last; ++i) {
+                mask_cell(dp_column[i + 1], infinity);
+            }
+        }
+
+        for (std::ptrdiff_t i = rows.first; i < rows.last; ++i) {
+            // Local column indices of the band within the current row.
+            std::ptrdiff_t band_begin = 0;
+            std::ptrdiff_t band_end = lane_size;
+            if constexpr (std::same_as<band_t, cfg::static_band>) {
+                std::ptrdiff_t const diagonal_offset = row_offset + i - column_offset;
+                band_begin = diagonal_offset + band.lower_diagonal;
+                band_end = diagonal_offset + band.upper_diagonal;
+            }
+
+            auto cacheH = dp_column[i+1];
+            for (std::ptrdiff_t idx = 0; idx < lane_size; ++idx) {
+                algorithm_attorney_t::compute_cell(as_algorithm(),
+                                                   dp_row[idx],
+                                                   cacheH,
+                                                   scorer,
+                                                   tracker,
+                                                   dp_matrix::column_sequence(dp_lane)[i],
+                                                   seq2_slice[idx]);
+                if (idx < band_begin || idx > band_end) {
+                    mask_cell(cacheH, infinity);
+                    mask_gaps(dp_row[idx], infinity);
+                }
+            }
+            dp_column[i+1] = cacheH;
+        }
+
+        if (rows.last < row_count) { // The last row of the lane is below the band.
+            for (std::ptrdiff_t idx = 0; idx < lane_size; ++idx) {
+                mask_cell(dp_row[idx], infinity);
+            }
+        }
+    }
+
+    // The rows of the lane that intersect the diagonals of the static band.
+    template <typename dp_column_t>
+    static lane_rows select_rows(cfg::static_band const & band,
+                                 lane_rows const &,
+                                 dp_column_t const &,
+                                 std::ptrdiff_t const row_offset,
+                                 std::ptrdiff_t const column_offset,
+                                 std::ptrdiff_t const lane_size,
+                                 std::ptrdiff_t const row_count) noexcept
+    {
+        return lane_rows{
+            .first = std::clamp<std::ptrdiff_t>(column_offset - band.upper_diagonal - row_offset, 0, row_count),
+            .last = std::clamp<std::ptrdiff_t>(column_offset + lane_size - band.lower_diagonal - row_offset,
+                                               0,
+                                               row_count)
+        };
+    }
+
+    /*!\brief The rows of the lane around the best score in the last column of the previous lane.
+     *
+     * The rows start half of the band width above the best score and the lane computes band width plus lane size
+     * many rows, such that the alignment can advance diagonally within the lane. The first row never moves upwards,
+     * which guarantees that rows leaving the band are never computed again.
+     */
+    template <typename dp_column_t>
+    static lane_rows select_rows(cfg::adaptive_band const & band,
+                                 lane_rows const & previous_rows,
+                                 dp_column_t const & dp_column,
+                                 std::ptrdiff_t const,
+                                 std::ptrdiff_t const column_offset,
+                                 std::ptrdiff_t const lane_size,
+                                 std::ptrdiff_t const row_count) noexcept
+    {
+        std::ptrdiff_t best_row = 0; // The index within the dp column, where 0 is the row above the first row.
+        if (column_offset > 0 && previous_rows.first < previous_rows.last) {
+            best_row = previous_rows.first + 1;
+            for (std::ptrdiff_t k = best_row + 1; k <= previous_rows.last; ++k)
+                if (get<0>(dp_column[k]) > get<0>(dp_column[best_row]))
+                    best_row = k;
+        }
+
+        std::ptrdiff_t const first = std::clamp<std::ptrdiff_t>(best_row - 1 - band.band_width / 2,
+                                                                previous_rows.first,
+                                                                row_count);
+        return lane_rows{.first = first, .last = std::min<std::ptrdiff_t>(first + band.band_width + lane_size,
+                                                                          row_count)};
+    }
+
+    // The first column leaves the band below the lower and the first row above the upper diagonal.
+    template <typename dp_column_t, typename dp_row_t>
+    static void initialise_band(dp_column_t & dp_column, dp_row_t & dp_row, cfg::static_band const & band) noexcept
+    {
+        mask_dp_vector(dp_column, -band.lower_diagonal);
+        mask_dp_vector(dp_row, band.upper_diagonal);
+    }
+
+    // The adaptive band keeps the first row and column, since every cell of them is reached by a single gap.
+    template <typename dp_column_t, typename dp_row_t>
+    static void initialise_band(dp_column_t &, dp_row_t &, cfg::adaptive_band const &) noexcept
+    {}
+
+    // Sets all cells of the dp vector whose index is larger than the given bound to minus infinity.
+    template <typename dp_vector_t>
+    static void mask_dp_vector(dp_vector_t & dp_vector, std::ptrdiff_t const bound) noexcept
+    {
+        using score_t = typename std::remove_cvref_t<decltype(dp_vector[0][0])>::score_type;
+        score_t const infinity = minus_infinity<score_t>();
+
+        std::ptrdiff_t const chunk_size = dp_vector[0].size() - 1;
+        for (std::ptrdiff_t chunk = 0; chunk < static_cast<std::ptrdiff_t>(dp_vector.size()); ++chunk) {
+            std::ptrdiff_t const chunk_begin = chunk * chunk_size;
+            for (std::ptrdiff_t k = std::max<std::ptrdiff_t>(0, bound + 1 - chunk_begin);
+                 k < static_cast<std::ptrdiff_t>(dp_vector[chunk].size());
+                 ++k) {
+                mask_cell(dp_vector[chunk][k], infinity);
+            }
+        }
+    }
+
+    // Sets all scores of the cell to minus infinity.
+    template <typename dp_cell_t, typename score_t>
+    static void mask_cell(dp_cell_t && dp_cell, score_t const & infinity) noexcept
+    {
+        std::apply([&] (auto & ...scores) { ((scores = infinity), ...); }, dp_cell);
+    }
+
+    // Sets all gap scores of the cell to minus infinity, but keeps the best score.
+    template <typename dp_cell_t, typename score_t>
+    static void mask_gaps(dp_cell_t && dp_cell, score_t const & infinity) noexcept
+    {
+        std::apply([&] (auto &, auto & ...gap_scores) { ((gap_scores = infinity), ...); }, dp_cell);
+    }
+
+    // Half of the lowest score, such that adding gap and substitution scores can not overflow.
+    template <typename score_t>
+    static constexpr score_t minus_infinity() noexcept
+    {
+        if constexpr (simd::simd_type<score_t>) {
+            using value_t = typename score_t::value_type;
+            return score_t{static_cast<value_t>(std::numeric_limits<value_t>::lowest() / 2)};
+        } else {
+            return static_cast<score_t>(std::numeric_limits<score_t>::lowest() / 2);
+        }
+    }
+
+    constexpr algorithm_impl_t const & as_algorithm() const noexcept
+    {
+        return static_cast<algorithm_impl_t const &>(*this);
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
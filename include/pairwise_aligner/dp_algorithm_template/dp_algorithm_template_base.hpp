@@ -79,14 +79,22 @@ protected:
         return algorithm_attorney_t::lane_width(as_algorithm(), std::forward<args_t>(args)...);
     }
 
+    /*!\brief Computes all cells of the block.
+     *
+     * The first cell of the block has the coordinate (row_offset + 1, column_offset + 1). Every row of a lane moves the
+     * tracker to its first cell, such that the tracker knows the coordinate of every score it tracks.
+     */
     template <typename dp_block_t>
-    void compute_block(dp_block_t && dp_block) const noexcept
+    void compute_block(dp_block_t && dp_block,
+                       std::ptrdiff_t const row_offset,
+                       std::ptrdiff_t const column_offset) const noexcept
     {
         // Initialise bulk_cache array.
         // constexpr std::ptrdiff_t lane_width = std::remove_cvref_t<dp_block_t>::lane_width_v;
         // std::ptrdiff_t const sequence1_size = std::ranges::distance(sequence1);
 
         constexpr auto index_sequence = std::make_index_sequence<std::remove_reference_t<dp_block_t>::lane_width>();
+        constexpr std::ptrdiff_t lane_width = std::remove_reference_t<dp_block_t>::lane_width;
         auto && tracker = dp_matrix::tracker(dp_block);
         auto && scorer = dp_matrix::substitution_model(dp_block);
 
@@ -95,10 +103,12 @@ protected:
         {
             auto dp_lane = dp_matrix::column_at(dp_block, lane_index);
             auto && seq2_slice = dp_matrix::row_sequence(dp_lane);
+            std::ptrdiff_t const lane_offset = column_offset + lane_index * lane_width;
 
             // compute cache many cells in one row for one horizontal value.
             for (std::ptrdiff_t i = 0; i < dp_matrix::row_count(dp_lane); ++i) {
                 auto cacheH = dp_matrix::dp_column(dp_lane)[i+1];
+                tracker.move_to(row_offset + i + 1, lane_offset + 1);
                 unroll_loop(dp_matrix::dp_row(dp_lane),
                             cacheH,
                             scorer,
@@ -114,10 +124,12 @@ protected:
         auto final_dp_lane = dp_block.final_lane(); // Not a CPO -> last_column/row
         auto && seq2_slice = dp_matrix::row_sequence(final_dp_lane);
         // assert(seq2_slice.size() <= lane_width);
+        std::ptrdiff_t const final_lane_offset = column_offset + (dp_matrix::column_count(dp_block) - 1) * lane_width;
 
         // compute cache many cells in one row for one horizontal value.
         for (std::ptrdiff_t i = 0; i < dp_matrix::row_count(final_dp_lane); ++i) {
             auto cacheH = dp_matrix::dp_column(final_dp_lane)[i+1];
+            tracker.move_to(row_offset + i + 1, final_lane_offset + 1);
             unroll_loop(dp_matrix::dp_row(final_dp_lane),
                         cacheH,
                         scorer,
@@ -132,7 +144,8 @@ protected:
     auto make_result(tracker_t const & tracker, args_t && ...args) const noexcept
     {
         auto max_score = tracker.max_score(args...);
-        return aligner_result(std::forward<args_t>(args)..., std::move(max_score));
+        auto end_coordinate = tracker.optimal_coordinate(args...);
+        return aligner_result(std::forward<args_t>(args)..., std::move(max_score), std::move(end_coordinate));
     }
 
 private:
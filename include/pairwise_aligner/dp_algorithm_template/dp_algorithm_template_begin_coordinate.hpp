@@ -0,0 +1,180 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::dp_algorithm_template_begin_coordinate.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <array>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_base.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_standard.hpp>
+#include <pairwise_aligner/matrix/dp_matrix_cpo.hpp>
+#include <pairwise_aligner/result/aligner_result_begin_coordinate.hpp>
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief Computes the local alignments of a bulk together with their begin coordinates.
+ *
+ * After the forward pass found the score and the end coordinate of every lane, the reversed prefixes ending in the
+ * end coordinates are aligned in a second bulk. The trackers keep the first cell of the optimal score. Hence, no
+ * other cell of the prefixes reaches the score and every reverse alignment of this score starts in the end
+ * coordinate. The cell in which it reaches the score is therefore the begin coordinate.
+ * The reverse pass stops after the first column of blocks in which all lanes reached the score of their forward
+ * pass. It works on copies of the initial dp vectors, since the ones of the forward pass belong to the result.
+ */
+template <typename algorithm_impl_t>
+struct _dp_algorithm_template_begin_coordinate
+{
+    class type;
+};
+
+template <typename algorithm_impl_t>
+using dp_algorithm_template_begin_coordinate =
+    typename _dp_algorithm_template_begin_coordinate<algorithm_impl_t>::type;
+
+template <typename algorithm_impl_t>
+class _dp_algorithm_template_begin_coordinate<algorithm_impl_t>::type :
+    public dp_algorithm_template_standard<algorithm_impl_t>
+{
+private:
+    using standard_t = dp_algorithm_template_standard<algorithm_impl_t>;
+
+protected:
+
+    using base_t = dp_algorithm_template_base<algorithm_impl_t>;
+
+    template <typename sequences1_t, typename sequences2_t, typename dp_column_t, typename dp_row_t>
+    auto run(sequences1_t && sequences1, sequences2_t && sequences2, dp_column_t dp_column, dp_row_t dp_row) const
+    {
+        static_assert(std::ranges::range<std::ranges::range_reference_t<sequences1_t>> &&
+                      std::ranges::range<std::ranges::range_reference_t<sequences2_t>>,
+                      "The begin coordinate is only computed for bulks of sequence pairs!");
+
+        dp_column_t reverse_dp_column{dp_column};
+        dp_row_t reverse_dp_row{dp_row};
+
+        auto result = standard_t::run(std::forward<sequences1_t>(sequences1),
+                                      std::forward<sequences2_t>(sequences2),
+                                      std::move(dp_column),
+                                      std::move(dp_row));
+
+        auto const & end_coordinate = result.end_coordinate();
+        size_t const pair_count = std::ranges::distance(result.sequence1());
+
+        // An alignment without a positive score is empty, such that it begins where it ends.
+        std::vector<bool> is_empty(pair_count);
+        for (size_t lane = 0; lane < pair_count; ++lane)
+            is_empty[lane] = !(0 < result.score()[lane]);
+
+        auto reverse_end_coordinate = run_reverse(reverse_prefixes(result.sequence1(),
+                                                                   end_coordinate,
+                                                                   &alignment_coordinate::sequence1_position),
+                                                  reverse_prefixes(result.sequence2(),
+                                                                   end_coordinate,
+                                                                   &alignment_coordinate::sequence2_position),
+                                                  std::move(reverse_dp_column),
+                                                  std::move(reverse_dp_row),
+                                                  result.score(),
+                                                  is_empty);
+
+        std::remove_cvref_t<decltype(end_coordinate)> begin_coordinate{end_coordinate};
+        for (size_t lane = 0; lane < pair_count; ++lane) {
+            if (is_empty[lane])
+                continue;
+
+            begin_coordinate[lane].sequence1_position -= reverse_end_coordinate[lane].sequence1_position;
+            begin_coordinate[lane].sequence2_position -= reverse_end_coordinate[lane].sequence2_position;
+        }
+
+        return aligner_result_begin_coordinate<decltype(result), decltype(begin_coordinate)>{
+                    std::move(result),
+                    std::move(begin_coordinate)};
+    }
+
+private:
+
+    // The reversed prefixes of the sequences ending in the end coordinate of the respective lane.
+    template <typename sequences_t, typename coordinates_t>
+    static auto reverse_prefixes(sequences_t const & sequences,
+                                 coordinates_t const & end_coordinate,
+                                 size_t alignment_coordinate::* position) noexcept
+    {
+        using iterator_t = std::ranges::iterator_t<std::ranges::range_reference_t<sequences_t const>>;
+        using prefix_t = decltype(std::ranges::subrange<iterator_t>{} | std::views::reverse);
+
+        std::vector<prefix_t> prefixes{};
+        prefixes.reserve(std::ranges::distance(sequences));
+
+        size_t lane = 0;
+        for (auto && sequence : sequences) {
+            iterator_t first = std::ranges::begin(sequence);
+            prefixes.push_back(std::ranges::subrange<iterator_t>{first,
+                                                                 std::ranges::next(first,
+                                                                                   end_coordinate[lane].*position)}
+                               | std::views::reverse);
+            ++lane;
+        }
+        return prefixes;
+    }
+
+    // Computes the column blocks of the reversed prefixes until every lane reached its score.
+    template <typename sequences1_t,
+              typename sequences2_t,
+              typename dp_column_t,
+              typename dp_row_t,
+              typename score_t>
+    auto run_reverse(sequences1_t const & sequences1,
+                     sequences2_t const & sequences2,
+                     dp_column_t dp_column,
+                     dp_row_t dp_row,
+                     score_t const & score,
+                     std::vector<bool> const & is_empty) const
+    {
+        auto transformed_seq1 = base_t::initialise_column(sequences1, dp_column);
+        auto transformed_seq2 = base_t::initialise_row(sequences2, dp_row);
+
+        auto matrix = base_t::initialise_dp_matrix(dp_column, dp_row, transformed_seq1, transformed_seq2);
+
+        std::ptrdiff_t column_offset = 0;
+        for (std::ptrdiff_t column_idx = 0; column_idx < dp_matrix::column_count(matrix); ++column_idx) {
+            auto current_column = dp_matrix::column_at(matrix, column_idx);
+            std::ptrdiff_t row_offset = 0;
+            std::ptrdiff_t column_width = 0;
+            for (std::ptrdiff_t row_idx = 0; row_idx < dp_matrix::row_count(current_column); ++row_idx) {
+                auto dp_block = dp_matrix::row_at(current_column, row_idx);
+                base_t::compute_block(dp_block, row_offset, column_offset);
+                row_offset += std::ranges::distance(dp_matrix::column_sequence(dp_block));
+                column_width = std::ranges::distance(dp_matrix::row_sequence(dp_block));
+            }
+            column_offset += column_width;
+
+            auto const reverse_score = dp_matrix::tracker(matrix).max_score();
+            bool has_reached_score = true;
+            for (size_t lane = 0; lane < is_empty.size(); ++lane)
+                has_reached_score &= is_empty[lane] || !(reverse_score[lane] < score[lane]);
+
+            if (has_reached_score)
+                break;
+        }
+
+        return dp_matrix::tracker(matrix).optimal_coordinate();
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
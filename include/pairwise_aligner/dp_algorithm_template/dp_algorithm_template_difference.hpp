@@ -0,0 +1,291 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::dp_algorithm_template_difference.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <pairwise_aligner/affine/affine_gap_model.hpp>
+#include <pairwise_aligner/configuration/end_gap_policy.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_attorney.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_base.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_standard.hpp>
+#include <pairwise_aligner/result/aligner_result.hpp>
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
+#include <pairwise_aligner/simd/simd_score_type.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief Computes the global alignment scores of a bulk with the difference recurrence of Suzuki and Kasahara.
+ *
+ * Instead of the scores of the cells, the differences between neighbouring cells are computed, i.e. the vertical
+ * differences H(i, j) - H(i - 1, j), the horizontal differences H(i, j) - H(i, j - 1) and the gap scores relative
+ * to the cell they are opened from. The differences are bounded by the match, mismatch and gap scores independent
+ * of the sequence lengths, such that 8 bit scores suffice for arbitrary long sequences without rebasing the scores
+ * block-wise. The score of a lane is the score of the first row in its last column plus the sum of the vertical
+ * differences of that column.
+ * Only the score is computed, i.e. the dp column and the dp row keep their initial values.
+ * Score types without a simd vector, non-affine gap models, free end gaps and scores whose differences exceed the
+ * range of 8 bit scores are computed with seqan::pairwise_aligner::dp_algorithm_template_standard.
+ */
+template <typename algorithm_impl_t>
+struct _dp_algorithm_template_difference
+{
+    class type;
+};
+
+template <typename algorithm_impl_t>
+using dp_algorithm_template_difference = typename _dp_algorithm_template_difference<algorithm_impl_t>::type;
+
+template <typename algorithm_impl_t>
+class _dp_algorithm_template_difference<algorithm_impl_t>::type :
+    public dp_algorithm_template_standard<algorithm_impl_t>
+{
+private:
+    using algorithm_attorney_t = dp_algorithm_attorney<algorithm_impl_t>;
+    using standard_t = dp_algorithm_template_standard<algorithm_impl_t>;
+
+protected:
+
+    using base_t = dp_algorithm_template_base<algorithm_impl_t>;
+
+    template <typename sequence1_t, typename sequence2_t, typename dp_column_t, typename dp_row_t>
+    auto run(sequence1_t && sequence1, sequence2_t && sequence2, dp_column_t dp_column, dp_row_t dp_row) const
+    {
+        using score_t = typename std::remove_cvref_t<decltype(dp_column[0][0])>::score_type;
+
+        if constexpr (!is_vectorisable<score_t>()) {
+            return standard_t::run(std::forward<sequence1_t>(sequence1),
+                                   std::forward<sequence2_t>(sequence2),
+                                   std::move(dp_column),
+                                   std::move(dp_row));
+        } else {
+            using difference_t = simd_score<int8_t, score_t::size_v>;
+
+            auto const [gap_open_score, gap_extension_score] = algorithm_attorney_t::gap_setting(as_algorithm());
+            auto const [match_score, mismatch_score] = substitution_scores<score_t>();
+
+            if (!has_penalised_end_gaps() ||
+                !fits_difference(match_score, mismatch_score, gap_open_score, gap_extension_score))
+                return standard_t::run(std::forward<sequence1_t>(sequence1),
+                                       std::forward<sequence2_t>(sequence2),
+                                       std::move(dp_column),
+                                       std::move(dp_row));
+
+            // ----------------------------------------------------------------------------
+            // Initialisation
+            // ----------------------------------------------------------------------------
+
+            base_t::initialise_column(sequence1, dp_column);
+            base_t::initialise_row(sequence2, dp_row);
+
+            // ----------------------------------------------------------------------------
+            // Recursion
+            // ----------------------------------------------------------------------------
+
+            auto [score, end_coordinate] = compute_difference<score_t, difference_t>(sequence1,
+                                                                                     sequence2,
+                                                                                     match_score,
+                                                                                     mismatch_score,
+                                                                                     gap_open_score,
+                                                                                     gap_extension_score);
+
+            // ----------------------------------------------------------------------------
+            // Create result
+            // ----------------------------------------------------------------------------
+
+            return aligner_result(std::forward<sequence1_t>(sequence1),
+                                  std::forward<sequence2_t>(sequence2),
+                                  std::move(dp_column),
+                                  std::move(dp_row),
+                                  std::move(score),
+                                  std::move(end_coordinate));
+        }
+    }
+
+private:
+
+    template <typename score_t>
+    static constexpr bool is_vectorisable() noexcept
+    {
+        if constexpr (simd::simd_type<score_t> &&
+                      requires (algorithm_impl_t const & algorithm) { algorithm_attorney_t::gap_setting(algorithm); })
+        {
+            using gap_model_t = decltype(algorithm_attorney_t::gap_setting(std::declval<algorithm_impl_t const &>()));
+            using gap_score_t = decltype(gap_model_t::gap_open_score);
+
+            return std::same_as<gap_model_t, affine_gap_model<gap_score_t>> && std::integral<gap_score_t>;
+        } else {
+            return false;
+        }
+    }
+
+    bool has_penalised_end_gaps() const noexcept
+    {
+        cfg::leading_end_gap const leading_gap = algorithm_attorney_t::leading_gap_setting(as_algorithm());
+        cfg::trailing_end_gap const trailing_gap = algorithm_attorney_t::trailing_gap_setting(as_algorithm());
+
+        return leading_gap.first_column == cfg::end_gap::penalised &&
+               leading_gap.first_row == cfg::end_gap::penalised &&
+               trailing_gap.last_column == cfg::end_gap::penalised &&
+               trailing_gap.last_row == cfg::end_gap::penalised;
+    }
+
+    // Reads the match and the mismatch score from the unitary substitution model.
+    template <typename score_t>
+    std::pair<int32_t, int32_t> substitution_scores() const noexcept
+    {
+        using value_t = typename score_t::value_type;
+
+        auto const scorer = base_t::initialise_substitution_scheme();
+        score_t const zero{value_t{0}};
+        score_t const symbol{value_t{1}};
+        score_t const other_symbol{value_t{2}};
+        return {static_cast<int32_t>(scorer.score(zero, symbol, symbol)[0]),
+                static_cast<int32_t>(scorer.score(zero, symbol, other_symbol)[0])};
+    }
+
+    // The differences lie within [gap_open + gap_extension, match - gap_open - gap_extension]. Their sums and
+    // the differences computed from them must fit into 8 bit scores.
+    static constexpr bool fits_difference(int32_t const match_score,
+                                          int32_t const mismatch_score,
+                                          int32_t const gap_open_score,
+                                          int32_t const gap_extension_score) noexcept
+    {
+        int32_t const max_difference = std::max(std::abs(match_score), std::abs(mismatch_score)) +
+                                       2 * std::abs(gap_open_score + gap_extension_score);
+        return gap_open_score <= 0 && gap_extension_score <= 0 &&
+               max_difference <= std::numeric_limits<int8_t>::max();
+    }
+
+    /*!\brief Computes the columns of the differences and reads the score of every lane from its last column.
+     *
+     * For the cell (i, j) the difference to the diagonal cell is the maximum of the substitution score, the
+     * horizontal gap relative to the left cell plus the vertical difference of the left cell, and the vertical gap
+     * relative to the upper cell plus the horizontal difference of the upper cell. The vertical and horizontal
+     * differences of the cell follow from it by subtracting the horizontal difference of the upper cell and the
+     * vertical difference of the left cell, respectively.
+     */
+    template <typename score_t, typename difference_t, typename sequence1_t, typename sequence2_t>
+    static auto compute_difference(sequence1_t const & sequence1,
+                                   sequence2_t const & sequence2,
+                                   int32_t const match_score,
+                                   int32_t const mismatch_score,
+                                   int32_t const gap_open_score,
+                                   int32_t const gap_extension_score)
+    {
+        using value_t = typename score_t::value_type;
+        constexpr size_t lane_count = score_t::size_v;
+
+        std::array<std::ptrdiff_t, lane_count> sizes1{};
+        std::array<std::ptrdiff_t, lane_count> sizes2{};
+        std::ptrdiff_t const sequence_count = std::ranges::distance(sequence1);
+        for (std::ptrdiff_t lane = 0; lane < sequence_count; ++lane) {
+            sizes1[lane] = std::ranges::distance(sequence1[lane]);
+            sizes2[lane] = std::ranges::distance(sequence2[lane]);
+        }
+        std::ptrdiff_t const row_count = std::ranges::max(sizes1);
+        std::ptrdiff_t const column_count = std::ranges::max(sizes2);
+
+        // The symbols of the first sequences per row. The cells beyond the end of a lane are never read.
+        std::vector<difference_t> symbols1(row_count + 1);
+        std::vector<difference_t> symbols2(column_count + 1);
+        for (std::ptrdiff_t lane = 0; lane < sequence_count; ++lane) {
+            std::ptrdiff_t row = 1;
+            for (auto const & symbol : sequence1[lane])
+                symbols1[row++][lane] = static_cast<int8_t>(symbol);
+
+            std::ptrdiff_t column = 1;
+            for (auto const & symbol : sequence2[lane])
+                symbols2[column++][lane] = static_cast<int8_t>(symbol);
+        }
+
+        int8_t const gap_open_extension_score = static_cast<int8_t>(gap_open_score + gap_extension_score);
+        int8_t const gap_open = static_cast<int8_t>(gap_open_score);
+        int8_t const gap_extension = static_cast<int8_t>(gap_extension_score);
+        difference_t const match{static_cast<int8_t>(match_score)};
+        difference_t const mismatch{static_cast<int8_t>(mismatch_score)};
+        difference_t const open{gap_open};
+
+        // The vertical differences of the first column and the horizontal gaps relative to the first column.
+        std::vector<difference_t> vertical_differences(row_count + 1, difference_t{gap_extension});
+        std::vector<difference_t> horizontal_gaps(row_count + 1, difference_t{gap_open_extension_score});
+        if (row_count > 0)
+            vertical_differences[1] = difference_t{gap_open_extension_score};
+
+        score_t score{};
+        std::array<alignment_coordinate, lane_count> end_coordinate{};
+
+        // The score of the last cell of every lane ending in the given column.
+        auto collect_scores = [&] (std::ptrdiff_t const column) {
+            for (size_t lane = 0; lane < lane_count; ++lane) {
+                if (sizes2[lane] != column)
+                    continue;
+
+                int32_t lane_score = (column > 0) ? gap_open_score + gap_extension_score * column : 0;
+                for (std::ptrdiff_t row = 1; row <= sizes1[lane]; ++row)
+                    lane_score += vertical_differences[row][lane];
+
+                score[lane] = static_cast<value_t>(lane_score);
+                end_coordinate[lane] = alignment_coordinate{.sequence1_position = static_cast<size_t>(sizes1[lane]),
+                                                            .sequence2_position = static_cast<size_t>(column)};
+            }
+        };
+
+        collect_scores(0);
+        for (std::ptrdiff_t column = 1; column <= column_count; ++column) {
+            difference_t const & symbol2 = symbols2[column];
+            difference_t horizontal_difference{(column == 1) ? gap_open_extension_score : gap_extension};
+            difference_t vertical_gap{gap_open_extension_score};
+
+            for (std::ptrdiff_t row = 1; row <= row_count; ++row) {
+                difference_t & vertical_difference = vertical_differences[row];
+                difference_t & horizontal_gap = horizontal_gaps[row];
+
+                difference_t const diagonal_difference =
+                    max(blend(symbols1[row].eq(symbol2), match, mismatch),
+                        max(horizontal_gap + vertical_difference, vertical_gap + horizontal_difference));
+
+                difference_t const next_vertical_difference = diagonal_difference - horizontal_difference;
+                horizontal_difference = diagonal_difference - vertical_difference;
+                vertical_difference = next_vertical_difference;
+
+                horizontal_gap = max(horizontal_gap - horizontal_difference, open) + gap_extension;
+                vertical_gap = max(vertical_gap - vertical_difference, open) + gap_extension;
+            }
+
+            collect_scores(column);
+        }
+
+        return std::pair{score, end_coordinate};
+    }
+
+    constexpr algorithm_impl_t const & as_algorithm() const noexcept
+    {
+        return static_cast<algorithm_impl_t const &>(*this);
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -0,0 +1,383 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::dp_algorithm_template_hirschberg.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <pairwise_aligner/configuration/end_gap_policy.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_attorney.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_base.hpp>
+#include <pairwise_aligner/matrix/dp_matrix_cpo.hpp>
+#include <pairwise_aligner/result/aligner_result.hpp>
+#include <pairwise_aligner/result/aligner_result_alignment.hpp>
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
+#include <pairwise_aligner/utility/cigar.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief Computes the global alignment of a single pair in linear memory using the divide-and-conquer strategy of
+ *        Myers and Miller.
+ *
+ * The first sequence is split in the middle. The last row of the upper half is computed with the forward kernel
+ * and the last row of the lower half with the same kernel on the reversed sequences. Combining both rows gives the
+ * column at which the optimal alignment crosses the middle, either within a match or within a deletion spanning
+ * the split. Both sub-problems are solved recursively until one sequence has at most one symbol left.
+ * The dp column and row given to the algorithm are reused by all passes, such that only O(n + m) memory is
+ * needed. The alignment must be global with penalised leading and trailing gaps.
+ */
+template <typename algorithm_impl_t>
+struct _dp_algorithm_template_hirschberg
+{
+    class type;
+};
+
+template <typename algorithm_impl_t>
+using dp_algorithm_template_hirschberg = typename _dp_algorithm_template_hirschberg<algorithm_impl_t>::type;
+
+template <typename algorithm_impl_t>
+class _dp_algorithm_template_hirschberg<algorithm_impl_t>::type : public dp_algorithm_template_base<algorithm_impl_t>
+{
+private:
+    using algorithm_attorney_t = dp_algorithm_attorney<algorithm_impl_t>;
+
+    // The state shared by all recursion levels.
+    template <typename symbol1_t, typename symbol2_t, typename dp_column_t, typename dp_row_t, typename score_t>
+    struct recursion_state
+    {
+        std::span<symbol1_t const> sequence1;
+        std::span<symbol1_t const> reversed_sequence1;
+        std::span<symbol2_t const> sequence2;
+        std::span<symbol2_t const> reversed_sequence2;
+        dp_column_t & dp_column;
+        dp_row_t & dp_row;
+        score_t gap_open;
+        score_t gap_extension;
+        std::vector<score_t> forward_best{};
+        std::vector<score_t> forward_deletion{};
+        std::vector<score_t> reverse_best{};
+        std::vector<score_t> reverse_deletion{};
+        std::string operations{};
+    };
+
+protected:
+
+    using base_t = dp_algorithm_template_base<algorithm_impl_t>;
+
+    template <typename sequence1_t, typename sequence2_t, typename dp_column_t, typename dp_row_t>
+    auto run(sequence1_t && sequence1, sequence2_t && sequence2, dp_column_t dp_column, dp_row_t dp_row) const
+    {
+        cfg::leading_end_gap const leading_gap = algorithm_attorney_t::leading_gap_setting(as_algorithm());
+        cfg::trailing_end_gap const trailing_gap = algorithm_attorney_t::trailing_gap_setting(as_algorithm());
+        if (leading_gap.first_column == cfg::end_gap::free || leading_gap.first_row == cfg::end_gap::free ||
+            trailing_gap.last_column == cfg::end_gap::free || trailing_gap.last_row == cfg::end_gap::free)
+            throw std::invalid_argument{"The linear memory alignment output requires penalised end gaps."};
+
+        // ----------------------------------------------------------------------------
+        // Initialisation
+        // ----------------------------------------------------------------------------
+
+        using symbol1_t = std::ranges::range_value_t<sequence1_t>;
+        using symbol2_t = std::ranges::range_value_t<sequence2_t>;
+        using score_t = typename std::remove_cvref_t<decltype(dp_column[0][0])>::score_type;
+
+        // The reversed copies are needed to run the kernel on contiguous memory in the backward direction.
+        std::vector<symbol1_t> forward_sequence1(std::ranges::begin(sequence1), std::ranges::end(sequence1));
+        std::vector<symbol1_t> reversed_sequence1(forward_sequence1.rbegin(), forward_sequence1.rend());
+        std::vector<symbol2_t> forward_sequence2(std::ranges::begin(sequence2), std::ranges::end(sequence2));
+        std::vector<symbol2_t> reversed_sequence2(forward_sequence2.rbegin(), forward_sequence2.rend());
+
+        auto [gap_open, gap_extension] = algorithm_attorney_t::gap_setting(as_algorithm());
+        recursion_state<symbol1_t, symbol2_t, dp_column_t, dp_row_t, score_t> state{
+            .sequence1 = forward_sequence1,
+            .reversed_sequence1 = reversed_sequence1,
+            .sequence2 = forward_sequence2,
+            .reversed_sequence2 = reversed_sequence2,
+            .dp_column = dp_column,
+            .dp_row = dp_row,
+            .gap_open = static_cast<score_t>(gap_open),
+            .gap_extension = static_cast<score_t>(gap_extension)
+        };
+        state.operations.reserve(forward_sequence1.size() + forward_sequence2.size());
+
+        // ----------------------------------------------------------------------------
+        // Recursion
+        // ----------------------------------------------------------------------------
+
+        score_t const score = align(state,
+                                    0, forward_sequence1.size(),
+                                    0, forward_sequence2.size(),
+                                    state.gap_open, state.gap_open);
+
+        // ----------------------------------------------------------------------------
+        // Create result
+        // ----------------------------------------------------------------------------
+
+        alignment_coordinate const end_coordinate{.sequence1_position = forward_sequence1.size(),
+                                                  .sequence2_position = forward_sequence2.size()};
+        std::string cigar = make_cigar(state.operations);
+
+        auto result = aligner_result(std::forward<sequence1_t>(sequence1),
+                                     std::forward<sequence2_t>(sequence2),
+                                     std::move(dp_column),
+                                     std::move(dp_row),
+                                     score,
+                                     end_coordinate);
+
+        return aligner_result_alignment<decltype(result), std::string, alignment_coordinate>{std::move(result),
+                                                                                               std::move(cigar),
+                                                                                               alignment_coordinate{},
+                                                                                               end_coordinate};
+    }
+
+private:
+
+    /*!\brief Appends the operations of the optimal alignment of the given infixes and returns its score.
+     *
+     * \param[in] first_gap_open The gap open score of a deletion at the begin of the infix.
+     * \param[in] last_gap_open The gap open score of a deletion at the end of the infix.
+     *
+     * A gap open score of 0 marks a deletion continuing a deletion of the enclosing problem, whose gap open score was
+     * already accounted for.
+     */
+    template <typename state_t, typename score_t>
+    score_t align(state_t & state,
+                  size_t const begin1,
+                  size_t const end1,
+                  size_t const begin2,
+                  size_t const end2,
+                  score_t const first_gap_open,
+                  score_t const last_gap_open) const
+    {
+        using std::max;
+
+        size_t const size1 = end1 - begin1;
+        size_t const size2 = end2 - begin2;
+
+        auto gap_score = [&] (size_t const gap_size) -> score_t {
+            return (gap_size > 0) ? static_cast<score_t>(state.gap_open + state.gap_extension * gap_size)
+                                  : score_t{0};
+        };
+
+        if (size1 == 0) {
+            state.operations.append(size2, 'I');
+            return gap_score(size2);
+        }
+
+        if (size2 == 0) {
+            state.operations.append(size1, 'D');
+            return static_cast<score_t>(max(first_gap_open, last_gap_open) + state.gap_extension * size1);
+        }
+
+        if (size1 == 1)
+            return align_single_symbol(state, begin1, begin2, end2, first_gap_open, last_gap_open);
+
+        // ----------------------------------------------------------------------------
+        // Find the middle of the alignment.
+        // ----------------------------------------------------------------------------
+
+        size_t const middle1 = begin1 + size1 / 2;
+        size_t const sequence1_size = state.sequence1.size();
+        size_t const sequence2_size = state.sequence2.size();
+
+        compute_last_row(state,
+                         state.sequence1.subspan(begin1, middle1 - begin1),
+                         state.sequence2.subspan(begin2, size2),
+                         first_gap_open,
+                         state.forward_best,
+                         state.forward_deletion);
+        compute_last_row(state,
+                         state.reversed_sequence1.subspan(sequence1_size - end1, end1 - middle1),
+                         state.reversed_sequence2.subspan(sequence2_size - end2, size2),
+                         last_gap_open,
+                         state.reverse_best,
+                         state.reverse_deletion);
+
+        size_t middle2 = 0;
+        bool crosses_in_deletion = false;
+        score_t best = std::numeric_limits<score_t>::lowest();
+        for (size_t j = 0; j <= size2; ++j) {
+            score_t const match_score = state.forward_best[j] + state.reverse_best[size2 - j];
+            // Both deletions are merged into one, such that the gap open score is only accounted once.
+            score_t const deletion_score = state.forward_deletion[j] + state.reverse_deletion[size2 - j] -
+                                           state.gap_open;
+
+            if (match_score > best) {
+                best = match_score;
+                middle2 = j;
+                crosses_in_deletion = false;
+            }
+
+            if (deletion_score > best) {
+                best = deletion_score;
+                middle2 = j;
+                crosses_in_deletion = true;
+            }
+        }
+        middle2 += begin2;
+
+        // ----------------------------------------------------------------------------
+        // Solve the sub-problems.
+        // ----------------------------------------------------------------------------
+
+        if (crosses_in_deletion) { // The symbols around the middle of the first sequence are both deleted.
+            align(state, begin1, middle1 - 1, begin2, middle2, first_gap_open, score_t{0});
+            state.operations.append(2, 'D');
+            align(state, middle1 + 1, end1, middle2, end2, score_t{0}, last_gap_open);
+        } else {
+            align(state, begin1, middle1, begin2, middle2, first_gap_open, state.gap_open);
+            align(state, middle1, end1, middle2, end2, state.gap_open, last_gap_open);
+        }
+
+        return best;
+    }
+
+    // Aligns a single symbol of the first sequence against the given infix of the second sequence.
+    template <typename state_t, typename score_t>
+    score_t align_single_symbol(state_t & state,
+                                size_t const position1,
+                                size_t const begin2,
+                                size_t const end2,
+                                score_t const first_gap_open,
+                                score_t const last_gap_open) const
+    {
+        using std::max;
+
+        size_t const size2 = end2 - begin2;
+        auto gap_score = [&] (size_t const gap_size) -> score_t {
+            return (gap_size > 0) ? static_cast<score_t>(state.gap_open + state.gap_extension * gap_size)
+                                  : score_t{0};
+        };
+
+        auto transformed_seq1 = base_t::initialise_column(state.sequence1.subspan(position1, 1), state.dp_column);
+        auto transformed_seq2 = base_t::initialise_row(state.sequence2.subspan(begin2, size2), state.dp_row);
+        auto scorer = base_t::initialise_substitution_scheme();
+
+        // Either the symbol is deleted, merging the deletion with the one of the enclosing problem if possible, ...
+        score_t best = max(first_gap_open, last_gap_open) + state.gap_extension + gap_score(size2);
+        size_t best_position = size2;
+
+        // ... or it is aligned to one symbol of the second sequence.
+        for (size_t j = 0; j < size2; ++j) {
+            score_t const score = gap_score(j) +
+                                  scorer.score(score_t{0}, transformed_seq1[0], transformed_seq2[j]) +
+                                  gap_score(size2 - j - 1);
+            if (score > best) {
+                best = score;
+                best_position = j;
+            }
+        }
+
+        if (best_position == size2) {
+            bool const deletion_first = first_gap_open >= last_gap_open;
+            if (deletion_first)
+                state.operations.push_back('D');
+            state.operations.append(size2, 'I');
+            if (!deletion_first)
+                state.operations.push_back('D');
+        } else {
+            state.operations.append(best_position, 'I');
+            state.operations.push_back('M');
+            state.operations.append(size2 - best_position - 1, 'I');
+        }
+
+        return best;
+    }
+
+    /*!\brief Computes the last row of the given sub-problem.
+     *
+     * Stores the best score and the best score ending in a deletion for every cell of the last row. The gap open
+     * score of the deletion in the first column is replaced by the given one.
+     */
+    template <typename state_t, typename sequence1_t, typename sequence2_t, typename score_t>
+    void compute_last_row(state_t & state,
+                          sequence1_t sequence1,
+                          sequence2_t sequence2,
+                          score_t const first_gap_open,
+                          std::vector<score_t> & best,
+                          std::vector<score_t> & deletion) const
+    {
+        auto transformed_seq1 = base_t::initialise_column(sequence1, state.dp_column);
+        auto transformed_seq2 = base_t::initialise_row(sequence2, state.dp_row);
+
+        if (score_t const offset = first_gap_open - state.gap_open; offset != 0) {
+            for (size_t chunk = 0; chunk < state.dp_column.size(); ++chunk) {
+                for (size_t k = (chunk == 0) ? 1 : 0; k < state.dp_column[chunk].size(); ++k) {
+                    get<0>(state.dp_column[chunk][k]) += offset;
+                    get<1>(state.dp_column[chunk][k]) += offset;
+                }
+            }
+        }
+
+        { // The matrix refers to the dp vectors, which are read after it was computed.
+            auto matrix = base_t::initialise_dp_matrix(state.dp_column,
+                                                       state.dp_row,
+                                                       transformed_seq1,
+                                                       transformed_seq2);
+
+            std::ptrdiff_t column_offset = 0;
+            for (std::ptrdiff_t column_idx = 0; column_idx < dp_matrix::column_count(matrix); ++column_idx) {
+                auto current_column = dp_matrix::column_at(matrix, column_idx);
+                std::ptrdiff_t row_offset = 0;
+                std::ptrdiff_t column_width = 0;
+                for (std::ptrdiff_t row_idx = 0; row_idx < dp_matrix::row_count(current_column); ++row_idx) {
+                    auto dp_block = dp_matrix::row_at(current_column, row_idx);
+                    base_t::compute_block(dp_block, row_offset, column_offset);
+                    row_offset += std::ranges::distance(dp_matrix::column_sequence(dp_block));
+                    column_width = std::ranges::distance(dp_matrix::row_sequence(dp_block));
+                }
+                column_offset += column_width;
+            }
+        }
+
+        size_t const size1 = sequence1.size();
+        size_t const size2 = sequence2.size();
+        score_t const infinity = std::numeric_limits<score_t>::lowest() / 4;
+
+        best.resize(size2 + 1);
+        deletion.resize(size2 + 1);
+
+        // The first cell of the last row is computed by the first column only.
+        best[0] = (size1 > 0) ? static_cast<score_t>(first_gap_open + state.gap_extension * size1) : score_t{0};
+        deletion[0] = (size1 > 0) ? best[0] : infinity;
+
+        // The first cell of every row chunk overlaps with the last cell of the previous chunk.
+        size_t const chunk_size = state.dp_row[0].size() - 1;
+        for (size_t j = 1; j <= size2; ++j) {
+            size_t const chunk = (j - 1) / chunk_size;
+            auto const & cell = state.dp_row[chunk][j - chunk * chunk_size];
+            best[j] = get<0>(cell);
+            // The vertical score stores the best score ending in a deletion only if it is not opened from the
+            // cell itself. Otherwise, the deletion can never beat crossing the middle within the best score.
+            score_t const opened_gap = get<0>(cell) + state.gap_open + state.gap_extension;
+            deletion[j] = (get<1>(cell) == opened_gap) ? infinity : get<1>(cell) - state.gap_extension;
+        }
+    }
+
+    constexpr algorithm_impl_t const & as_algorithm() const noexcept
+    {
+        return static_cast<algorithm_impl_t const &>(*this);
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -12,10 +12,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
 #include <ranges>
+#include <type_traits>
 
 #include <seqan3/utility/views/slice.hpp>
 
+#include <pairwise_aligner/configuration/score_threshold_policy.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_attorney.hpp>
 #include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_base.hpp>
 #include <pairwise_aligner/matrix/dp_matrix_cpo.hpp>
 
@@ -36,6 +42,9 @@ using dp_algorithm_template_standard = typename _dp_algorithm_template_standard<
 template <typename algorithm_impl_t>
 class _dp_algorithm_template_standard<algorithm_impl_t>::type : public dp_algorithm_template_base<algorithm_impl_t>
 {
+private:
+    using algorithm_attorney_t = dp_algorithm_attorney<algorithm_impl_t>;
+
 protected:
 
     using base_t = dp_algorithm_template_base<algorithm_impl_t>;
@@ -71,6 +80,17 @@ protected:
         // Recursion
         // ----------------------------------------------------------------------------
 
+        // With a score threshold the remaining columns are skipped, once no pair of the bulk can reach it anymore.
+        auto const score_threshold = algorithm_attorney_t::score_threshold_setting(as_algorithm());
+        constexpr bool has_score_threshold = !std::same_as<decltype(score_threshold), cfg::no_score_threshold const>;
+        std::ptrdiff_t row_count = 0;
+        std::ptrdiff_t column_count = 0;
+        if constexpr (has_score_threshold) {
+            row_count = std::ranges::distance(transformed_seq1);
+            column_count = std::ranges::distance(transformed_seq2);
+        }
+
+        std::ptrdiff_t column_offset = 0;
         for (std::ptrdiff_t column_idx = 0; column_idx < dp_matrix::column_count(matrix); ++column_idx) {
             // size_t const row_size = dp_row[column_idx].size() - 1;
             // auto block_sequence2 = seqan3::views::slice(transformed_seq2, row_offset, row_offset + row_size);
@@ -81,11 +101,22 @@ protected:
             //                                        tracker,
             //                                        std::move(block_sequence2),
             //                                        base_t::lane_width());
+            std::ptrdiff_t row_offset = 0;
+            std::ptrdiff_t column_width = 0;
             for (std::ptrdiff_t row_idx = 0; row_idx < dp_matrix::row_count(current_column); ++row_idx) {
                 auto dp_block = dp_matrix::row_at(current_column, row_idx);
-                base_t::compute_block(dp_block);
+                base_t::compute_block(dp_block, row_offset, column_offset);
+                row_offset += std::ranges::distance(dp_matrix::column_sequence(dp_block));
+                column_width = std::ranges::distance(dp_matrix::row_sequence(dp_block));
+            }
+            column_offset += column_width;
+
+            if constexpr (has_score_threshold) {
+                if (is_threshold_unreachable(score_threshold,
+                                             dp_matrix::tracker(matrix),
+                                             std::min(column_count - column_offset, row_count)))
+                    break;
             }
-            // row_offset += row_size;
         }
 
         // ----------------------------------------------------------------------------
@@ -98,6 +129,27 @@ protected:
                                    std::move(dp_column),
                                    std::move(dp_row));
     }
+
+private:
+
+    // The tracker holds the best score of every pair found in the already computed columns.
+    template <typename tracker_t>
+    static bool is_threshold_unreachable(cfg::score_threshold_policy const & score_threshold,
+                                         tracker_t const & tracker,
+                                         std::ptrdiff_t const remaining_pair_count) noexcept
+    {
+        auto const max_scores = tracker.max_score();
+        for (size_t lane = 0; lane < std::remove_cvref_t<decltype(max_scores)>::size_v; ++lane) {
+            if (!score_threshold.is_unreachable(max_scores[lane], remaining_pair_count))
+                return false;
+        }
+        return true;
+    }
+
+    constexpr algorithm_impl_t const & as_algorithm() const noexcept
+    {
+        return static_cast<algorithm_impl_t const &>(*this);
+    }
 };
 
 } // inline namespace v1
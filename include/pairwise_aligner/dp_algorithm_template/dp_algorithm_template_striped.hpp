@@ -0,0 +1,265 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::dp_algorithm_template_striped.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <pairwise_aligner/affine/affine_gap_model.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_attorney.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_base.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_standard.hpp>
+#include <pairwise_aligner/simd/simd_score_type.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief Computes the local alignment score of a single pair with a striped query profile.
+ *
+ * The first sequence is the query. Its rows are distributed over the lanes of a simd vector in a striped layout,
+ * i.e. the lane l of the segment k holds the row k + l * segment_count, such that the cells of one segment never
+ * depend on each other within a column. The substitution scores of every symbol of the second sequence are
+ * precomputed for all segments in a query profile. Vertical gaps crossing the lanes are resolved afterwards by the
+ * lazy-F loop, which rarely runs over more than a few segments.
+ * Only the score is computed, i.e. the dp column and the dp row keep their initial values.
+ * The pairs whose query is shorter than a simd vector, score types without a simd vector, symbols that can not be
+ * converted into the score type and non-affine gap models are computed with
+ * seqan::pairwise_aligner::dp_algorithm_template_standard.
+ */
+template <typename algorithm_impl_t>
+struct _dp_algorithm_template_striped
+{
+    class type;
+};
+
+template <typename algorithm_impl_t>
+using dp_algorithm_template_striped = typename _dp_algorithm_template_striped<algorithm_impl_t>::type;
+
+template <typename algorithm_impl_t>
+class _dp_algorithm_template_striped<algorithm_impl_t>::type : public dp_algorithm_template_standard<algorithm_impl_t>
+{
+private:
+    using algorithm_attorney_t = dp_algorithm_attorney<algorithm_impl_t>;
+    using standard_t = dp_algorithm_template_standard<algorithm_impl_t>;
+
+protected:
+
+    using base_t = dp_algorithm_template_base<algorithm_impl_t>;
+
+    template <typename sequence1_t, typename sequence2_t, typename dp_column_t, typename dp_row_t>
+    auto run(sequence1_t && sequence1, sequence2_t && sequence2, dp_column_t dp_column, dp_row_t dp_row) const
+    {
+        using score_t = typename std::remove_cvref_t<decltype(dp_column[0][0])>::score_type;
+
+        if constexpr (!is_vectorisable<score_t, sequence1_t, sequence2_t>()) {
+            return standard_t::run(std::forward<sequence1_t>(sequence1),
+                                   std::forward<sequence2_t>(sequence2),
+                                   std::move(dp_column),
+                                   std::move(dp_row));
+        } else {
+            constexpr std::ptrdiff_t simd_size = simd_score<score_t>::size_v;
+            if (std::ranges::distance(sequence1) < simd_size || std::ranges::empty(sequence2))
+                return standard_t::run(std::forward<sequence1_t>(sequence1),
+                                       std::forward<sequence2_t>(sequence2),
+                                       std::move(dp_column),
+                                       std::move(dp_row));
+
+            // ----------------------------------------------------------------------------
+            // Initialisation
+            // ----------------------------------------------------------------------------
+
+            auto transformed_seq1 = base_t::initialise_column(sequence1, dp_column);
+            auto transformed_seq2 = base_t::initialise_row(sequence2, dp_row);
+
+            // The substitution model is not wrapped by the local matrix, since the profile stores the plain scores.
+            auto tracker = base_t::initialise_tracker();
+
+            // ----------------------------------------------------------------------------
+            // Recursion
+            // ----------------------------------------------------------------------------
+
+            compute_striped<score_t>(transformed_seq1,
+                                     transformed_seq2,
+                                     base_t::initialise_substitution_scheme(),
+                                     tracker);
+
+            // ----------------------------------------------------------------------------
+            // Create result
+            // ----------------------------------------------------------------------------
+
+            return base_t::make_result(std::move(tracker),
+                                       std::forward<sequence1_t>(sequence1),
+                                       std::forward<sequence2_t>(sequence2),
+                                       std::move(dp_column),
+                                       std::move(dp_row));
+        }
+    }
+
+private:
+
+    template <typename score_t, typename sequence1_t, typename sequence2_t>
+    static constexpr bool is_vectorisable() noexcept
+    {
+        using gap_model_t = decltype(algorithm_attorney_t::gap_setting(std::declval<algorithm_impl_t const &>()));
+
+        if constexpr (detail::max_simd_size > 1 && std::signed_integral<score_t> && sizeof(score_t) >= 4)
+            return std::same_as<gap_model_t, affine_gap_model<score_t>> &&
+                   std::convertible_to<std::ranges::range_value_t<sequence1_t>, score_t> &&
+                   std::convertible_to<std::ranges::range_value_t<sequence2_t>, score_t>;
+        else
+            return false;
+    }
+
+    /*!\brief Computes the columns of the local alignment and tracks the best score of every cell.
+     *
+     * The best scores of the current and the previous column as well as the horizontal gap scores are stored in
+     * striped order. The first cell of a column is computed from the last segment of the previous column shifted by
+     * one lane, which is also how the vertical gaps enter the next lane in the lazy-F loop.
+     */
+    template <typename score_t, typename sequence1_t, typename sequence2_t, typename scorer_t, typename tracker_t>
+    void compute_striped(sequence1_t const & sequence1,
+                         sequence2_t const & sequence2,
+                         scorer_t const & scorer,
+                         tracker_t & tracker) const
+    {
+        using simd_score_t = simd_score<score_t>;
+        constexpr std::ptrdiff_t simd_size = simd_score_t::size_v;
+
+        auto const [gap_open_score, gap_extension_score] = algorithm_attorney_t::gap_setting(as_algorithm());
+        score_t const gap_open_extension_score = gap_open_score + gap_extension_score;
+        score_t const infinity = std::numeric_limits<score_t>::lowest() / 2;
+
+        std::ptrdiff_t const row_count = std::ranges::distance(sequence1);
+        std::ptrdiff_t const segment_count = (row_count + simd_size - 1) / simd_size;
+        std::ptrdiff_t const segment_stride = segment_count * simd_size;
+
+        // The rows beyond the query are padded with a score, that never yields a positive cell.
+        std::ptrdiff_t const symbol_count = static_cast<std::ptrdiff_t>(std::ranges::max(sequence2 |
+            std::views::transform([] (auto const & symbol) { return static_cast<score_t>(symbol); }))) + 1;
+        std::vector<score_t> profile(symbol_count * segment_stride, infinity);
+        for (score_t symbol = 0; symbol < symbol_count; ++symbol) {
+            for (std::ptrdiff_t segment = 0; segment < segment_count; ++segment) {
+                for (std::ptrdiff_t lane = 0; lane < simd_size; ++lane) {
+                    if (std::ptrdiff_t const row = segment + lane * segment_count; row < row_count)
+                        profile[symbol * segment_stride + segment * simd_size + lane] =
+                            scorer.score(score_t{}, static_cast<score_t>(sequence1[row]), symbol);
+                }
+            }
+        }
+
+        std::vector<score_t> best_scores(segment_stride, score_t{});
+        std::vector<score_t> previous_best_scores(segment_stride, score_t{});
+        std::vector<score_t> horizontal_scores(segment_stride, infinity);
+
+        // Moves every lane to the next one and inserts the given score in the first lane.
+        std::array<score_t, simd_size + 1> shift_buffer{};
+        auto shift = [&shift_buffer] (simd_score_t const & vector, score_t const first_score) -> simd_score_t {
+            vector.store(shift_buffer.data() + 1);
+            shift_buffer[0] = first_score;
+            simd_score_t shifted_vector{};
+            shifted_vector.load(shift_buffer.data());
+            return shifted_vector;
+        };
+
+        // The segment and the column of the best score of every lane.
+        simd_score_t const zero{score_t{}};
+        simd_score_t max_scores{score_t{}};
+        simd_score_t max_segments{};
+        simd_score_t max_columns{};
+        score_t column = 0;
+        auto track = [&] (simd_score_t const & best, std::ptrdiff_t const position) {
+            auto const is_better = max_scores.lt(best);
+            max_scores = max(max_scores, best);
+            max_segments = blend(is_better, simd_score_t{static_cast<score_t>(position / simd_size)}, max_segments);
+            max_columns = blend(is_better, simd_score_t{column}, max_columns);
+        };
+
+        for (auto const & symbol : sequence2) {
+            ++column;
+            score_t const * symbol_profile = profile.data() + static_cast<score_t>(symbol) * segment_stride;
+
+            simd_score_t best{};
+            best.load(best_scores.data() + segment_stride - simd_size);
+            best = shift(best, score_t{});
+            std::swap(best_scores, previous_best_scores);
+
+            simd_score_t vertical{infinity};
+            for (std::ptrdiff_t position = 0; position < segment_stride; position += simd_size) {
+                simd_score_t substitution{};
+                simd_score_t horizontal{};
+                substitution.load(symbol_profile + position);
+                horizontal.load(horizontal_scores.data() + position);
+
+                best = max(max(max(best + substitution, horizontal), vertical), zero);
+                track(best, position);
+                best.store(best_scores.data() + position);
+
+                simd_score_t const open = best + gap_open_extension_score;
+                max(horizontal + gap_extension_score, open).store(horizontal_scores.data() + position);
+                vertical = max(vertical + gap_extension_score, open);
+
+                best.load(previous_best_scores.data() + position);
+            }
+
+            // Lazy-F loop: propagates the vertical gaps into the next lane until they can not improve any cell.
+            vertical = shift(vertical, infinity);
+            for (std::ptrdiff_t position = 0; ; ) {
+                simd_score_t best{};
+                best.load(best_scores.data() + position);
+
+                auto const improves_cell = (best + gap_open_score).lt(vertical);
+                bool any_improvement = false;
+                for (std::ptrdiff_t lane = 0; lane < simd_size; ++lane)
+                    any_improvement |= improves_cell[lane];
+
+                if (!any_improvement)
+                    break;
+
+                best = max(best, vertical);
+                track(best, position);
+                best.store(best_scores.data() + position);
+
+                simd_score_t horizontal{};
+                horizontal.load(horizontal_scores.data() + position);
+                max(horizontal, best + gap_open_extension_score).store(horizontal_scores.data() + position);
+
+                vertical = vertical + gap_extension_score;
+                if (position += simd_size; position == segment_stride) {
+                    position = 0;
+                    vertical = shift(vertical, infinity);
+                }
+            }
+        }
+
+        for (std::ptrdiff_t lane = 0; lane < simd_size; ++lane) {
+            tracker.move_to(max_segments[lane] + lane * segment_count + 1, max_columns[lane]);
+            tracker.track(max_scores[lane]);
+        }
+    }
+
+    constexpr algorithm_impl_t const & as_algorithm() const noexcept
+    {
+        return static_cast<algorithm_impl_t const &>(*this);
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -0,0 +1,344 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::dp_algorithm_template_suboptimal.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_attorney.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_base.hpp>
+#include <pairwise_aligner/result/aligner_result_suboptimal.hpp>
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
+#include <pairwise_aligner/result/suboptimal_alignment.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief Computes the non-overlapping local alignments of a single pair with the declumping of Waterman and Eggert.
+ *
+ * The scores of all three states are kept for every cell of the dp matrix, and the best cell of every region of
+ * consecutive diagonals is recorded. The alignment ending in the best cell of all regions is
+ * traced back and the cells of its aligned symbols are masked, such that no later alignment can align them again.
+ * Since masking only lowers scores, only the cells depending on the masked cells are recomputed, which stops as soon
+ * as a row does not change anymore, and only the regions whose best cell changed are scanned again. This is repeated
+ * until the configured number of alignments was found or no positive score remains.
+ * The dp column and the dp row keep their initial values.
+ */
+template <typename algorithm_impl_t>
+struct _dp_algorithm_template_suboptimal
+{
+    class type;
+};
+
+template <typename algorithm_impl_t>
+using dp_algorithm_template_suboptimal = typename _dp_algorithm_template_suboptimal<algorithm_impl_t>::type;
+
+template <typename algorithm_impl_t>
+class _dp_algorithm_template_suboptimal<algorithm_impl_t>::type : public dp_algorithm_template_base<algorithm_impl_t>
+{
+private:
+    using algorithm_attorney_t = dp_algorithm_attorney<algorithm_impl_t>;
+
+    //!\brief The number of consecutive diagonals that share one recorded best cell.
+    static constexpr std::ptrdiff_t region_width = 64;
+
+protected:
+
+    using base_t = dp_algorithm_template_base<algorithm_impl_t>;
+
+    template <typename sequence1_t, typename sequence2_t, typename dp_column_t, typename dp_row_t>
+    auto run(sequence1_t && sequence1, sequence2_t && sequence2, dp_column_t dp_column, dp_row_t dp_row) const
+    {
+        using score_t = typename std::remove_cvref_t<decltype(dp_column[0][0])>::score_type;
+
+        auto transformed_seq1 = base_t::initialise_column(sequence1, dp_column);
+        auto transformed_seq2 = base_t::initialise_row(sequence2, dp_row);
+
+        dp_state<score_t, decltype(transformed_seq1), decltype(transformed_seq2)> state{transformed_seq1,
+                                                                                        transformed_seq2};
+        auto const scorer = base_t::initialise_substitution_scheme();
+        size_t const alignment_count = algorithm_attorney_t::suboptimal_setting(as_algorithm()).alignment_count;
+
+        // ----------------------------------------------------------------------------
+        // Recursion
+        // ----------------------------------------------------------------------------
+
+        for (std::ptrdiff_t row = 1; row < state.row_count; ++row)
+            for (std::ptrdiff_t column = 1; column < state.column_count; ++column)
+                compute_cell(state, scorer, row, column);
+
+        for (std::ptrdiff_t region = 0; region < std::ranges::ssize(state.region_scores); ++region)
+            scan_region(state, region);
+
+        // ----------------------------------------------------------------------------
+        // Declumping
+        // ----------------------------------------------------------------------------
+
+        std::vector<suboptimal_alignment<score_t>> alignments{};
+        while (alignments.size() < alignment_count) {
+            auto const best_region = std::ranges::max_element(state.region_scores) - state.region_scores.begin();
+            if (state.region_scores.empty() || !(score_t{} < state.region_scores[best_region]))
+                break;
+
+            alignment_coordinate const end = state.region_cells[best_region];
+            alignment_coordinate const begin = mask_alignment(state, scorer, end);
+            alignments.push_back(suboptimal_alignment<score_t>{.score = state.region_scores[best_region],
+                                                               .begin_coordinate = begin,
+                                                               .end_coordinate = end});
+
+            if (alignments.size() < alignment_count)
+                recompute(state, scorer, begin, end);
+        }
+
+        // ----------------------------------------------------------------------------
+        // Create result
+        // ----------------------------------------------------------------------------
+
+        auto tracker = base_t::initialise_tracker();
+        tracker.move_to(0, 0);
+        tracker.track(score_t{});
+        if (!alignments.empty()) {
+            tracker.move_to(alignments[0].end_coordinate.sequence1_position,
+                            alignments[0].end_coordinate.sequence2_position);
+            tracker.track(alignments[0].score);
+        }
+
+        auto result = base_t::make_result(std::move(tracker),
+                                          std::forward<sequence1_t>(sequence1),
+                                          std::forward<sequence2_t>(sequence2),
+                                          std::move(dp_column),
+                                          std::move(dp_row));
+        return aligner_result_suboptimal<decltype(result), score_t>{std::move(result), std::move(alignments)};
+    }
+
+private:
+
+    // The scores of all cells, the masked cells and the best cell of every region of diagonals.
+    template <typename score_t, typename sequence1_t, typename sequence2_t>
+    struct dp_state
+    {
+        static constexpr score_t infinity = std::numeric_limits<score_t>::lowest() / 2;
+
+        std::vector<std::ranges::range_value_t<sequence1_t>> sequence1{};
+        std::vector<std::ranges::range_value_t<sequence2_t>> sequence2{};
+        std::ptrdiff_t row_count{};
+        std::ptrdiff_t column_count{};
+        std::vector<score_t> best_scores{};
+        std::vector<score_t> horizontal_scores{};
+        std::vector<score_t> vertical_scores{};
+        std::vector<bool> is_masked{};
+        std::vector<score_t> region_scores{};
+        std::vector<alignment_coordinate> region_cells{};
+
+        dp_state(sequence1_t & transformed_sequence1, sequence2_t & transformed_sequence2)
+        {
+            for (auto && symbol : transformed_sequence1)
+                sequence1.push_back(symbol);
+            for (auto && symbol : transformed_sequence2)
+                sequence2.push_back(symbol);
+
+            row_count = std::ranges::ssize(sequence1) + 1;
+            column_count = std::ranges::ssize(sequence2) + 1;
+            best_scores.resize(row_count * column_count, score_t{});
+            horizontal_scores.resize(row_count * column_count, infinity);
+            vertical_scores.resize(row_count * column_count, infinity);
+            is_masked.resize(row_count * column_count, false);
+
+            // The diagonal j - i of the cell (i, j) belongs to the region (j - i + |seq1|) / region_width.
+            std::ptrdiff_t const region_count = (row_count + column_count - 3) / region_width + 1;
+            region_scores.resize((row_count > 1 && column_count > 1) ? region_count : 0, score_t{});
+            region_cells.resize(region_scores.size());
+        }
+
+        std::ptrdiff_t index(std::ptrdiff_t const row, std::ptrdiff_t const column) const noexcept
+        {
+            return row * column_count + column;
+        }
+
+        std::ptrdiff_t region(std::ptrdiff_t const row, std::ptrdiff_t const column) const noexcept
+        {
+            return (column - row + row_count - 1) / region_width;
+        }
+    };
+
+    // Computes the three states of the cell and returns whether any of them changed.
+    template <typename state_t, typename scorer_t>
+    bool compute_cell(state_t & state,
+                      scorer_t const & scorer,
+                      std::ptrdiff_t const row,
+                      std::ptrdiff_t const column) const noexcept
+    {
+        using score_t = std::ranges::range_value_t<decltype(state.best_scores)>;
+
+        auto const [gap_open_score, gap_extension_score] = algorithm_attorney_t::gap_setting(as_algorithm());
+        score_t const gap_open_extension_score = gap_open_score + gap_extension_score;
+
+        std::ptrdiff_t const cell = state.index(row, column);
+        std::ptrdiff_t const left = cell - 1;
+        std::ptrdiff_t const up = cell - state.column_count;
+
+        score_t const horizontal = std::max<score_t>(state.best_scores[left] + gap_open_extension_score,
+                                                     state.horizontal_scores[left] + gap_extension_score);
+        score_t const vertical = std::max<score_t>(state.best_scores[up] + gap_open_extension_score,
+                                                   state.vertical_scores[up] + gap_extension_score);
+        score_t best = std::max<score_t>({score_t{}, horizontal, vertical});
+        if (!state.is_masked[cell])
+            best = std::max<score_t>(best, scorer.score(state.best_scores[up - 1],
+                                                        state.sequence1[row - 1],
+                                                        state.sequence2[column - 1]));
+
+        bool const has_changed = state.best_scores[cell] != best ||
+                                 state.horizontal_scores[cell] != horizontal ||
+                                 state.vertical_scores[cell] != vertical;
+        state.best_scores[cell] = best;
+        state.horizontal_scores[cell] = horizontal;
+        state.vertical_scores[cell] = vertical;
+        return has_changed;
+    }
+
+    // Records the first cell with the best score of all cells on the diagonals of the region.
+    template <typename state_t>
+    void scan_region(state_t & state, std::ptrdiff_t const region) const noexcept
+    {
+        std::ptrdiff_t const first_diagonal = region * region_width - (state.row_count - 1);
+        state.region_scores[region] = 0;
+        state.region_cells[region] = alignment_coordinate{};
+
+        for (std::ptrdiff_t row = 1; row < state.row_count; ++row) {
+            std::ptrdiff_t const first_column = std::max<std::ptrdiff_t>(1, first_diagonal + row);
+            std::ptrdiff_t const last_column = std::min(state.column_count - 1,
+                                                        first_diagonal + region_width - 1 + row);
+            for (std::ptrdiff_t column = first_column; column <= last_column; ++column) {
+                if (state.region_scores[region] < state.best_scores[state.index(row, column)]) {
+                    state.region_scores[region] = state.best_scores[state.index(row, column)];
+                    state.region_cells[region] =
+                        alignment_coordinate{.sequence1_position = static_cast<size_t>(row),
+                                             .sequence2_position = static_cast<size_t>(column)};
+                }
+            }
+        }
+    }
+
+    // Traces the alignment back from its end, masks the cells of its aligned symbols and returns its begin.
+    template <typename state_t, typename scorer_t>
+    alignment_coordinate mask_alignment(state_t & state,
+                                        scorer_t const & scorer,
+                                        alignment_coordinate const & end) const noexcept
+    {
+        auto const [gap_open_score, gap_extension_score] = algorithm_attorney_t::gap_setting(as_algorithm());
+
+        enum struct trace_state { best, horizontal, vertical };
+
+        std::ptrdiff_t row = end.sequence1_position;
+        std::ptrdiff_t column = end.sequence2_position;
+        trace_state current = trace_state::best;
+        while (true) {
+            std::ptrdiff_t const cell = state.index(row, column);
+            if (current == trace_state::horizontal) {
+                if (state.horizontal_scores[cell] ==
+                    state.best_scores[cell - 1] + gap_open_score + gap_extension_score)
+                    current = trace_state::best;
+                --column;
+            } else if (current == trace_state::vertical) {
+                if (state.vertical_scores[cell] ==
+                    state.best_scores[cell - state.column_count] + gap_open_score + gap_extension_score)
+                    current = trace_state::best;
+                --row;
+            } else if (state.best_scores[cell] == 0) {
+                break;
+            } else if (!state.is_masked[cell] &&
+                       state.best_scores[cell] == scorer.score(state.best_scores[cell - state.column_count - 1],
+                                                               state.sequence1[row - 1],
+                                                               state.sequence2[column - 1])) {
+                state.is_masked[cell] = true;
+                --row;
+                --column;
+            } else {
+                current = (state.best_scores[cell] == state.horizontal_scores[cell]) ? trace_state::horizontal
+                                                                                   : trace_state::vertical;
+            }
+        }
+
+        return alignment_coordinate{.sequence1_position = static_cast<size_t>(row),
+                                    .sequence2_position = static_cast<size_t>(column)};
+    }
+
+    /*!\brief Recomputes the cells depending on the masked cells of the alignment between begin and end.
+     *
+     * A cell depends on its left, upper and upper left neighbour. Hence, a row is recomputed from the first column,
+     * whose upper or upper left neighbour changed, until a cell did not change and neither the cells of the previous
+     * row nor the masked cells reach further to the right.
+     */
+    template <typename state_t, typename scorer_t>
+    void recompute(state_t & state,
+                   scorer_t const & scorer,
+                   alignment_coordinate const & begin,
+                   alignment_coordinate const & end) const noexcept
+    {
+        std::ptrdiff_t const first_row = begin.sequence1_position + 1;
+        std::ptrdiff_t const last_masked_row = end.sequence1_position;
+        std::ptrdiff_t const first_masked_column = begin.sequence2_position + 1;
+        std::ptrdiff_t const last_masked_column = end.sequence2_position;
+
+        std::vector<bool> is_dirty_region(state.region_scores.size(), false);
+        std::ptrdiff_t changed_first = state.column_count;
+        std::ptrdiff_t changed_last = 0;
+        for (std::ptrdiff_t row = first_row; row < state.row_count; ++row) {
+            std::ptrdiff_t first_column = changed_first;
+            std::ptrdiff_t last_column = changed_last + 1;
+            if (row <= last_masked_row) {
+                first_column = std::min(first_column, first_masked_column);
+                last_column = std::max(last_column, last_masked_column);
+            }
+
+            if (first_column >= state.column_count)
+                break;
+
+            changed_first = state.column_count;
+            changed_last = 0;
+            for (std::ptrdiff_t column = first_column; column < state.column_count; ++column) {
+                bool const has_changed = compute_cell(state, scorer, row, column);
+                if (has_changed) {
+                    changed_first = std::min(changed_first, column);
+                    changed_last = column;
+
+                    std::ptrdiff_t const region = state.region(row, column);
+                    is_dirty_region[region] = is_dirty_region[region] ||
+                                              (state.region_cells[region] ==
+                                               alignment_coordinate{.sequence1_position = static_cast<size_t>(row),
+                                                                    .sequence2_position = static_cast<size_t>(column)});
+                } else if (column >= last_column) {
+                    break;
+                }
+            }
+        }
+
+        for (std::ptrdiff_t region = 0; region < std::ranges::ssize(is_dirty_region); ++region)
+            if (is_dirty_region[region])
+                scan_region(state, region);
+    }
+
+    constexpr algorithm_impl_t const & as_algorithm() const noexcept
+    {
+        return static_cast<algorithm_impl_t const &>(*this);
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -0,0 +1,202 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::dp_algorithm_template_traceback.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <ranges>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <pairwise_aligner/configuration/end_gap_policy.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_attorney.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_template_base.hpp>
+#include <pairwise_aligner/matrix/dp_matrix_cpo.hpp>
+#include <pairwise_aligner/matrix/dp_trace_matrix.hpp>
+#include <pairwise_aligner/result/aligner_result_alignment.hpp>
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
+#include <pairwise_aligner/simd/concept.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief Computes the dp matrix like seqan::pairwise_aligner::dp_algorithm_template_standard, but additionally
+ *        records the trace codes of every cell and lane to output the alignments.
+ *
+ * The trace codes are recorded in a seqan::pairwise_aligner::dp_trace_matrix, which is traced back for every lane
+ * after the matrix was computed. The trace back starts in the cell of the optimal score reported by the tracker,
+ * i.e. the last cell of the lane if the trailing gaps are penalised, a cell of the last row or column if they are
+ * free, and any cell for local alignments. Local alignments end in the cell whose score was reset to zero.
+ */
+template <typename algorithm_impl_t>
+struct _dp_algorithm_template_traceback
+{
+    class type;
+};
+
+template <typename algorithm_impl_t>
+using dp_algorithm_template_traceback = typename _dp_algorithm_template_traceback<algorithm_impl_t>::type;
+
+template <typename algorithm_impl_t>
+class _dp_algorithm_template_traceback<algorithm_impl_t>::type : public dp_algorithm_template_base<algorithm_impl_t>
+{
+private:
+    using algorithm_attorney_t = dp_algorithm_attorney<algorithm_impl_t>;
+
+protected:
+
+    using base_t = dp_algorithm_template_base<algorithm_impl_t>;
+
+    template <typename sequence1_t, typename sequence2_t, typename dp_column_t, typename dp_row_t>
+    auto run(sequence1_t && sequence1, sequence2_t && sequence2, dp_column_t dp_column, dp_row_t dp_row) const
+    {
+        // ----------------------------------------------------------------------------
+        // Initialisation
+        // ----------------------------------------------------------------------------
+
+        auto transformed_seq1 = base_t::initialise_column(sequence1, dp_column);
+        auto transformed_seq2 = base_t::initialise_row(sequence2, dp_row);
+
+        auto matrix = base_t::initialise_dp_matrix(dp_column, dp_row, transformed_seq1, transformed_seq2);
+
+        using dp_matrix_column_t = decltype(dp_matrix::column_at(matrix, 0));
+        using dp_block_t = decltype(dp_matrix::row_at(std::declval<dp_matrix_column_t &>(), 0));
+        using dp_cell_t = std::remove_cvref_t<decltype(dp_matrix::dp_column(std::declval<dp_block_t &>())[0])>;
+        using score_t = typename dp_cell_t::score_type;
+
+        static_assert(simd::simd_type<score_t>, "The alignment output is only supported for simd score types.");
+
+        dp_trace_matrix<score_t> trace_matrix{};
+        trace_matrix.reset(std::ranges::distance(transformed_seq1) + 1, std::ranges::distance(transformed_seq2) + 1);
+
+        // ----------------------------------------------------------------------------
+        // Recursion
+        // ----------------------------------------------------------------------------
+
+        std::ptrdiff_t column_offset = 0;
+        for (std::ptrdiff_t column_idx = 0; column_idx < dp_matrix::column_count(matrix); ++column_idx) {
+            auto current_column = dp_matrix::column_at(matrix, column_idx);
+            std::ptrdiff_t row_offset = 0;
+            std::ptrdiff_t column_width = 0;
+            for (std::ptrdiff_t row_idx = 0; row_idx < dp_matrix::row_count(current_column); ++row_idx) {
+                auto dp_block = dp_matrix::row_at(current_column, row_idx);
+                compute_block(dp_block, trace_matrix, row_offset, column_offset);
+                row_offset += std::ranges::distance(dp_matrix::column_sequence(dp_block));
+                column_width = std::ranges::distance(dp_matrix::row_sequence(dp_block));
+            }
+            column_offset += column_width;
+        }
+
+        // ----------------------------------------------------------------------------
+        // Traceback
+        // ----------------------------------------------------------------------------
+
+        cfg::leading_end_gap const leading_gap = algorithm_attorney_t::leading_gap_setting(as_algorithm());
+        auto const optimal_coordinate = dp_matrix::tracker(matrix).optimal_coordinate(sequence1,
+                                                                                      sequence2,
+                                                                                      dp_column,
+                                                                                      dp_row);
+        size_t const lane_count = std::ranges::distance(sequence2);
+        std::vector<std::string> cigar{};
+        std::vector<alignment_coordinate> begin_coordinate{};
+        std::vector<alignment_coordinate> end_coordinate{};
+
+        for (size_t lane = 0; lane < lane_count; ++lane) {
+            alignment_coordinate coordinate = optimal_coordinate[lane];
+            end_coordinate.push_back(coordinate);
+            cigar.push_back(trace_matrix.trace_back(lane, coordinate, leading_gap));
+            begin_coordinate.push_back(coordinate);
+        }
+
+        // ----------------------------------------------------------------------------
+        // Create result
+        // ----------------------------------------------------------------------------
+
+        auto result = base_t::make_result(std::move(dp_matrix::tracker(matrix)),
+                                          std::forward<sequence1_t>(sequence1),
+                                          std::forward<sequence2_t>(sequence2),
+                                          std::move(dp_column),
+                                          std::move(dp_row));
+
+        return aligner_result_alignment<decltype(result)>{std::move(result),
+                                                          std::move(cigar),
+                                                          std::move(begin_coordinate),
+                                                          std::move(end_coordinate)};
+    }
+
+private:
+
+    template <typename dp_block_t, typename trace_matrix_t>
+    void compute_block(dp_block_t && dp_block,
+                       trace_matrix_t & trace_matrix,
+                       std::ptrdiff_t const row_offset,
+                       std::ptrdiff_t const column_offset) const noexcept
+    {
+        constexpr std::ptrdiff_t lane_width = std::remove_reference_t<dp_block_t>::lane_width;
+        auto && tracker = dp_matrix::tracker(dp_block);
+        auto && scorer = dp_matrix::substitution_model(dp_block);
+
+        std::ptrdiff_t const lane_count = dp_matrix::column_count(dp_block);
+        for (std::ptrdiff_t lane_index = 0; lane_index < lane_count - 1; ++lane_index) {
+            auto dp_lane = dp_matrix::column_at(dp_block, lane_index);
+            compute_lane(dp_lane, scorer, tracker, trace_matrix, row_offset, column_offset + lane_index * lane_width);
+        }
+
+        auto final_dp_lane = dp_block.final_lane();
+        compute_lane(final_dp_lane,
+                     scorer,
+                     tracker,
+                     trace_matrix,
+                     row_offset,
+                     column_offset + (lane_count - 1) * lane_width);
+    }
+
+    template <typename dp_lane_t, typename scorer_t, typename tracker_t, typename trace_matrix_t>
+    void compute_lane(dp_lane_t & dp_lane,
+                      scorer_t const & scorer,
+                      tracker_t & tracker,
+                      trace_matrix_t & trace_matrix,
+                      std::ptrdiff_t const row_offset,
+                      std::ptrdiff_t const column_offset) const noexcept
+    {
+        auto && seq2_slice = dp_matrix::row_sequence(dp_lane);
+        std::ptrdiff_t const lane_size = std::ranges::distance(seq2_slice);
+        typename trace_matrix_t::score_type trace{};
+
+        for (std::ptrdiff_t i = 0; i < dp_matrix::row_count(dp_lane); ++i) {
+            auto cacheH = dp_matrix::dp_column(dp_lane)[i+1];
+            tracker.move_to(row_offset + i + 1, column_offset + 1);
+            for (std::ptrdiff_t idx = 0; idx < lane_size; ++idx) {
+                algorithm_attorney_t::compute_cell(as_algorithm(),
+                                                   dp_matrix::dp_row(dp_lane)[idx],
+                                                   cacheH,
+                                                   scorer,
+                                                   tracker,
+                                                   dp_matrix::column_sequence(dp_lane)[i],
+                                                   seq2_slice[idx],
+                                                   trace);
+                trace_matrix.record(row_offset + i + 1, column_offset + idx + 1, trace);
+            }
+            dp_matrix::dp_column(dp_lane)[i+1] = cacheH;
+        }
+    }
+
+    constexpr algorithm_impl_t const & as_algorithm() const noexcept
+    {
+        return static_cast<algorithm_impl_t const &>(*this);
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -0,0 +1,95 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::dual_affine_cell.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <concepts>
+#include <tuple>
+#include <utility>
+
+#include <pairwise_aligner/type_traits.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+// Stores the best score followed by the gap score of the first and the second affine piece.
+template <typename score_t, dp_vector_order order>
+struct dual_affine_cell : public dp_cell_base<order>,
+                          public std::tuple<score_t, score_t, score_t>
+{
+    using base_t = std::tuple<score_t, score_t, score_t>;
+    using score_type = score_t;
+
+    using base_t::base_t;
+
+    dual_affine_cell() = default;
+
+    template <typename other_score_t>
+        requires std::constructible_from<score_t, other_score_t const &>
+    explicit dual_affine_cell(dual_affine_cell<other_score_t, order> const & other_cell) :
+        base_t{static_cast<typename dual_affine_cell<other_score_t, order>::base_t const &>(other_cell)}
+    {}
+
+    template <typename other_score_t>
+        requires std::constructible_from<score_t, other_score_t>
+    explicit dual_affine_cell(dual_affine_cell<other_score_t, order> && other_cell) :
+        base_t{static_cast<typename dual_affine_cell<other_score_t, order>::base_t &&>(other_cell)}
+    {}
+
+    template <typename other_score_t>
+        requires std::assignable_from<score_t &, other_score_t const &>
+    dual_affine_cell & operator=(dual_affine_cell<other_score_t, order> const & other_cell)
+    {
+        static_cast<base_t &>(*this) = static_cast<typename dual_affine_cell<other_score_t, order>::base_t const &>(
+                                            other_cell);
+        return *this;
+    }
+
+    template <typename other_score_t>
+        requires std::assignable_from<score_t &, other_score_t>
+    dual_affine_cell & operator=(dual_affine_cell<other_score_t, order> && other_cell)
+    {
+        static_cast<base_t &>(*this) = static_cast<typename dual_affine_cell<other_score_t, order>::base_t &&>(
+                                            other_cell);
+        return *this;
+    }
+
+    constexpr score_t & score() noexcept
+    {
+        return std::get<0>(static_cast<base_t &>(*this));
+    }
+
+    constexpr score_t const & score() const noexcept
+    {
+        return std::get<0>(static_cast<base_t const &>(*this));
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
+
+namespace std
+{
+
+template <typename score_t, seqan::pairwise_aligner::dp_vector_order order>
+struct tuple_size<seqan::pairwise_aligner::dual_affine_cell<score_t, order>> :
+    tuple_size<typename seqan::pairwise_aligner::dual_affine_cell<score_t, order>::base_t>
+{};
+
+template <size_t idx, typename score_t, seqan::pairwise_aligner::dp_vector_order order>
+struct tuple_element<idx, seqan::pairwise_aligner::dual_affine_cell<score_t, order>> :
+    tuple_element<idx, typename seqan::pairwise_aligner::dual_affine_cell<score_t, order>::base_t>
+{};
+
+} // namespace std
@@ -0,0 +1,168 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::dual_affine_dp_algorithm.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <functional>
+#include <ranges>
+#include <type_traits>
+
+#include <pairwise_aligner/configuration/band_policy.hpp>
+#include <pairwise_aligner/configuration/end_gap_policy.hpp>
+#include <pairwise_aligner/configuration/score_threshold_policy.hpp>
+#include <pairwise_aligner/dp_algorithm_template/dp_algorithm_attorney.hpp>
+#include <pairwise_aligner/dual_affine/dual_affine_gap_model.hpp>
+#include <pairwise_aligner/dual_affine/dual_affine_initialisation_strategy.hpp>
+#include <pairwise_aligner/utility/math.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+template <template <typename> typename dp_template,
+          typename ...policies_t>
+class dual_affine_dp_algorithm : public dp_template<dual_affine_dp_algorithm<dp_template, policies_t...>>, // crtp-base
+                                 protected policies_t... // policies
+{
+private:
+
+    using base_t = dp_template<dual_affine_dp_algorithm<dp_template, policies_t...>>;
+
+    friend class dp_algorithm_attorney<dual_affine_dp_algorithm<dp_template, policies_t...>>;
+
+public:
+    dual_affine_dp_algorithm() = default;
+
+    explicit dual_affine_dp_algorithm(policies_t const & ...policies) : base_t{}, policies_t{policies}...
+    {}
+
+protected:
+
+    template <std::ranges::viewable_range sequence_t, typename dp_vector_t>
+        requires std::ranges::forward_range<sequence_t>
+    auto initialise_row_vector(sequence_t && sequence, dp_vector_t & dp_vector) const
+    {
+        using init_t = dual_affine_initialisation_strategy<dp_vector_order::row, decltype(gap_setting())>;
+
+        return dp_vector.initialise(std::forward<sequence_t>(sequence), init_t{gap_setting(), this->first_row});
+    }
+
+    template <std::ranges::viewable_range sequence_t, typename dp_vector_t>
+        requires std::ranges::forward_range<sequence_t>
+    auto initialise_column_vector(sequence_t && sequence, dp_vector_t & dp_vector) const
+    {
+        using init_t = dual_affine_initialisation_strategy<dp_vector_order::column, decltype(gap_setting())>;
+
+        return dp_vector.initialise(std::forward<sequence_t>(sequence), init_t{gap_setting(), this->first_column});
+    }
+
+    template <typename ...args_t>
+    constexpr auto initialise_substitution_scheme(args_t && ...args) const noexcept
+    {
+        return this->make_substitution_scheme(std::forward<args_t>(args)...);
+    }
+
+    template <typename ...args_t>
+    constexpr auto initialise_tracker(args_t && ...args) const noexcept
+    {
+        return this->make_tracker(std::forward<args_t>(args)...);
+    }
+
+    template <typename ...args_t>
+    constexpr auto initialise_policies(args_t && ...args) const noexcept
+    {
+        return this->make_policies(std::forward<args_t>(args)...);
+    }
+
+    template <typename ...args_t>
+    constexpr auto make_result(args_t && ...args) const noexcept
+    {
+        return this->operator()(std::forward<args_t>(args)..., this->last_column, this->last_row);
+    }
+
+    constexpr auto lane_width() const noexcept
+    {
+        return this->make_lane_width();
+    }
+
+    constexpr cfg::leading_end_gap leading_gap_setting() const noexcept
+    {
+        return cfg::leading_end_gap{.first_column = this->first_column, .first_row = this->first_row};
+    }
+
+    constexpr cfg::trailing_end_gap trailing_gap_setting() const noexcept
+    {
+        return cfg::trailing_end_gap{.last_column = this->last_column, .last_row = this->last_row};
+    }
+
+    constexpr auto band_setting() const noexcept
+    {
+        if constexpr (requires { this->band_width; })
+            return cfg::adaptive_band{.band_width = this->band_width};
+        else
+            return cfg::static_band{.lower_diagonal = this->lower_diagonal, .upper_diagonal = this->upper_diagonal};
+    }
+
+    constexpr auto score_threshold_setting() const noexcept
+    {
+        if constexpr (requires { this->threshold; })
+            return cfg::score_threshold_policy{.threshold = this->threshold,
+                                               .max_substitution_score = this->max_substitution_score};
+        else
+            return cfg::no_score_threshold{};
+    }
+
+    constexpr auto gap_setting() const noexcept
+    {
+        return dual_affine_gap_model<decltype(this->gap_open_score)>{this->gap_open_score,
+                                                                     this->gap_extension_score,
+                                                                     this->long_gap_open_score,
+                                                                     this->long_gap_extension_score};
+    }
+
+    // Same as the affine kernel, but every gap is tracked in one gap score per affine piece.
+    template <typename cache_t,
+              typename dp_cell_t,
+              typename scorer_t,
+              typename tracker_t,
+              typename seq1_val_t,
+              typename seq2_val_t>
+    constexpr auto compute_cell(cache_t & cache,
+                                dp_cell_t & column_cell,
+                                scorer_t & scorer,
+                                tracker_t & tracker,
+                                [[maybe_unused]] seq1_val_t const & seq1_val,
+                                [[maybe_unused]] seq2_val_t const & seq2_val) const noexcept
+    {
+        using std::max;
+        using score_t = typename dp_cell_t::score_type;
+
+        score_t best = scorer.score(get<0>(cache), seq1_val, seq2_val);
+        best = max(max(best, get<1>(cache)), get<1>(column_cell));
+        best = max(max(best, get<2>(cache)), get<2>(column_cell));
+        get<0>(cache) = get<0>(column_cell); // cache next diagonal score!
+        get<0>(column_cell) = tracker.track(best);
+
+        score_t const open = add(best, (this->gap_open_score + this->gap_extension_score));
+        get<1>(cache) = max(static_cast<score_t>(add(get<1>(cache), this->gap_extension_score)), open);
+        get<1>(column_cell) = max(static_cast<score_t>(add(get<1>(column_cell), this->gap_extension_score)), open);
+
+        score_t const long_open = add(best, (this->long_gap_open_score + this->long_gap_extension_score));
+        get<2>(cache) = max(static_cast<score_t>(add(get<2>(cache), this->long_gap_extension_score)), long_open);
+        get<2>(column_cell) = max(static_cast<score_t>(add(get<2>(column_cell), this->long_gap_extension_score)),
+                                  long_open);
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -0,0 +1,31 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::dual_affine_gap_model.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+// A gap scores the better one of the two affine pieces, where the second piece is meant for long gaps.
+template <typename score_t>
+struct dual_affine_gap_model
+{
+    score_t gap_open_score{};
+    score_t gap_extension_score{};
+    score_t long_gap_open_score{};
+    score_t long_gap_extension_score{};
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
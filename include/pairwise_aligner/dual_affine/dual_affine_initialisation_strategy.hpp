@@ -0,0 +1,66 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::dual_affine_initialisation_strategy.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+
+#include <pairwise_aligner/configuration/end_gap_policy.hpp>
+#include <pairwise_aligner/dual_affine/dual_affine_cell.hpp>
+#include <pairwise_aligner/type_traits.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+template <dp_vector_order order, typename dual_affine_gap_model_t>
+struct dual_affine_initialisation_strategy
+{
+    dual_affine_gap_model_t _gap_model;
+    cfg::end_gap _rule;
+
+    template <typename score_t>
+    struct _op
+    {
+        using cell_t = dual_affine_cell<score_t, order>;
+
+        dual_affine_gap_model_t _gap_model;
+        cfg::end_gap _rule;
+
+        constexpr cell_t operator()(size_t const index) const noexcept
+        {
+            // Both gap scores of every cell open a new gap from its best score, which is the better piece of the
+            // end gap if it is penalised.
+            auto [gap_open, gap_extension, long_gap_open, long_gap_extension] = _gap_model;
+            score_t best{0};
+            if (_rule == cfg::end_gap::penalised && index > 0) {
+                using gap_score_t = decltype(gap_open);
+                gap_score_t const gap_size = static_cast<gap_score_t>(index);
+                best = static_cast<score_t>(std::max<gap_score_t>(gap_open + gap_extension * gap_size,
+                                                                  long_gap_open + long_gap_extension * gap_size));
+            }
+
+            return cell_t{best,
+                          static_cast<score_t>(best + (gap_open + gap_extension)),
+                          static_cast<score_t>(best + (long_gap_open + long_gap_extension))};
+        }
+    };
+
+    template <typename score_t>
+    constexpr _op<score_t> create() const noexcept
+    {
+        return _op<score_t>{_gap_model, _rule};
+    }
+};
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -0,0 +1,318 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::edit_distance_algorithm.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <pairwise_aligner/configuration/end_gap_policy.hpp>
+#include <pairwise_aligner/result/aligner_result.hpp>
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
+#include <pairwise_aligner/simd/simd_score_type.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief Computes the unit cost edit distance of a bulk of pairs with the bit-parallel algorithm of Myers.
+ *
+ * The rows of the first sequence are encoded in blocks of 64 bits, which store the vertical differences of a dp
+ * column, and a column is computed with a few bit operations per block as described by Hyyrö for long patterns.
+ * Every lane of a simd vector of 64 bit words computes another pair of the bulk.
+ * The score is the negated edit distance, i.e. the same as with a match score of 0 and a mismatch and a gap score
+ * of -1. Only the score is computed, i.e. the dp column and the dp row keep their initial values.
+ */
+template <typename ...policies_t>
+struct _edit_distance_algorithm
+{
+    class type;
+};
+
+template <typename ...policies_t>
+using edit_distance_algorithm = typename _edit_distance_algorithm<policies_t...>::type;
+
+template <typename ...policies_t>
+class _edit_distance_algorithm<policies_t...>::type : protected policies_t...
+{
+protected:
+
+    using word_type = simd_score<uint64_t>;
+    using distance_type = simd_score<int64_t, word_type::size_v>;
+
+    static constexpr size_t word_size = 64;
+
+public:
+
+    //!\brief The number of pairs computed at once.
+    static constexpr size_t lane_count = word_type::size_v;
+
+    type() = default;
+    explicit type(policies_t const & ...policies) : policies_t{policies}...
+    {}
+
+protected:
+
+    template <typename sequences1_t, typename sequences2_t, typename dp_column_t, typename dp_row_t>
+    auto run(sequences1_t && sequences1, sequences2_t && sequences2, dp_column_t dp_column, dp_row_t dp_row) const
+    {
+        using symbol_t = std::ranges::range_value_t<std::ranges::range_reference_t<sequences1_t>>;
+        static_assert(std::convertible_to<symbol_t, uint8_t>,
+                      "The edit distance requires symbols that are convertible to uint8_t!");
+
+        if (!has_unit_gap_cost())
+            throw std::invalid_argument{"The edit distance requires a gap score of -1 per gap position."};
+
+        size_t const pair_count = std::ranges::distance(sequences1);
+        assert(pair_count <= lane_count);
+        assert(static_cast<size_t>(std::ranges::distance(sequences2)) == pair_count);
+
+        std::array<size_t, lane_count> sizes1{};
+        std::array<size_t, lane_count> sizes2{};
+        for (size_t lane = 0; lane < pair_count; ++lane) {
+            sizes1[lane] = std::ranges::distance(sequences1[lane]);
+            sizes2[lane] = std::ranges::distance(sequences2[lane]);
+        }
+
+        std::array<int32_t, lane_count> scores{};
+        auto [distances, end_coordinate] = compute_distances(sequences1, sequences2, sizes1, sizes2);
+        for (size_t lane = 0; lane < pair_count; ++lane)
+            scores[lane] = -static_cast<int32_t>(distances[lane]);
+
+        return aligner_result(std::forward<sequences1_t>(sequences1),
+                              std::forward<sequences2_t>(sequences2),
+                              std::move(dp_column),
+                              std::move(dp_row),
+                              std::move(scores),
+                              std::move(end_coordinate));
+    }
+
+private:
+
+    // The gap model is either the linear one or the affine one without a gap open score.
+    constexpr bool has_unit_gap_cost() const noexcept
+    {
+        if constexpr (requires { this->gap_open_score; })
+            return this->gap_open_score == 0 && this->gap_extension_score == -1;
+        else
+            return this->gap_score == -1;
+    }
+
+    // Returns the distance of every lane and the cell it was found in.
+    template <typename sequences1_t, typename sequences2_t>
+    std::pair<std::array<int64_t, lane_count>, std::array<alignment_coordinate, lane_count>> compute_distances(sequences1_t const & sequences1,
+                                                      sequences2_t const & sequences2,
+                                                      std::array<size_t, lane_count> const & sizes1,
+                                                      std::array<size_t, lane_count> const & sizes2) const
+    {
+        size_t const pair_count = std::ranges::distance(sequences1);
+        size_t const max_size1 = std::ranges::max(sizes1);
+        size_t const max_size2 = std::ranges::max(sizes2);
+        size_t const block_count = (max_size1 + word_size - 1) / word_size;
+
+        bool const penalised_first_column = this->first_column == cfg::end_gap::penalised;
+        bool const penalised_first_row = this->first_row == cfg::end_gap::penalised;
+        bool const free_last_column = this->last_column == cfg::end_gap::free;
+        bool const free_last_row = this->last_row == cfg::end_gap::free;
+
+        // ----------------------------------------------------------------------------
+        // Initialisation
+        // ----------------------------------------------------------------------------
+
+        // The pattern masks store the rows matching a symbol at [symbol][block][lane].
+        constexpr size_t symbol_count = 256;
+        std::vector<uint64_t> pattern_masks(symbol_count * block_count * lane_count, 0);
+        for (size_t lane = 0; lane < pair_count; ++lane) {
+            size_t row = 0;
+            for (auto const & symbol : sequences1[lane]) {
+                size_t const block = row / word_size;
+                pattern_masks[(static_cast<uint8_t>(symbol) * block_count + block) * lane_count + lane] |=
+                    uint64_t{1} << (row % word_size);
+                ++row;
+            }
+        }
+
+        // The symbols of the column j of all lanes are stored at [j][lane].
+        std::vector<uint8_t> symbols2(max_size2 * lane_count, 0);
+        for (size_t lane = 0; lane < pair_count; ++lane) {
+            size_t column = 0;
+            for (auto const & symbol : sequences2[lane])
+                symbols2[column++ * lane_count + lane] = static_cast<uint8_t>(symbol);
+        }
+
+        // Marks the bit of the last row of every lane in the block containing it.
+        std::vector<word_type> last_row_masks(block_count, word_type{uint64_t{0}});
+        std::vector<bool> has_last_row(block_count, false);
+        for (size_t lane = 0; lane < pair_count; ++lane) {
+            if (sizes1[lane] == 0)
+                continue;
+
+            size_t const block = (sizes1[lane] - 1) / word_size;
+            last_row_masks[block][lane] = uint64_t{1} << ((sizes1[lane] - 1) % word_size);
+            has_last_row[block] = true;
+        }
+
+        word_type const zero{uint64_t{0}};
+        word_type const all_ones{std::numeric_limits<uint64_t>::max()};
+
+        // The vertical differences of the first column are +1 if it is penalised and 0 otherwise.
+        std::vector<word_type> positive_vertical(block_count, penalised_first_column ? all_ones : zero);
+        std::vector<word_type> negative_vertical(block_count, zero);
+
+        distance_type distance{};
+        distance_type size2{};
+        for (size_t lane = 0; lane < pair_count; ++lane) {
+            distance[lane] = penalised_first_column ? sizes1[lane] : 0;
+            size2[lane] = sizes2[lane];
+        }
+
+        distance_type last_distance = distance; // The distance in the last row and the last column.
+        distance_type best_last_row_distance = distance;
+        distance_type best_last_row_column{};
+        std::vector<word_type> last_positive_vertical = positive_vertical;
+        std::vector<word_type> last_negative_vertical = negative_vertical;
+
+        // The horizontal difference entering the first block, which is +1 if the first row is penalised.
+        word_type const first_row_difference{uint64_t{penalised_first_row}};
+        std::array<uint64_t, lane_count> equal_buffer{};
+
+        // ----------------------------------------------------------------------------
+        // Recursion
+        // ----------------------------------------------------------------------------
+
+        for (size_t column = 1; column <= max_size2; ++column) {
+            uint8_t const * column_symbols = symbols2.data() + (column - 1) * lane_count;
+
+            word_type positive_horizontal_in = first_row_difference;
+            word_type negative_horizontal_in = zero;
+            for (size_t block = 0; block < block_count; ++block) {
+                for (size_t lane = 0; lane < lane_count; ++lane)
+                    equal_buffer[lane] =
+                        pattern_masks[(column_symbols[lane] * block_count + block) * lane_count + lane];
+
+                word_type equal{};
+                equal.load(equal_buffer.data());
+
+                word_type & positive = positive_vertical[block];
+                word_type & negative = negative_vertical[block];
+
+                word_type const vertical = equal | negative;
+                equal |= negative_horizontal_in;
+                word_type const horizontal = ((((equal & positive) + positive) ^ positive) | equal);
+                word_type positive_horizontal = negative | ((horizontal | positive) ^ all_ones);
+                word_type negative_horizontal = positive & horizontal;
+
+                if (has_last_row[block]) {
+                    distance = distance + blend((positive_horizontal & last_row_masks[block]).eq(zero),
+                                                distance_type{0},
+                                                distance_type{1});
+                    distance = distance - blend((negative_horizontal & last_row_masks[block]).eq(zero),
+                                                distance_type{0},
+                                                distance_type{1});
+                }
+
+                word_type const positive_horizontal_out = positive_horizontal >> (word_size - 1);
+                word_type const negative_horizontal_out = negative_horizontal >> (word_size - 1);
+
+                positive_horizontal = (positive_horizontal << 1) | positive_horizontal_in;
+                negative_horizontal = (negative_horizontal << 1) | negative_horizontal_in;
+
+                positive = negative_horizontal | ((vertical | positive_horizontal) ^ all_ones);
+                negative = positive_horizontal & vertical;
+
+                positive_horizontal_in = positive_horizontal_out;
+                negative_horizontal_in = negative_horizontal_out;
+            }
+
+            // Keep the values of the last column of every lane.
+            auto const is_last_column = size2.eq(distance_type{static_cast<int64_t>(column)});
+            last_distance = blend(is_last_column, distance, last_distance);
+
+            if (free_last_row) {
+                distance_type const current_column{static_cast<int64_t>(column)};
+                auto const is_better = current_column.le(size2) && distance.lt(best_last_row_distance);
+                best_last_row_distance = blend(is_better, distance, best_last_row_distance);
+                best_last_row_column = blend(is_better, current_column, best_last_row_column);
+            }
+
+            if (free_last_column) {
+                for (size_t block = 0; block < block_count; ++block) {
+                    last_positive_vertical[block] = blend(is_last_column, positive_vertical[block],
+                                                          last_positive_vertical[block]);
+                    last_negative_vertical[block] = blend(is_last_column, negative_vertical[block],
+                                                          last_negative_vertical[block]);
+                }
+            }
+        }
+
+        // ----------------------------------------------------------------------------
+        // Result
+        // ----------------------------------------------------------------------------
+
+        // Of several cells with the minimal distance, the cell (m, n) is preferred, followed by the first one in the
+        // last row and then the first one in the last column.
+        std::array<int64_t, lane_count> distances{};
+        std::array<alignment_coordinate, lane_count> end_coordinate{};
+        for (size_t lane = 0; lane < pair_count; ++lane) {
+            int64_t const first_row_distance = penalised_first_row ? sizes2[lane] : 0;
+            end_coordinate[lane] = alignment_coordinate{.sequence1_position = sizes1[lane],
+                                                        .sequence2_position = sizes2[lane]};
+            if (sizes1[lane] == 0) { // The first row is the last row.
+                distances[lane] = free_last_row ? 0 : first_row_distance;
+                if (free_last_row)
+                    end_coordinate[lane].sequence2_position = 0;
+                continue;
+            }
+
+            distances[lane] = last_distance[lane];
+            if (free_last_row && best_last_row_distance[lane] < distances[lane]) {
+                distances[lane] = best_last_row_distance[lane];
+                end_coordinate[lane].sequence2_position = best_last_row_column[lane];
+            }
+
+            if (free_last_column) { // Sum up the vertical differences of the last column.
+                int64_t column_distance = first_row_distance;
+                if (column_distance < distances[lane]) {
+                    distances[lane] = column_distance;
+                    end_coordinate[lane] = alignment_coordinate{.sequence1_position = 0,
+                                                                .sequence2_position = sizes2[lane]};
+                }
+
+                for (size_t row = 0; row < sizes1[lane]; ++row) {
+                    uint64_t const row_bit = uint64_t{1} << (row % word_size);
+                    column_distance += (last_positive_vertical[row / word_size][lane] & row_bit) ? 1 : 0;
+                    column_distance -= (last_negative_vertical[row / word_size][lane] & row_bit) ? 1 : 0;
+                    if (column_distance < distances[lane]) {
+                        distances[lane] = column_distance;
+                        end_coordinate[lane] = alignment_coordinate{.sequence1_position = row + 1,
+                                                                    .sequence2_position = sizes2[lane]};
+                    }
+                }
+            }
+        }
+
+        return {distances, end_coordinate};
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
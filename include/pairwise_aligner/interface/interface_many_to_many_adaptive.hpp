@@ -0,0 +1,197 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::interface_many_to_many_adaptive.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <pairwise_aligner/result/aligner_result_score.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief Computes an arbitrary number of pairwise alignments with bulk interfaces of increasing score precision.
+ *
+ * The interfaces are ordered from the narrowest to the widest score type, e.g. one computing with saturated 8 bit
+ * scores, one with saturated 16 bit scores and one with 32 bit scores. All pairs are first computed with the
+ * narrowest interface. A score reaching the saturation score of its interface might be clamped and the respective
+ * pair is computed again with the next wider interface. Thus, the narrowest score type is used for all pairs whose
+ * scores fit into it, while the scores of the remaining pairs are still exact.
+ * The computation starts with the interface of the given first level instead, if the narrower score types can not
+ * represent the scores of the scoring scheme.
+ * The scores are returned as `score_t`, which must be able to hold the scores of the widest interface.
+ * The number of pairs computed with every interface in the last call to compute is available via pair_counts().
+ */
+template <typename score_t, typename ...interfaces_t>
+struct _interface_many_to_many_adaptive
+{
+    struct type;
+};
+
+template <typename score_t, typename ...interfaces_t>
+using interface_many_to_many_adaptive = typename _interface_many_to_many_adaptive<score_t, interfaces_t...>::type;
+
+template <typename score_t, typename ...interfaces_t>
+struct _interface_many_to_many_adaptive<score_t, interfaces_t...>::type
+{
+private:
+    static constexpr size_t level_count = sizeof...(interfaces_t);
+
+    static_assert(level_count > 0, "At least one interface is required!");
+
+    std::tuple<interfaces_t...> _interfaces;
+    std::array<score_t, level_count> _saturation_scores{};
+    std::array<size_t, level_count> _pair_counts{};
+    size_t _first_level{};
+    std::vector<size_t> _pairs{};
+    std::vector<size_t> _promoted_pairs{};
+    std::vector<score_t> _level_scores{};
+
+public:
+
+    //!\brief Constructs the interface from the saturation score of every interface and the interfaces themselves.
+    explicit type(std::array<score_t, level_count> saturation_scores, interfaces_t ...interfaces) :
+        type{0, std::move(saturation_scores), std::move(interfaces)...}
+    {}
+
+    //!\brief Constructs the interface, which computes all pairs with the interface of the given first level.
+    explicit type(size_t const first_level,
+                  std::array<score_t, level_count> saturation_scores,
+                  interfaces_t ...interfaces) :
+        _interfaces{std::move(interfaces)...},
+        _saturation_scores{std::move(saturation_scores)},
+        _first_level{first_level}
+    {
+        assert(_first_level < level_count);
+    }
+
+    template <std::ranges::random_access_range sequence_collection1_t,
+              std::ranges::random_access_range sequence_collection2_t>
+        requires (std::ranges::borrowed_range<sequence_collection1_t> &&
+                  std::ranges::borrowed_range<sequence_collection2_t>) &&
+                 (std::ranges::forward_range<std::ranges::range_reference_t<sequence_collection1_t>> &&
+                  std::ranges::forward_range<std::ranges::range_reference_t<sequence_collection2_t>>) &&
+                 (std::ranges::viewable_range<std::ranges::range_reference_t<sequence_collection1_t>> &&
+                  std::ranges::viewable_range<std::ranges::range_reference_t<sequence_collection2_t>>)
+    auto compute(sequence_collection1_t && sequence_collection1, sequence_collection2_t && sequence_collection2)
+    {
+        assert(std::ranges::distance(sequence_collection1) == std::ranges::distance(sequence_collection2));
+
+        using sequence1_t = std::views::all_t<std::ranges::range_reference_t<sequence_collection1_t>>;
+        using sequence2_t = std::views::all_t<std::ranges::range_reference_t<sequence_collection2_t>>;
+        using result_t = aligner_result_score<sequence1_t, sequence2_t, score_t>;
+
+        std::vector<score_t> scores(std::ranges::distance(sequence_collection1));
+        compute_scores(sequence_collection1, sequence_collection2, std::span{scores});
+
+        // The results are created in the order of the input and refer to the sequences of the collections.
+        std::vector<result_t> results{};
+        results.reserve(scores.size());
+        for (size_t pair = 0; pair < scores.size(); ++pair) {
+            results.emplace_back(std::views::all(std::ranges::begin(sequence_collection1)[pair]),
+                                 std::views::all(std::ranges::begin(sequence_collection2)[pair]),
+                                 scores[pair]);
+        }
+
+        return results;
+    }
+
+    /*!\brief Writes the score of the i-th pair into `scores[i]`.
+     *
+     * In contrast to compute, no result objects are created. `scores` must have at least as many elements as the
+     * collections.
+     */
+    template <std::ranges::random_access_range sequence_collection1_t,
+              std::ranges::random_access_range sequence_collection2_t>
+        requires (std::ranges::forward_range<std::ranges::range_reference_t<sequence_collection1_t>> &&
+                  std::ranges::forward_range<std::ranges::range_reference_t<sequence_collection2_t>>) &&
+                 (std::ranges::viewable_range<std::ranges::range_reference_t<sequence_collection1_t>> &&
+                  std::ranges::viewable_range<std::ranges::range_reference_t<sequence_collection2_t>>)
+    void compute_scores(sequence_collection1_t && sequence_collection1,
+                        sequence_collection2_t && sequence_collection2,
+                        std::span<score_t> scores)
+    {
+        assert(std::ranges::distance(sequence_collection1) == std::ranges::distance(sequence_collection2));
+        assert(scores.size() >= static_cast<size_t>(std::ranges::distance(sequence_collection1)));
+
+        _pairs.resize(std::ranges::distance(sequence_collection1));
+        std::iota(_pairs.begin(), _pairs.end(), 0);
+        _pair_counts.fill(0);
+
+        compute_level<0>(sequence_collection1, sequence_collection2, scores);
+    }
+
+    //!\brief Returns the number of pairs computed with every interface in the last call to compute.
+    std::array<size_t, level_count> const & pair_counts() const noexcept
+    {
+        return _pair_counts;
+    }
+
+private:
+
+    // Computes the pending pairs with the interface of the given level and promotes the saturated ones to the next.
+    template <size_t level, typename sequence_collection1_t, typename sequence_collection2_t>
+    void compute_level(sequence_collection1_t & sequence_collection1,
+                       sequence_collection2_t & sequence_collection2,
+                       std::span<score_t> scores)
+    {
+        if constexpr (level + 1 < level_count) {
+            if (level < _first_level)
+                return compute_level<level + 1>(sequence_collection1, sequence_collection2, scores);
+        }
+
+        _pair_counts[level] = _pairs.size();
+        if (_pairs.empty())
+            return;
+
+        _level_scores.resize(_pairs.size());
+        std::get<level>(_interfaces).compute_scores(pending_view(sequence_collection1),
+                                                    pending_view(sequence_collection2),
+                                                    std::span{_level_scores});
+
+        _promoted_pairs.clear();
+        for (size_t index = 0; index < _pairs.size(); ++index) {
+            if (level + 1 < level_count && _level_scores[index] >= _saturation_scores[level])
+                _promoted_pairs.push_back(_pairs[index]);
+            else
+                scores[_pairs[index]] = _level_scores[index];
+        }
+
+        if constexpr (level + 1 < level_count) {
+            std::swap(_pairs, _promoted_pairs);
+            compute_level<level + 1>(sequence_collection1, sequence_collection2, scores);
+        }
+    }
+
+    // The pending pairs of the given collection, which refers to the pair indices stored in this interface.
+    template <typename sequence_collection_t>
+    auto pending_view(sequence_collection_t & sequence_collection) const
+    {
+        return std::span<size_t const>{_pairs}
+             | std::views::transform([collection_it = std::ranges::begin(sequence_collection)]
+                                     (size_t const index) -> decltype(auto) {
+                    return collection_it[index];
+               });
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -0,0 +1,294 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::interface_many_to_many_batch.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <vector>
+
+#include <pairwise_aligner/matrix/dp_vector_workspace.hpp>
+#include <pairwise_aligner/result/aligner_result_bulk.hpp>
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+//!\brief The cell statistics of a batch computation.
+struct batch_statistics
+{
+    size_t cell_count{}; //!< The number of cells computed over all bulks including the padded cells.
+    size_t padded_cell_count{}; //!< The number of cells that were computed only for padding.
+
+    //!\brief Returns the share of padded cells in all computed cells.
+    double padded_cell_ratio() const noexcept
+    {
+        return (cell_count == 0) ? 0.0 : static_cast<double>(padded_cell_count) / static_cast<double>(cell_count);
+    }
+};
+
+/*!\brief Computes an arbitrary number of pairwise alignments with a bulk algorithm.
+ *
+ * Before the bulks are formed, the pairs are ordered by the sizes of their sequences (|seq1|, |seq2|). Hence,
+ * pairs of similar size share a bulk and the padding needed to fill up the bulk to its longest sequences stays
+ * small. The bulks are cut from this order with `max_bulk_size` pairs each, such that only the last bulk has empty
+ * lanes. The results are returned in the order of the input pairs. The sequence collections must outlive the
+ * returned results, since the results refer to them.
+ * The number of computed and padded cells of the last call to compute is available via statistics().
+ * If only the scores are needed, compute_scores writes them into a contiguous range given by the caller instead.
+ * The sequence collections must be random access ranges, such that every pair of a bulk is accessed in constant time.
+ */
+template <typename dp_algorithm_t, size_t max_bulk_size>
+struct _interface_many_to_many_batch
+{
+    struct type;
+};
+
+template <typename dp_algorithm_t, size_t max_bulk_size>
+using interface_many_to_many_batch = typename _interface_many_to_many_batch<dp_algorithm_t, max_bulk_size>::type;
+
+template <typename dp_algorithm_t, size_t max_bulk_size>
+struct _interface_many_to_many_batch<dp_algorithm_t, max_bulk_size>::type : protected dp_algorithm_t
+{
+private:
+    using workspace_t = dp_vector_workspace<typename dp_algorithm_t::column_vector_type,
+                                            typename dp_algorithm_t::row_vector_type>;
+
+    batch_statistics _statistics{};
+    // The workspace kept between calls to compute_scores, such that repeated calls of similar size do not allocate.
+    // It is created by the first call, since creating the dp vectors may allocate and the constructor shall not throw.
+    std::optional<workspace_t> _workspace{};
+    std::vector<size_t> _sizes1{};
+    std::vector<size_t> _sizes2{};
+    std::vector<size_t> _schedule{};
+
+public:
+
+    explicit type(dp_algorithm_t algorithm) noexcept : dp_algorithm_t{std::move(algorithm)}
+    {}
+
+    using dp_algorithm_t::column_vector;
+    using dp_algorithm_t::row_vector;
+
+    template <std::ranges::random_access_range sequence_collection1_t,
+              std::ranges::random_access_range sequence_collection2_t>
+        requires (std::ranges::borrowed_range<sequence_collection1_t> &&
+                  std::ranges::borrowed_range<sequence_collection2_t>) &&
+                 (std::ranges::forward_range<std::ranges::range_reference_t<sequence_collection1_t>> &&
+                  std::ranges::forward_range<std::ranges::range_reference_t<sequence_collection2_t>>) &&
+                 (std::ranges::viewable_range<std::ranges::range_reference_t<sequence_collection1_t>> &&
+                  std::ranges::viewable_range<std::ranges::range_reference_t<sequence_collection2_t>>)
+    auto compute(sequence_collection1_t && sequence_collection1, sequence_collection2_t && sequence_collection2)
+    {
+        return compute(std::forward<sequence_collection1_t>(sequence_collection1),
+                       std::forward<sequence_collection2_t>(sequence_collection2),
+                       column_vector(),
+                       row_vector());
+    }
+
+    template <std::ranges::random_access_range sequence_collection1_t,
+              std::ranges::random_access_range sequence_collection2_t,
+              typename dp_column_t,
+              typename dp_row_t>
+        requires (std::ranges::borrowed_range<sequence_collection1_t> &&
+                  std::ranges::borrowed_range<sequence_collection2_t>) &&
+                 (std::ranges::forward_range<std::ranges::range_reference_t<sequence_collection1_t>> &&
+                  std::ranges::forward_range<std::ranges::range_reference_t<sequence_collection2_t>>) &&
+                 (std::ranges::viewable_range<std::ranges::range_reference_t<sequence_collection1_t>> &&
+                  std::ranges::viewable_range<std::ranges::range_reference_t<sequence_collection2_t>>)
+    auto compute(sequence_collection1_t && sequence_collection1,
+                 sequence_collection2_t && sequence_collection2,
+                 dp_column_t const & first_dp_column,
+                 dp_row_t const & first_dp_row)
+    {
+        assert(std::ranges::distance(sequence_collection1) == std::ranges::distance(sequence_collection2));
+
+        schedule_pairs(sequence_collection1, sequence_collection2);
+        size_t const collection_size = _schedule.size();
+
+        // All bulks refer to one copy of the schedule, which is kept alive by the returned results.
+        auto schedule = std::make_shared<std::vector<size_t> const>(_schedule);
+
+        using bulk1_t = decltype(make_bulk(sequence_collection1, schedule, std::span<size_t const>{}));
+        using bulk2_t = decltype(make_bulk(sequence_collection2, schedule, std::span<size_t const>{}));
+        using result_t = decltype(dp_algorithm_t::run(std::declval<bulk1_t>(),
+                                                      std::declval<bulk2_t>(),
+                                                      first_dp_column,
+                                                      first_dp_row));
+
+        // The results of all bulks are stored in one shared vector, which must not reallocate.
+        auto bulk_results = std::make_shared<std::vector<result_t>>();
+        bulk_results->reserve((collection_size + max_bulk_size - 1) / max_bulk_size);
+
+        std::vector<aligner_result_bulk<result_t>> results(collection_size);
+
+        for (size_t offset = 0; offset < collection_size; offset += max_bulk_size) {
+            std::span<size_t const> bulk_indices =
+                std::span<size_t const>{*schedule}.subspan(offset, std::min(max_bulk_size, collection_size - offset));
+
+            bulk_results->push_back(dp_algorithm_t::run(make_bulk(sequence_collection1, schedule, bulk_indices),
+                                                        make_bulk(sequence_collection2, schedule, bulk_indices),
+                                                        first_dp_column,
+                                                        first_dp_row));
+            std::shared_ptr<result_t> bulk_result{bulk_results, &bulk_results->back()};
+
+            // Map the results of the bulk back to the position of the respective pair in the input.
+            for (size_t result_idx = 0; result_idx < bulk_indices.size(); ++result_idx)
+                results[bulk_indices[result_idx]] = aligner_result_bulk<result_t>{bulk_result, result_idx};
+        }
+
+        return results;
+    }
+
+    /*!\brief Writes the score of the i-th pair into `scores[i]`.
+     *
+     * In contrast to compute, no result objects are created and the dp vectors are reused for every bulk.
+     * `scores` must have at least as many elements as the collections. If `end_coordinates` is not empty, the cell
+     * of the optimal score of the i-th pair is written into `end_coordinates[i]`, which then must have at least as
+     * many elements as the collections, too.
+     */
+    template <std::ranges::random_access_range sequence_collection1_t,
+              std::ranges::random_access_range sequence_collection2_t,
+              typename score_t>
+        requires (std::ranges::forward_range<std::ranges::range_reference_t<sequence_collection1_t>> &&
+                  std::ranges::forward_range<std::ranges::range_reference_t<sequence_collection2_t>>) &&
+                 (std::ranges::viewable_range<std::ranges::range_reference_t<sequence_collection1_t>> &&
+                  std::ranges::viewable_range<std::ranges::range_reference_t<sequence_collection2_t>>)
+    void compute_scores(sequence_collection1_t && sequence_collection1,
+                        sequence_collection2_t && sequence_collection2,
+                        std::span<score_t> scores,
+                        std::span<alignment_coordinate> end_coordinates = {})
+    {
+        assert(std::ranges::distance(sequence_collection1) == std::ranges::distance(sequence_collection2));
+
+        schedule_pairs(sequence_collection1, sequence_collection2);
+        size_t const collection_size = _schedule.size();
+
+        assert(scores.size() >= collection_size);
+        assert(end_coordinates.empty() || end_coordinates.size() >= collection_size);
+
+        using dp_column_t = typename dp_algorithm_t::column_vector_type;
+        using dp_row_t = typename dp_algorithm_t::row_vector_type;
+
+        for (size_t offset = 0; offset < collection_size; offset += max_bulk_size) {
+            std::span<size_t const> bulk_indices =
+                std::span<size_t const>{_schedule}.subspan(offset, std::min(max_bulk_size, collection_size - offset));
+
+            auto result = own_workspace().run([&] (dp_column_t dp_column, dp_row_t dp_row) {
+                return dp_algorithm_t::run(make_bulk_view(sequence_collection1, bulk_indices),
+                                           make_bulk_view(sequence_collection2, bulk_indices),
+                                           std::move(dp_column),
+                                           std::move(dp_row));
+            });
+
+            for (size_t result_idx = 0; result_idx < bulk_indices.size(); ++result_idx)
+                scores[bulk_indices[result_idx]] = static_cast<score_t>(result.score()[result_idx]);
+
+            if (!end_coordinates.empty())
+                for (size_t result_idx = 0; result_idx < bulk_indices.size(); ++result_idx)
+                    end_coordinates[bulk_indices[result_idx]] = result.end_coordinate()[result_idx];
+        }
+    }
+
+    //!\brief Returns the cell statistics of the last call to compute.
+    batch_statistics const & statistics() const noexcept
+    {
+        return _statistics;
+    }
+
+private:
+
+    workspace_t & own_workspace()
+    {
+        if (!_workspace)
+            _workspace.emplace(dp_algorithm_t::column_vector(), dp_algorithm_t::row_vector());
+
+        return *_workspace;
+    }
+
+    // Orders the pairs by their sequence sizes such that every bulk contains pairs of similar size and records the
+    // cell statistics of the resulting bulks.
+    template <typename sequence_collection1_t, typename sequence_collection2_t>
+    void schedule_pairs(sequence_collection1_t & sequence_collection1, sequence_collection2_t & sequence_collection2)
+    {
+        auto store_sizes = [] (auto & sequence_collection, std::vector<size_t> & sizes) {
+            sizes.clear();
+            std::ranges::for_each(sequence_collection, [&] (auto && sequence) {
+                sizes.push_back(std::ranges::distance(sequence));
+            });
+        };
+
+        store_sizes(sequence_collection1, _sizes1);
+        store_sizes(sequence_collection2, _sizes2);
+        size_t const collection_size = _sizes1.size();
+
+        // Ties are broken by the input position, which gives the order of a stable sort without its buffer.
+        _schedule.resize(collection_size);
+        std::iota(_schedule.begin(), _schedule.end(), 0);
+        std::ranges::sort(_schedule, [&] (size_t const lhs, size_t const rhs) {
+            return std::tuple{_sizes1[lhs], _sizes2[lhs], lhs} < std::tuple{_sizes1[rhs], _sizes2[rhs], rhs};
+        });
+
+        _statistics = batch_statistics{};
+        for (size_t offset = 0; offset < collection_size; offset += max_bulk_size) {
+            size_t const last = std::min(offset + max_bulk_size, collection_size);
+
+            size_t max_size1 = 0;
+            size_t max_size2 = 0;
+            size_t useful_cell_count = 0;
+            for (size_t const index : std::span{_schedule}.subspan(offset, last - offset)) {
+                max_size1 = std::max(max_size1, _sizes1[index]);
+                max_size2 = std::max(max_size2, _sizes2[index]);
+                useful_cell_count += _sizes1[index] * _sizes2[index];
+            }
+
+            size_t const bulk_cell_count = max_bulk_size * max_size1 * max_size2;
+            _statistics.cell_count += bulk_cell_count;
+            _statistics.padded_cell_count += bulk_cell_count - useful_cell_count;
+        }
+    }
+
+    // The bulk shares the schedule, such that it remains a copyable view referring to the original sequences.
+    template <typename sequence_collection_t>
+    static auto make_bulk(sequence_collection_t & sequence_collection,
+                          std::shared_ptr<std::vector<size_t> const> schedule,
+                          std::span<size_t const> bulk_indices)
+    {
+        return bulk_indices
+             | std::views::transform([collection_it = std::ranges::begin(sequence_collection),
+                                      schedule = std::move(schedule)] (size_t const index) -> decltype(auto) {
+                    return collection_it[index];
+               });
+    }
+
+    // The bulk refers to the indices, which must outlive it. Only used when the result is not returned.
+    template <typename sequence_collection_t>
+    static auto make_bulk_view(sequence_collection_t & sequence_collection, std::span<size_t const> bulk_indices)
+    {
+        return bulk_indices
+             | std::views::transform([collection_it = std::ranges::begin(sequence_collection)]
+                                     (size_t const index) -> decltype(auto) {
+                    return collection_it[index];
+               });
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
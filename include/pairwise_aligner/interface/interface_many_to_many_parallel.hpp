@@ -0,0 +1,221 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::interface_many_to_many_parallel.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <pairwise_aligner/utility/work_stealing_range.hpp>
+#include <pairwise_aligner/utility/worker_pool.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+//!\brief The settings of the parallel execution.
+struct parallel_options
+{
+    //!\brief The number of threads; 0 selects the number of hardware threads. The threads persist between calls.
+    size_t thread_count{0};
+    //!\brief Whether the i-th thread is bound to the i-th logical core. Only supported on linux.
+    bool pin_threads{false};
+    //!\brief The number of pairs computed by one task; should be a multiple of the bulk size of the aligner.
+    size_t task_size{1024};
+};
+
+/*!\brief Computes the pairwise alignments of two sequence collections with several threads.
+ *
+ * Wraps an aligner configured by seqan::pairwise_aligner::cfg::configure_aligner, whose compute function accepts
+ * two sequence collections. The pairs are split into tasks of `task_size` consecutive pairs. Every thread works on
+ * its own copy of the aligner, which is kept between calls to compute such that the workspace of the aligner is
+ * reused. Every thread owns a contiguous range of tasks; once its range is exhausted it steals half of the
+ * remaining tasks of another thread. Every task stores its results into a slot reserved for it in advance, so the
+ * results are gathered without any lock and returned in the order of the input pairs.
+ * The threads are started by the first call to compute that uses more than one thread and sleep between the
+ * calls, such that repeated calls on small collections do not pay for starting and joining threads. They are
+ * joined when the interface is destroyed. An exception thrown by a thread is rethrown after all threads have
+ * finished the call.
+ */
+template <typename aligner_t>
+struct _interface_many_to_many_parallel
+{
+    struct type;
+};
+
+template <typename aligner_t>
+using interface_many_to_many_parallel = typename _interface_many_to_many_parallel<aligner_t>::type;
+
+template <typename aligner_t>
+struct _interface_many_to_many_parallel<aligner_t>::type
+{
+private:
+    aligner_t _aligner;
+    parallel_options _options{};
+    std::vector<aligner_t> _thread_aligners{};
+    std::unique_ptr<worker_pool> _pool{};
+
+public:
+
+    explicit type(aligner_t aligner, parallel_options options = parallel_options{}) noexcept :
+        _aligner{std::move(aligner)},
+        _options{std::move(options)}
+    {
+        if (_options.thread_count == 0)
+            _options.thread_count = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+        _options.task_size = std::max<size_t>(_options.task_size, 1);
+    }
+
+    //!\brief Copies the aligner and the options; the copy starts its own threads.
+    type(type const & other) : _aligner{other._aligner}, _options{other._options}
+    {}
+
+    type(type &&) noexcept = default;
+
+    type & operator=(type const & other)
+    {
+        _pool.reset();
+        _thread_aligners.clear();
+        _aligner = other._aligner;
+        _options = other._options;
+        return *this;
+    }
+
+    type & operator=(type &&) noexcept = default;
+
+    template <std::ranges::forward_range sequence_collection1_t,
+              std::ranges::forward_range sequence_collection2_t>
+        requires (std::ranges::borrowed_range<sequence_collection1_t> &&
+                  std::ranges::borrowed_range<sequence_collection2_t>)
+    auto compute(sequence_collection1_t && sequence_collection1, sequence_collection2_t && sequence_collection2)
+    {
+        assert(std::ranges::distance(sequence_collection1) == std::ranges::distance(sequence_collection2));
+
+        using task_collection1_t = std::ranges::subrange<std::ranges::iterator_t<sequence_collection1_t>>;
+        using task_collection2_t = std::ranges::subrange<std::ranges::iterator_t<sequence_collection2_t>>;
+        using task_result_t = decltype(std::declval<aligner_t &>().compute(std::declval<task_collection1_t &>(),
+                                                                          std::declval<task_collection2_t &>()));
+
+        // Split the collections into tasks with a single pass over the collections.
+        std::vector<task_collection1_t> task_collections1{};
+        std::vector<task_collection2_t> task_collections2{};
+        {
+            auto it1 = std::ranges::begin(sequence_collection1);
+            auto it2 = std::ranges::begin(sequence_collection2);
+            while (it1 != std::ranges::end(sequence_collection1)) {
+                auto task_end1 = std::ranges::next(it1, _options.task_size, std::ranges::end(sequence_collection1));
+                auto task_end2 = std::ranges::next(it2, std::ranges::distance(it1, task_end1));
+                task_collections1.emplace_back(it1, task_end1);
+                task_collections2.emplace_back(it2, task_end2);
+                it1 = task_end1;
+                it2 = task_end2;
+            }
+        }
+
+        size_t const task_count = task_collections1.size();
+        size_t const thread_count = std::max<size_t>(std::min(_options.thread_count, task_count), 1);
+
+        std::vector<task_result_t> task_results(task_count);
+        std::vector<std::exception_ptr> thread_errors(thread_count);
+        std::unique_ptr<work_stealing_range[]> task_ranges{new work_stealing_range[thread_count]};
+
+        // Distribute the tasks evenly before any thread is started.
+        for (size_t thread_id = 0; thread_id < thread_count; ++thread_id)
+            task_ranges[thread_id].assign(task_count * thread_id / thread_count,
+                                          task_count * (thread_id + 1) / thread_count);
+
+        while (_thread_aligners.size() < thread_count)
+            _thread_aligners.push_back(_aligner);
+
+        auto worker = [&] (size_t const thread_id) {
+            try {
+                aligner_t & aligner = _thread_aligners[thread_id];
+                auto run_task = [&] (size_t const task_id) {
+                    task_results[task_id] = aligner.compute(task_collections1[task_id], task_collections2[task_id]);
+                };
+
+                for (;;) {
+                    while (std::optional<size_t> task_id = task_ranges[thread_id].pop())
+                        run_task(*task_id);
+
+                    // Own range is exhausted, so steal from the other threads in round-robin order.
+                    std::optional<std::pair<size_t, size_t>> stolen_tasks{};
+                    for (size_t offset = 1; offset < thread_count && !stolen_tasks; ++offset)
+                        stolen_tasks = task_ranges[(thread_id + offset) % thread_count].steal();
+
+                    if (!stolen_tasks)
+                        break;
+
+                    task_ranges[thread_id].assign(stolen_tasks->first, stolen_tasks->second);
+                }
+            } catch (...) {
+                thread_errors[thread_id] = std::current_exception();
+            }
+        };
+
+        if (thread_count == 1) {
+            worker(0);
+        } else {
+            if (!_pool)
+                _pool = std::make_unique<worker_pool>(_options.thread_count, _options.pin_threads);
+
+            _pool->run(thread_count, worker);
+        }
+
+        for (std::exception_ptr const & error : thread_errors)
+            if (error)
+                std::rethrow_exception(error);
+
+        std::vector<std::ranges::range_value_t<task_result_t>> results{};
+        results.reserve(std::ranges::distance(sequence_collection1));
+        for (task_result_t & task_result : task_results)
+            std::ranges::move(task_result, std::back_inserter(results));
+
+        return results;
+    }
+
+    //!\brief Returns the options of the parallel execution.
+    parallel_options const & options() const noexcept
+    {
+        return _options;
+    }
+};
+
+namespace detail
+{
+
+struct interface_many_to_many_parallel_factory_fn
+{
+    template <typename aligner_t>
+    auto operator()(aligner_t && aligner, parallel_options options = parallel_options{}) const noexcept
+    {
+        return interface_many_to_many_parallel<std::remove_cvref_t<aligner_t>>{std::forward<aligner_t>(aligner),
+                                                                             std::move(options)};
+    }
+};
+
+} // namespace detail
+
+inline constexpr detail::interface_many_to_many_parallel_factory_fn interface_many_to_many_parallel_factory{};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -0,0 +1,381 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::interface_many_to_many_refill.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <pairwise_aligner/interface/interface_many_to_many_batch.hpp>
+#include <pairwise_aligner/matrix/dp_vector_refill.hpp>
+#include <pairwise_aligner/matrix/dp_vector_workspace.hpp>
+#include <pairwise_aligner/result/aligner_result_score.hpp>
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief Computes an arbitrary number of pairwise alignments with a bulk algorithm whose lanes are refilled.
+ *
+ * In contrast to seqan::pairwise_aligner::interface_many_to_many_batch the lanes of the bulk are not bound to the
+ * longest pair of a fixed set of pairs. Instead, the second sequences are processed in segments of
+ * `segment_width` columns. After every segment, the lanes whose alignments are finished are refilled with the
+ * next pairs, while the remaining lanes continue with the cells of the last computed column.
+ * The pairs are dispatched in decreasing order of their sizes. Thus, the first sequence of a refilled lane is
+ * never longer than the column carried over from the previous segment and consecutive pairs are of similar size.
+ *
+ * The score of a global alignment is taken from the segment in which the alignment ends, the score of a local
+ * alignment is the best score of all segments of the respective lane. Free trailing gaps require the complete
+ * last row of an alignment, which is not available after a segment. In this case the constructor is given a
+ * segment width that covers the longest second sequence and the lanes are only refilled once all pairs of a bulk
+ * are finished.
+ * The results are returned in the order of the input pairs and refer to the sequences of the collections.
+ * Alternatively, compute_scores writes only the scores into a contiguous range given by the caller.
+ */
+template <typename dp_algorithm_t, size_t max_bulk_size, bool is_local>
+struct _interface_many_to_many_refill
+{
+    struct type;
+};
+
+template <typename dp_algorithm_t, size_t max_bulk_size, bool is_local>
+using interface_many_to_many_refill =
+    typename _interface_many_to_many_refill<dp_algorithm_t, max_bulk_size, is_local>::type;
+
+template <typename dp_algorithm_t, size_t max_bulk_size, bool is_local>
+struct _interface_many_to_many_refill<dp_algorithm_t, max_bulk_size, is_local>::type : protected dp_algorithm_t
+{
+private:
+    static constexpr size_t no_pair = std::numeric_limits<size_t>::max();
+
+    using workspace_t = dp_vector_workspace<dp_vector_refill<typename dp_algorithm_t::column_vector_type>,
+                                            dp_vector_refill<typename dp_algorithm_t::row_vector_type>>;
+
+    size_t _segment_width{};
+    batch_statistics _statistics{};
+    // The workspace kept between calls to compute, such that repeated calls of similar size do not allocate.
+    // It is created by the first call, since creating the dp vectors may allocate and the constructor shall not throw.
+    std::optional<workspace_t> _workspace{};
+    std::vector<size_t> _sizes1{};
+    std::vector<size_t> _sizes2{};
+    std::vector<size_t> _schedule{};
+
+public:
+
+    explicit type(dp_algorithm_t algorithm, size_t const segment_width) noexcept :
+        dp_algorithm_t{std::move(algorithm)},
+        _segment_width{std::max<size_t>(segment_width, 1)}
+    {}
+
+    using dp_algorithm_t::column_vector;
+    using dp_algorithm_t::row_vector;
+
+    template <std::ranges::forward_range sequence_collection1_t,
+              std::ranges::forward_range sequence_collection2_t>
+        requires (std::ranges::borrowed_range<sequence_collection1_t> &&
+                  std::ranges::borrowed_range<sequence_collection2_t>) &&
+                 (std::ranges::forward_range<std::ranges::range_reference_t<sequence_collection1_t>> &&
+                  std::ranges::forward_range<std::ranges::range_reference_t<sequence_collection2_t>>) &&
+                 (std::ranges::viewable_range<std::ranges::range_reference_t<sequence_collection1_t>> &&
+                  std::ranges::viewable_range<std::ranges::range_reference_t<sequence_collection2_t>>)
+    auto compute(sequence_collection1_t && sequence_collection1, sequence_collection2_t && sequence_collection2)
+    {
+        return compute_results(std::forward<sequence_collection1_t>(sequence_collection1),
+                               std::forward<sequence_collection2_t>(sequence_collection2),
+                               own_workspace());
+    }
+
+    template <std::ranges::forward_range sequence_collection1_t,
+              std::ranges::forward_range sequence_collection2_t,
+              typename dp_column_t,
+              typename dp_row_t>
+        requires (std::ranges::borrowed_range<sequence_collection1_t> &&
+                  std::ranges::borrowed_range<sequence_collection2_t>) &&
+                 (std::ranges::forward_range<std::ranges::range_reference_t<sequence_collection1_t>> &&
+                  std::ranges::forward_range<std::ranges::range_reference_t<sequence_collection2_t>>) &&
+                 (std::ranges::viewable_range<std::ranges::range_reference_t<sequence_collection1_t>> &&
+                  std::ranges::viewable_range<std::ranges::range_reference_t<sequence_collection2_t>>)
+    auto compute(sequence_collection1_t && sequence_collection1,
+                 sequence_collection2_t && sequence_collection2,
+                 dp_column_t const & first_dp_column,
+                 dp_row_t const & first_dp_row)
+    {
+        auto workspace = dp_vector_workspace_factory(dp_vector_refill_factory(first_dp_column),
+                                                     dp_vector_refill_factory(first_dp_row));
+        return compute_results(std::forward<sequence_collection1_t>(sequence_collection1),
+                               std::forward<sequence_collection2_t>(sequence_collection2),
+                               workspace);
+    }
+
+    /*!\brief Writes the score of the i-th pair into `scores[i]`.
+     *
+     * In contrast to compute, no result objects are created. The sequence collections must be random access ranges
+     * and `scores` must have at least as many elements as the collections. If `end_coordinates` is not empty, the
+     * cell of the optimal score of the i-th pair is written into `end_coordinates[i]`, which then must have at least
+     * as many elements as the collections, too.
+     */
+    template <std::ranges::random_access_range sequence_collection1_t,
+              std::ranges::random_access_range sequence_collection2_t,
+              typename score_t>
+        requires (std::ranges::forward_range<std::ranges::range_reference_t<sequence_collection1_t>> &&
+                  std::ranges::forward_range<std::ranges::range_reference_t<sequence_collection2_t>>) &&
+                 (std::ranges::viewable_range<std::ranges::range_reference_t<sequence_collection1_t>> &&
+                  std::ranges::viewable_range<std::ranges::range_reference_t<sequence_collection2_t>>)
+    void compute_scores(sequence_collection1_t && sequence_collection1,
+                        sequence_collection2_t && sequence_collection2,
+                        std::span<score_t> scores,
+                        std::span<alignment_coordinate> end_coordinates = {})
+    {
+        assert(std::ranges::distance(sequence_collection1) == std::ranges::distance(sequence_collection2));
+        assert(scores.size() >= static_cast<size_t>(std::ranges::distance(sequence_collection1)));
+        assert(end_coordinates.empty() ||
+               end_coordinates.size() >= static_cast<size_t>(std::ranges::distance(sequence_collection1)));
+
+        size_t const collection_size = std::ranges::distance(sequence_collection1);
+        std::ranges::fill(scores.first(collection_size), std::numeric_limits<score_t>::lowest());
+
+        auto sequence1_at = [&] (size_t const pair) {
+            return std::views::all(std::ranges::begin(sequence_collection1)[pair]);
+        };
+        auto sequence2_at = [&] (size_t const pair) {
+            return std::views::all(std::ranges::begin(sequence_collection2)[pair]);
+        };
+
+        compute_impl(collection_size,
+                     sequence1_at,
+                     sequence2_at,
+                     [&] (size_t const pair,
+                          auto const segment_score,
+                          alignment_coordinate const & segment_end_coordinate,
+                          bool const is_finished) {
+                         score_t const score = next_score(scores[pair],
+                                                          static_cast<score_t>(segment_score),
+                                                          is_finished);
+                         if (!end_coordinates.empty() && takes_segment(scores[pair], score, is_finished))
+                             end_coordinates[pair] = segment_end_coordinate;
+
+                         scores[pair] = score;
+                     },
+                     own_workspace());
+    }
+
+    //!\brief Returns the cell statistics of the last call to compute.
+    batch_statistics const & statistics() const noexcept
+    {
+        return _statistics;
+    }
+
+private:
+
+    // Returns the score of a pair after one of its segments was computed.
+    template <typename score_t>
+    static constexpr score_t next_score(score_t const score, score_t const segment_score, bool const is_finished)
+        noexcept
+    {
+        if constexpr (is_local)
+            return std::max(score, segment_score);
+        else
+            return is_finished ? segment_score : score;
+    }
+
+    // Whether the optimum of a pair moved into the last computed segment.
+    template <typename score_t>
+    static constexpr bool takes_segment(score_t const score, score_t const next_score, bool const is_finished)
+        noexcept
+    {
+        if constexpr (is_local)
+            return next_score > score;
+        else
+            return is_finished;
+    }
+
+    workspace_t & own_workspace()
+    {
+        if (!_workspace)
+            _workspace.emplace(dp_vector_refill_factory(dp_algorithm_t::column_vector()),
+                               dp_vector_refill_factory(dp_algorithm_t::row_vector()));
+
+        return *_workspace;
+    }
+
+    template <typename sequence_collection1_t, typename sequence_collection2_t, typename refill_workspace_t>
+    auto compute_results(sequence_collection1_t && sequence_collection1,
+                         sequence_collection2_t && sequence_collection2,
+                         refill_workspace_t & workspace)
+    {
+        assert(std::ranges::distance(sequence_collection1) == std::ranges::distance(sequence_collection2));
+
+        using sequence1_t = std::views::all_t<std::ranges::range_reference_t<sequence_collection1_t>>;
+        using sequence2_t = std::views::all_t<std::ranges::range_reference_t<sequence_collection2_t>>;
+        using lane_sequence1_t = std::ranges::subrange<std::ranges::iterator_t<sequence1_t const>>;
+        using lane_sequence2_t = std::ranges::subrange<std::ranges::iterator_t<sequence2_t const>>;
+        using lane_sequences1_t = std::array<lane_sequence1_t, max_bulk_size>;
+        using lane_sequences2_t = std::array<lane_sequence2_t, max_bulk_size>;
+        using score_t = std::remove_cvref_t<decltype(dp_algorithm_t::run(std::declval<lane_sequences1_t &>(),
+                                                                          std::declval<lane_sequences2_t &>(),
+                                                                          std::move(workspace.dp_column()),
+                                                                          std::move(workspace.dp_row())).score()[0])>;
+        using result_t = aligner_result_score<sequence1_t, sequence2_t, score_t>;
+
+        // The results are created in the order of the input and refer to the sequences of the collections.
+        // Their scores are set as soon as the respective alignment is finished.
+        std::vector<result_t> results{};
+        results.reserve(std::ranges::distance(sequence_collection1));
+        {
+            auto it2 = std::ranges::begin(sequence_collection2);
+            for (auto it1 = std::ranges::begin(sequence_collection1);
+                 it1 != std::ranges::end(sequence_collection1);
+                 ++it1, ++it2) {
+                results.emplace_back(std::views::all(*it1),
+                                     std::views::all(*it2),
+                                     std::numeric_limits<score_t>::lowest());
+            }
+        }
+
+        compute_impl(results.size(),
+                     [&] (size_t const pair) -> sequence1_t const & { return results[pair].sequence1(); },
+                     [&] (size_t const pair) -> sequence2_t const & { return results[pair].sequence2(); },
+                     [&] (size_t const pair,
+                          score_t const segment_score,
+                          alignment_coordinate const &,
+                          bool const is_finished) {
+                         results[pair] = result_t{results[pair].sequence1(),
+                                                  results[pair].sequence2(),
+                                                  next_score(results[pair].score(), segment_score, is_finished)};
+                     },
+                     workspace);
+
+        return results;
+    }
+
+    template <typename sequence1_at_t, typename sequence2_at_t, typename record_score_t, typename refill_workspace_t>
+    void compute_impl(size_t const collection_size,
+                      sequence1_at_t && sequence1_at,
+                      sequence2_at_t && sequence2_at,
+                      record_score_t && record_score,
+                      refill_workspace_t & workspace)
+    {
+        using sequence1_t = std::remove_cvref_t<std::invoke_result_t<sequence1_at_t &, size_t>>;
+        using sequence2_t = std::remove_cvref_t<std::invoke_result_t<sequence2_at_t &, size_t>>;
+        using lane_sequence1_t = std::ranges::subrange<std::ranges::iterator_t<sequence1_t const>>;
+        using lane_sequence2_t = std::ranges::subrange<std::ranges::iterator_t<sequence2_t const>>;
+
+        _sizes1.clear();
+        _sizes2.clear();
+        for (size_t pair = 0; pair < collection_size; ++pair) {
+            _sizes1.push_back(std::ranges::distance(sequence1_at(pair)));
+            _sizes2.push_back(std::ranges::distance(sequence2_at(pair)));
+        }
+
+        // Dispatch the pairs in decreasing order of their sizes. Ties are broken by the input position, which keeps
+        // the order deterministic without the temporary buffer of a stable sort.
+        _schedule.resize(collection_size);
+        std::iota(_schedule.begin(), _schedule.end(), 0);
+        std::ranges::sort(_schedule, [&] (size_t const lhs, size_t const rhs) {
+            return std::tuple{_sizes1[lhs], _sizes2[lhs], rhs} > std::tuple{_sizes1[rhs], _sizes2[rhs], lhs};
+        });
+
+        std::array<lane_sequence1_t, max_bulk_size> lane_sequences1{};
+        std::array<lane_sequence2_t, max_bulk_size> lane_sequences2{};
+        std::array<size_t, max_bulk_size> lane_pairs{};
+        std::array<size_t, max_bulk_size> lane_progress{};
+        lane_pairs.fill(no_pair);
+
+        _statistics = batch_statistics{};
+
+        for (size_t next_pair = 0;;) {
+            workspace.dp_column().reset_lanes();
+            workspace.dp_row().reset_lanes();
+
+            size_t max_size1 = 0;
+            size_t max_segment_size = 0;
+            size_t useful_cell_count = 0;
+            bool has_active_lane = false;
+
+            for (size_t lane = 0; lane < max_bulk_size; ++lane) {
+                if (lane_pairs[lane] != no_pair) { // Continue the alignment in this lane.
+                    workspace.dp_column().carry_lane(lane);
+                } else if (next_pair < collection_size) { // Refill the lane with the next pair.
+                    lane_pairs[lane] = _schedule[next_pair++];
+                    lane_progress[lane] = 0;
+                } else { // No pair left to fill the lane.
+                    lane_sequences1[lane] = lane_sequence1_t{};
+                    lane_sequences2[lane] = lane_sequence2_t{};
+                    continue;
+                }
+
+                size_t const pair = lane_pairs[lane];
+                size_t const first = lane_progress[lane];
+                size_t const last = std::min(first + _segment_width, _sizes2[pair]);
+                auto sequence1_begin = std::ranges::begin(sequence1_at(pair));
+                auto sequence2_begin = std::ranges::begin(sequence2_at(pair));
+
+                lane_sequences1[lane] = lane_sequence1_t{sequence1_begin, std::ranges::next(sequence1_begin,
+                                                                                            _sizes1[pair])};
+                lane_sequences2[lane] = lane_sequence2_t{std::ranges::next(sequence2_begin, first),
+                                                         std::ranges::next(sequence2_begin, last)};
+                workspace.dp_row().shift_lane(lane, first);
+
+                max_size1 = std::max(max_size1, _sizes1[pair]);
+                max_segment_size = std::max(max_segment_size, last - first);
+                useful_cell_count += _sizes1[pair] * (last - first);
+                has_active_lane = true;
+            }
+
+            if (!has_active_lane)
+                break;
+
+            size_t const segment_cell_count = max_bulk_size * max_size1 * max_segment_size;
+            _statistics.cell_count += segment_cell_count;
+            _statistics.padded_cell_count += segment_cell_count - useful_cell_count;
+
+            using dp_column_t = std::remove_reference_t<decltype(workspace.dp_column())>;
+            using dp_row_t = std::remove_reference_t<decltype(workspace.dp_row())>;
+            auto result = workspace.run([this, &lane_sequences1, &lane_sequences2] (dp_column_t dp_column,
+                                                                                   dp_row_t dp_row) {
+                return dp_algorithm_t::run(lane_sequences1, lane_sequences2, std::move(dp_column), std::move(dp_row));
+            });
+
+            for (size_t lane = 0; lane < max_bulk_size; ++lane) {
+                size_t const pair = lane_pairs[lane];
+                if (pair == no_pair)
+                    continue;
+
+                // The segment covers the columns [segment_begin, lane_progress) of the second sequence.
+                size_t const segment_begin = lane_progress[lane];
+                lane_progress[lane] += std::ranges::distance(lane_sequences2[lane]);
+                bool const is_finished = lane_progress[lane] == _sizes2[pair];
+
+                alignment_coordinate segment_end_coordinate = result.end_coordinate()[lane];
+                segment_end_coordinate.sequence2_position += segment_begin;
+                record_score(pair, result.score()[lane], segment_end_coordinate, is_finished);
+
+                if (is_finished)
+                    lane_pairs[lane] = no_pair;
+            }
+        }
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -18,8 +18,11 @@
 #include <memory>
 #include <optional>
 #include <ranges>
+#include <span>
 
+#include <pairwise_aligner/matrix/dp_vector_workspace.hpp>
 #include <pairwise_aligner/result/aligner_result_bulk.hpp>
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
 
 namespace seqan::pairwise_aligner
 {
@@ -38,6 +41,16 @@ using interface_one_to_one_bulk = typename _interface_one_to_one_bulk<dp_algorit
 template <typename dp_algorithm_t, size_t max_bulk_size>
 struct _interface_one_to_one_bulk<dp_algorithm_t, max_bulk_size>::type : protected dp_algorithm_t
 {
+private:
+    using workspace_t = dp_vector_workspace<typename dp_algorithm_t::column_vector_type,
+                                            typename dp_algorithm_t::row_vector_type>;
+
+    // The workspace kept between calls to compute_scores, such that repeated calls do not allocate. It is created by
+    // the first call, since creating the dp vectors may allocate and the constructor shall not throw.
+    std::optional<workspace_t> _workspace{};
+
+public:
+
     explicit type(dp_algorithm_t algorithm) noexcept : dp_algorithm_t{std::move(algorithm)}
     {}
 
@@ -98,6 +111,59 @@ struct _interface_one_to_one_bulk<dp_algorithm_t, max_bulk_size>::type : protect
 
         return results;
     }
+
+    /*!\brief Writes the score of the i-th pair of the bulk into `scores[i]` without creating result objects.
+     *
+     * If `end_coordinates` is not empty, the cell of the optimal score of the i-th pair is written into
+     * `end_coordinates[i]`.
+     */
+    template <std::ranges::forward_range sequence_bulk1_t,
+              std::ranges::forward_range sequence_bulk2_t,
+              typename score_t>
+        requires (std::ranges::forward_range<std::ranges::range_reference_t<sequence_bulk1_t>> &&
+                  std::ranges::forward_range<std::ranges::range_reference_t<sequence_bulk2_t>>) &&
+                 (std::ranges::viewable_range<std::ranges::range_reference_t<sequence_bulk1_t>> &&
+                  std::ranges::viewable_range<std::ranges::range_reference_t<sequence_bulk2_t>>)
+    void compute_scores(sequence_bulk1_t && sequence_bulk1,
+                        sequence_bulk2_t && sequence_bulk2,
+                        std::span<score_t> scores,
+                        std::span<alignment_coordinate> end_coordinates = {})
+    {
+        assert(static_cast<size_t>(std::ranges::distance(sequence_bulk1)) <= max_bulk_size);
+        assert(static_cast<size_t>(std::ranges::distance(sequence_bulk2)) <= max_bulk_size);
+        assert(std::ranges::distance(sequence_bulk1) == std::ranges::distance(sequence_bulk2));
+        assert(scores.size() >= static_cast<size_t>(std::ranges::distance(sequence_bulk2)));
+        assert(end_coordinates.empty() ||
+               end_coordinates.size() >= static_cast<size_t>(std::ranges::distance(sequence_bulk2)));
+
+        using dp_column_t = typename dp_algorithm_t::column_vector_type;
+        using dp_row_t = typename dp_algorithm_t::row_vector_type;
+
+        size_t const bulk_size = std::ranges::distance(sequence_bulk2);
+        auto result = own_workspace().run([&] (dp_column_t dp_column, dp_row_t dp_row) {
+            return dp_algorithm_t::run(std::forward<sequence_bulk1_t>(sequence_bulk1),
+                                       std::forward<sequence_bulk2_t>(sequence_bulk2),
+                                       std::move(dp_column),
+                                       std::move(dp_row));
+        });
+
+        for (size_t result_idx = 0; result_idx < bulk_size; ++result_idx)
+            scores[result_idx] = static_cast<score_t>(result.score()[result_idx]);
+
+        if (!end_coordinates.empty())
+            for (size_t result_idx = 0; result_idx < bulk_size; ++result_idx)
+                end_coordinates[result_idx] = result.end_coordinate()[result_idx];
+    }
+
+private:
+
+    workspace_t & own_workspace()
+    {
+        if (!_workspace)
+            _workspace.emplace(dp_algorithm_t::column_vector(), dp_algorithm_t::row_vector());
+
+        return *_workspace;
+    }
 };
 
 } // inline namespace v1
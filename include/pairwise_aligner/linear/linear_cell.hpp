@@ -0,0 +1,102 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::linear_cell.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <concepts>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <pairwise_aligner/type_traits.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief The cell of the linear gap model.
+ *
+ * The column cells only store the best score, since the horizontal gap score is derived from it in every cell.
+ * The row cells additionally store the vertical gap score next to the best score, because the matrix rotates the
+ * best scores of the row to cache the diagonal score of the next row in them.
+ */
+template <typename score_t, dp_vector_order order>
+struct linear_cell : public dp_cell_base<order>,
+                     public std::conditional_t<order == dp_vector_order::row,
+                                               std::pair<score_t, score_t>,
+                                               std::tuple<score_t>>
+{
+    using base_t = std::conditional_t<order == dp_vector_order::row, std::pair<score_t, score_t>, std::tuple<score_t>>;
+    using score_type = score_t;
+
+    using base_t::base_t;
+
+    linear_cell() = default;
+
+    template <typename other_score_t>
+        requires std::constructible_from<score_t, other_score_t const &>
+    explicit linear_cell(linear_cell<other_score_t, order> const & other_cell) :
+        base_t{static_cast<typename linear_cell<other_score_t, order>::base_t const &>(other_cell)}
+    {}
+
+    template <typename other_score_t>
+        requires std::constructible_from<score_t, other_score_t>
+    explicit linear_cell(linear_cell<other_score_t, order> && other_cell) :
+        base_t{static_cast<typename linear_cell<other_score_t, order>::base_t &&>(other_cell)}
+    {}
+
+    template <typename other_score_t>
+        requires std::assignable_from<score_t &, other_score_t const &>
+    linear_cell & operator=(linear_cell<other_score_t, order> const & other_cell)
+    {
+        static_cast<base_t &>(*this) = static_cast<typename linear_cell<other_score_t, order>::base_t const &>(
+                                            other_cell);
+        return *this;
+    }
+
+    template <typename other_score_t>
+        requires std::assignable_from<score_t &, other_score_t>
+    linear_cell & operator=(linear_cell<other_score_t, order> && other_cell)
+    {
+        static_cast<base_t &>(*this) = static_cast<typename linear_cell<other_score_t, order>::base_t &&>(other_cell);
+        return *this;
+    }
+
+    constexpr score_t & score() noexcept
+    {
+        return std::get<0>(static_cast<base_t &>(*this));
+    }
+
+    constexpr score_t const & score() const noexcept
+    {
+        return std::get<0>(static_cast<base_t const &>(*this));
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
+
+namespace std
+{
+
+template <typename score_t, seqan::pairwise_aligner::dp_vector_order order>
+struct tuple_size<seqan::pairwise_aligner::linear_cell<score_t, order>> :
+    tuple_size<typename seqan::pairwise_aligner::linear_cell<score_t, order>::base_t>
+{};
+
+template <size_t idx, typename score_t, seqan::pairwise_aligner::dp_vector_order order>
+struct tuple_element<idx, seqan::pairwise_aligner::linear_cell<score_t, order>> :
+    tuple_element<idx, typename seqan::pairwise_aligner::linear_cell<score_t, order>::base_t>
+{};
+
+} // namespace std
@@ -0,0 +1,58 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::linear_initialisation_strategy.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <pairwise_aligner/configuration/end_gap_policy.hpp>
+#include <pairwise_aligner/linear/linear_cell.hpp>
+#include <pairwise_aligner/type_traits.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+template <dp_vector_order order, typename linear_gap_model_t>
+struct linear_initialisation_strategy
+{
+    linear_gap_model_t _gap_model;
+    cfg::end_gap _rule;
+
+    template <typename score_t>
+    struct _op
+    {
+        using cell_t = linear_cell<score_t, order>;
+
+        linear_gap_model_t _gap_model;
+        cfg::end_gap _rule;
+
+        constexpr cell_t operator()(size_t const index) const noexcept
+        {
+            score_t best{0};
+            if (_rule == cfg::end_gap::penalised)
+                best = static_cast<score_t>(_gap_model.gap_score * index);
+
+            if constexpr (order == dp_vector_order::row) // the vertical gap score of the first row.
+                return cell_t{best, static_cast<score_t>(best + _gap_model.gap_score)};
+            else
+                return cell_t{best};
+        }
+    };
+
+    template <typename score_t>
+    constexpr _op<score_t> create() const noexcept
+    {
+        return _op<score_t>{_gap_model, _rule};
+    }
+};
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
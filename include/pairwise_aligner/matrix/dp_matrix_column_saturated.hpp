@@ -14,6 +14,8 @@
 
 #include <cassert>
 #include <iostream>
+#include <string>
+#include <tuple>
 
 #include <pairwise_aligner/matrix/dp_matrix_column_base.hpp>
 #include <pairwise_aligner/matrix/dp_matrix_state_handle.hpp>
@@ -128,12 +130,16 @@ protected:
                 real_score += _dp_vector.saturated_zero_offset();
 
                 auto throw_error = [&] (size_t k) {
+                    std::string cell{};
+                    std::apply([&] (auto const & ...values) {
+                        ((cell += (cell.empty() ? "" : ", ") + std::to_string(values[k])), ...);
+                    }, range()[i]);
+
                     throw std::runtime_error{" i: " + std::to_string(i) +
                                              ", k: " + std::to_string(k) +
                                              ", real_score: " + std::to_string(real_score[k]) +
                                              ", expected_score: " + std::to_string(expected_score[k]) +
-                                             ", cell: <" + std::to_string(get<0>(range()[i])[k]) + ", " +
-                                                         std::to_string(get<1>(range()[i])[k]) + ">" +
+                                             ", cell: <" + cell + ">" +
                                              ", offset: " + std::to_string(new_offset[k]) +
                                              ", zero_offset: " + std::to_string(_dp_vector.saturated_zero_offset()[k])};
                 };
@@ -143,18 +149,22 @@ protected:
                         throw_error(k);
                 }
 
-                // TODO: Make generic for different alignment cell types.
-                if (i > 0) { // Check also the gap costs for all i > 0.
-                    expected_score = large_score_t{get<1>(range()[i])} - large_score_t{new_offset};
-                    expected_score += large_score_t{_dp_vector.saturated_zero_offset()};
-
-                    real_score = get<1>(range()[i]) - new_offset;
-                    real_score += _dp_vector.saturated_zero_offset();
-
-                    for (size_t k = 0; k < score_t::size_v; ++k) {
-                        if (expected_score[k] != real_score[k])
-                            throw_error(k);
-                    }
+                // Check also the gap costs for all i > 0.
+                if (i > 0) {
+                    std::apply([&] ([[maybe_unused]] auto const & best_score, auto const & ...gap_scores) {
+                        ([&] (auto const & gap_score) {
+                            expected_score = large_score_t{gap_score} - large_score_t{new_offset};
+                            expected_score += large_score_t{_dp_vector.saturated_zero_offset()};
+
+                            real_score = gap_score - new_offset;
+                            real_score += _dp_vector.saturated_zero_offset();
+
+                            for (size_t k = 0; k < score_t::size_v; ++k) {
+                                if (expected_score[k] != real_score[k])
+                                    throw_error(k);
+                            }
+                        } (gap_scores), ...);
+                    }, range()[i]);
                 }
             }
         } catch (std::exception const & ex) {
@@ -76,8 +76,11 @@ protected:
         _is_local = saturated_mask_t{is_local};
 
         // 3. set global_offsets and local offsets
-        assert(base_t::check_saturated_arithmetic(blend(_is_local, base_t::base().saturated_zero_offset(), new_offset)));
-        base_t::reset(blend(_is_local, base_t::base().saturated_zero_offset(), new_offset));
+        // The scores of a block that was computed relative to an offset before are moved to the local zero.
+        score_t const local_frame_shift{regular_score_t{base_t::base().offset() - base_t::base().local_zero_offset()}};
+        score_t const local_reset = base_t::base().saturated_zero_offset() - local_frame_shift;
+        assert(base_t::check_saturated_arithmetic(blend(_is_local, local_reset, new_offset)));
+        base_t::reset(blend(_is_local, local_reset, new_offset));
 
         // 4. update global offset
         base_t::base().update_offset(new_offset_regular, is_local);
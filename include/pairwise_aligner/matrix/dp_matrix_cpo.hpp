@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include <pairwise_aligner/utility/priority_tag.hpp>
 
 namespace seqan::pairwise_aligner
@@ -45,6 +45,12 @@ public:
         using std::max;
         return max(substitution_model_t::score(std::forward<args_t>(args)...), static_cast<score_t>(0));
     }
+
+    //!\brief The score of a cell in which a local alignment starts.
+    constexpr auto local_zero() const noexcept
+    {
+        return static_cast<typename substitution_model_t::score_type>(0);
+    }
 };
 } // namespace detail
 
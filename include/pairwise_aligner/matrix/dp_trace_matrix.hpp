@@ -0,0 +1,178 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::dp_trace_matrix.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <pairwise_aligner/configuration/end_gap_policy.hpp>
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
+#include <pairwise_aligner/utility/cigar.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief The trace bits recorded for every cell of the dp matrix.
+ *
+ * The two lowest bits name the predecessor of the best score of the cell, or mark the first cell of a local
+ * alignment. The upper two bits are set if the vertical respectively the horizontal gap leaving the cell extends a
+ * gap instead of opening a new one.
+ */
+struct trace_code
+{
+    static constexpr uint8_t diagonal = 0b0000;
+    static constexpr uint8_t up = 0b0001;
+    static constexpr uint8_t left = 0b0010;
+    static constexpr uint8_t stop = 0b0011;
+    static constexpr uint8_t up_extension = 0b0100;
+    static constexpr uint8_t left_extension = 0b1000;
+
+    static constexpr uint8_t origin_mask = 0b0011;
+};
+
+/*!\brief Stores the trace codes of all lanes of a simd dp matrix in bit-packed form.
+ *
+ * Every cell takes 4 bits per lane. The codes of consecutive cells of one row share a simd vector, such that a
+ * vector holds 2 cells per lane for 8 bit scores and 8 cells per lane for 32 bit scores. The vectors are stored
+ * column-major, i.e. the codes of one column of the dp matrix are recorded into consecutive vectors.
+ * The first row and the first column are not recorded, since they have no predecessor within the matrix.
+ */
+template <typename score_t>
+class dp_trace_matrix
+{
+private:
+    using value_type = typename score_t::value_type;
+    using unsigned_value_type = std::make_unsigned_t<value_type>;
+
+    static constexpr size_t bits_per_cell = 4;
+    static constexpr size_t cells_per_slot = sizeof(value_type) * CHAR_BIT / bits_per_cell;
+
+    std::vector<score_t> _slots{};
+    size_t _row_count{};
+
+public:
+
+    using score_type = score_t;
+
+    //!\brief Clears the matrix and resizes it to the given dimensions, both including the initialisation cell.
+    void reset(size_t const row_count, size_t const column_count)
+    {
+        _row_count = row_count;
+        _slots.assign(row_count * ((column_count + cells_per_slot - 1) / cells_per_slot),
+                      score_t{static_cast<value_type>(0)});
+    }
+
+    //!\brief Records the trace codes of all lanes for the given cell.
+    void record(size_t const row, size_t const column, score_t const & trace) noexcept
+    {
+        _slots[slot_index(row, column)] |= (trace << static_cast<uint32_t>(slot_shift(column)));
+    }
+
+    //!\brief Returns the trace code of the given cell and lane.
+    uint8_t at(size_t const lane, size_t const row, size_t const column) const noexcept
+    {
+        unsigned_value_type const slot = static_cast<unsigned_value_type>(_slots[slot_index(row, column)][lane]);
+        return static_cast<uint8_t>((slot >> slot_shift(column)) & 0b1111);
+    }
+
+    /*!\brief Traces the path of one lane back from the given end coordinate and returns its CIGAR string.
+     *
+     * \param[in] lane The lane to trace back.
+     * \param[in, out] coordinate The end coordinate of the alignment; set to its begin coordinate on return.
+     * \param[in] leading_gap Whether gaps in the first row and the first column are free.
+     *
+     * The trace back ends in the first row or column, or in a cell whose score was reset by a local alignment.
+     * The first sequence spans the rows of the dp matrix and is the reference of the CIGAR string, i.e. a
+     * deletion ('D') consumes a symbol of the first sequence only and an insertion ('I') consumes a symbol of the
+     * second sequence only. Matches and mismatches are both reported as 'M'.
+     */
+    std::string trace_back(size_t const lane,
+                           alignment_coordinate & coordinate,
+                           cfg::leading_end_gap const leading_gap) const
+    {
+        enum struct state : uint8_t { diagonal, up, left };
+
+        size_t & row = coordinate.sequence1_position;
+        size_t & column = coordinate.sequence2_position;
+        std::string operations{};
+        operations.reserve(row + column);
+        state current_state{state::diagonal};
+
+        bool is_stopped = false;
+        while (!is_stopped && row > 0 && column > 0) {
+            switch (current_state) {
+                case state::up: {
+                    operations.push_back('D');
+                    --row;
+                    bool const extends = row > 0 && (at(lane, row, column) & trace_code::up_extension);
+                    current_state = extends ? state::up : state::diagonal;
+                    break;
+                }
+                case state::left: {
+                    operations.push_back('I');
+                    --column;
+                    bool const extends = column > 0 && (at(lane, row, column) & trace_code::left_extension);
+                    current_state = extends ? state::left : state::diagonal;
+                    break;
+                }
+                default: {
+                    switch (at(lane, row, column) & trace_code::origin_mask) {
+                        case trace_code::up: current_state = state::up; break;
+                        case trace_code::left: current_state = state::left; break;
+                        case trace_code::stop: is_stopped = true; break;
+                        default: {
+                            operations.push_back('M');
+                            --row;
+                            --column;
+                        }
+                    }
+                }
+            }
+        }
+
+        // The remaining cells of the first row or column are either free or a single gap.
+        if (!is_stopped && row > 0 && leading_gap.first_column == cfg::end_gap::penalised) {
+            operations.append(row, 'D');
+            row = 0;
+        }
+
+        if (!is_stopped && column > 0 && leading_gap.first_row == cfg::end_gap::penalised) {
+            operations.append(column, 'I');
+            column = 0;
+        }
+
+        std::ranges::reverse(operations);
+        return make_cigar(operations);
+    }
+
+private:
+
+    constexpr size_t slot_index(size_t const row, size_t const column) const noexcept
+    {
+        return (column / cells_per_slot) * _row_count + row;
+    }
+
+    static constexpr size_t slot_shift(size_t const column) noexcept
+    {
+        return bits_per_cell * (column % cells_per_slot);
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
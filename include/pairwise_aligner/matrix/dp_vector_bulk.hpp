@@ -14,6 +14,8 @@
 
 #include <algorithm>
 #include <ranges>
+#include <span>
+#include <vector>
 #include <seqan3/utility/container/aligned_allocator.hpp>
 #include <seqan3/utility/simd/views/to_simd.hpp>
 #include <seqan3/alphabet/adaptation/char.hpp>
@@ -31,6 +33,8 @@ private:
 
     dp_vector_t _dp_vector{};
     scalar_t _padding_symbol{};
+    // Reused between initialisations such that repeated runs of similar size do not allocate.
+    std::vector<simd_t, seqan3::aligned_allocator<simd_t, alignof(simd_t)>> _simd_sequence{};
 
 public:
 
@@ -89,17 +93,17 @@ public:
             max_sequence_size = std::max<size_t>(max_sequence_size, std::ranges::distance(sequence));
         });
 
-        std::vector<simd_t, seqan3::aligned_allocator<simd_t, alignof(simd_t)>> simd_sequence{};
-        simd_sequence.reserve(max_sequence_size);
+        _simd_sequence.clear();
+        _simd_sequence.reserve(max_sequence_size);
 
         auto simd_view = sequence_collection | seqan3::views::to_simd<native_simd_t>(_padding_symbol);
 
         for (auto && simd_vector_chunk : simd_view) {
             for (auto && simd_vector : simd_vector_chunk) {
-                simd_sequence.emplace_back(std::move(simd_vector));
+                _simd_sequence.emplace_back(std::move(simd_vector));
             }
         }
-        return _dp_vector.initialise(std::move(simd_sequence), std::forward<initialisation_strategy_t>(init_strategy));
+        return _dp_vector.initialise(std::span{_simd_sequence}, std::forward<initialisation_strategy_t>(init_strategy));
     }
 };
 
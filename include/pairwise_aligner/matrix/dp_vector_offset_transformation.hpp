@@ -13,7 +13,11 @@
 #pragma once
 
 #include <algorithm>
+#include <functional>
 #include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
 
 #include <seqan3/utility/container/aligned_allocator.hpp>
 
@@ -21,17 +25,23 @@ namespace seqan::pairwise_aligner
 {
 inline namespace v1
 {
-template <typename dp_vector_t, typename offset_fn_t>
+template <typename dp_vector_t, typename offset_fn_t, typename rank_t>
 class dp_vector_offset_transformation
 {
 private:
+    using offset_t = std::invoke_result_t<offset_fn_t const &, rank_t const &>;
+
     dp_vector_t _dp_vector{};
     offset_fn_t _offset_fn{};
+    // Reused between initialisations such that repeated runs of similar size do not allocate.
+    std::vector<offset_t, seqan3::aligned_allocator<offset_t, alignof(offset_t)>> _offset_sequence{};
 
 public:
 
     dp_vector_offset_transformation() = default;
-    explicit dp_vector_offset_transformation(dp_vector_t dp_vector, offset_fn_t offset_fn) :
+    explicit dp_vector_offset_transformation(dp_vector_t dp_vector,
+                                             offset_fn_t offset_fn,
+                                             std::type_identity<rank_t>) :
         _dp_vector{std::move(dp_vector)},
         _offset_fn{std::move(offset_fn)}
     {}
@@ -80,15 +90,12 @@ public:
     auto initialise(sequence_t && sequence, initialisation_strategy_t && init_strategy)
     {
         // expect simd range!
-        using offset_t = std::invoke_result_t<offset_fn_t, std::ranges::range_rvalue_reference_t<sequence_t>>;
-
-        std::vector<offset_t, seqan3::aligned_allocator<offset_t, alignof(offset_t)>> offset_sequence{};
-        offset_sequence.resize(std::ranges::distance(sequence));
-        std::ranges::move(sequence | std::views::transform([&] (auto && symbol) -> offset_t {
-            return _offset_fn(std::move(symbol));
-        }), offset_sequence.begin());
+        _offset_sequence.resize(std::ranges::distance(sequence));
+        std::ranges::copy(sequence | std::views::transform([&] (rank_t const & symbol) -> offset_t {
+            return _offset_fn(symbol);
+        }), _offset_sequence.begin());
 
-        return _dp_vector.initialise(std::move(offset_sequence),
+        return _dp_vector.initialise(std::span{_offset_sequence},
                                      std::forward<initialisation_strategy_t>(init_strategy));
     }
 };
@@ -98,12 +105,15 @@ namespace detail
 
 struct dp_vector_offset_transformation_factory_fn
 {
-    template <typename dp_vector_t, typename offset_fn_t>
-    auto operator()(dp_vector_t && dp_vector, offset_fn_t && offset_fn) const noexcept
+    template <typename dp_vector_t, typename offset_fn_t, typename rank_t>
+    auto operator()(dp_vector_t && dp_vector, offset_fn_t && offset_fn, std::type_identity<rank_t> rank) const noexcept
     {
-        return dp_vector_offset_transformation<std::remove_cvref_t<dp_vector_t>, offset_fn_t>{
+        return dp_vector_offset_transformation<std::remove_cvref_t<dp_vector_t>,
+                                               std::remove_cvref_t<offset_fn_t>,
+                                               rank_t>{
             std::forward<dp_vector_t>(dp_vector),
-            std::forward<offset_fn_t>(offset_fn)
+            std::forward<offset_fn_t>(offset_fn),
+            rank
         };
     }
 };
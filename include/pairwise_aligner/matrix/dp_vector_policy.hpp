@@ -27,6 +27,9 @@ private:
 
 public:
 
+    using column_vector_type = column_vector_t;
+    using row_vector_type = row_vector_t;
+
     dp_vector_policy() = default;
     dp_vector_policy(column_vector_t column_vector, row_vector_t row_vector) noexcept :
         _column_vector{std::move(column_vector)},
@@ -14,6 +14,9 @@
 
 #include <algorithm>
 #include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
 
 #include <seqan3/utility/container/aligned_allocator.hpp>
 
@@ -25,13 +28,27 @@ template <typename dp_vector_t, typename rank_map_t>
 class dp_vector_rank_transformation
 {
 private:
-    dp_vector_t _dp_vector{};
-    rank_map_t _rank_map{};
-
     using rank_t = typename rank_map_t::value_type;
 
+    template <typename simd_rank_t>
+    struct _scalar_rank : std::type_identity<simd_rank_t>
+    {};
+
+    template <typename simd_rank_t>
+        requires (!std::integral<simd_rank_t>)
+    struct _scalar_rank<simd_rank_t> : std::type_identity<typename simd_rank_t::value_type>
+    {};
+
+    using scalar_rank_t = typename _scalar_rank<rank_t>::type;
+
     static constexpr bool is_simd_rank_v = !std::integral<rank_t>;
 
+    dp_vector_t _dp_vector{};
+    rank_map_t _rank_map{};
+    // Reused between initialisations such that repeated runs of similar size do not allocate.
+    std::vector<rank_t, seqan3::aligned_allocator<rank_t, alignof(rank_t)>> _rank_sequence{};
+    std::vector<scalar_rank_t> _scalar_rank_sequence{};
+
 public:
 
     dp_vector_rank_transformation() = default;
@@ -83,26 +100,23 @@ public:
     template <std::ranges::forward_range sequence_t, typename initialisation_strategy_t>
     auto initialise(sequence_t && sequence, initialisation_strategy_t && init_strategy)
     {
-        std::vector<rank_t, seqan3::aligned_allocator<rank_t, alignof(rank_t)>> rank_sequence{};
-        rank_sequence.resize(std::ranges::distance(sequence));
+        _rank_sequence.resize(std::ranges::distance(sequence));
         std::ranges::copy(sequence | std::views::transform([&] (auto const & symbol) -> rank_t {
             return _rank_map[symbol];
-        }), rank_sequence.begin());
+        }), _rank_sequence.begin());
 
-        return _dp_vector.initialise(std::move(rank_sequence), std::forward<initialisation_strategy_t>(init_strategy));
+        return _dp_vector.initialise(std::span{_rank_sequence}, std::forward<initialisation_strategy_t>(init_strategy));
     }
 
     template <std::ranges::forward_range sequence_t, typename initialisation_strategy_t>
         requires (is_simd_rank_v && std::integral<std::ranges::range_value_t<sequence_t>>)
     auto initialise(sequence_t && sequence, initialisation_strategy_t && init_strategy)
     {
-        using scalar_rank_t = typename rank_t::value_type;
         // Load the sequence into a single vector of simd values.
         std::ptrdiff_t sequence_size = std::ranges::distance(sequence);
-        std::vector<scalar_rank_t> rank_sequence{};
         std::ptrdiff_t max_size = (sequence_size - 1 + rank_t::size_v) / rank_t::size_v;
-        rank_sequence.reserve(max_size * rank_t::size_v);
-        rank_sequence.resize(sequence_size);
+        _scalar_rank_sequence.reserve(max_size * rank_t::size_v);
+        _scalar_rank_sequence.resize(sequence_size);
 
         if constexpr (std::ranges::contiguous_range<sequence_t>) {
             std::ranges::for_each(std::views::iota(0, max_size), [&] (std::ptrdiff_t i) {
@@ -110,7 +124,7 @@ public:
                 rank_t tmp{};
                 tmp.load(reinterpret_cast<scalar_rank_t const *>(sequence.data()) + memory_offset);
                 tmp = _rank_map[tmp]; // convert the rank.
-                tmp.store(rank_sequence.data() + memory_offset);
+                tmp.store(_scalar_rank_sequence.data() + memory_offset);
             });
         } else {
             std::ranges::for_each(std::views::iota(0, max_size), [&] (std::ptrdiff_t i) {
@@ -122,11 +136,12 @@ public:
                     tmp[k] = sequence[k + offset];
                 }
                 tmp = _rank_map[tmp]; // convert the rank.
-                tmp.store(rank_sequence.data() + offset);
+                tmp.store(_scalar_rank_sequence.data() + offset);
             });
         }
 
-        return _dp_vector.initialise(std::move(rank_sequence), std::forward<initialisation_strategy_t>(init_strategy));
+        return _dp_vector.initialise(std::span{_scalar_rank_sequence},
+                                     std::forward<initialisation_strategy_t>(init_strategy));
     }
 };
 
@@ -0,0 +1,240 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::dp_vector_refill.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <functional>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief A dp vector over simd lanes whose lanes can be initialised independently of each other.
+ *
+ * By default every call to initialise resets the cells of all lanes with the given initialisation strategy.
+ * A lane marked with carry_lane() instead keeps the cells computed by the previous run, such that the
+ * computation of the alignment in this lane is continued. A lane marked with shift_lane() is initialised with the
+ * values of the strategy starting at the given offset, which corresponds to the first row of an alignment
+ * whose preceding columns were already computed.
+ * The marks are kept until reset_lanes() is called.
+ */
+template <typename dp_vector_t>
+class dp_vector_refill
+{
+private:
+    using cell_t = typename std::remove_cvref_t<decltype(std::declval<dp_vector_t &>()[0])>::value_type;
+    using score_t = typename cell_t::score_type;
+
+    static constexpr size_t lane_count = score_t::size_v;
+
+    dp_vector_t _dp_vector{};
+    std::vector<cell_t> _carried_cells{};
+    std::array<bool, lane_count> _carried_lanes{};
+    std::array<size_t, lane_count> _lane_offsets{};
+
+public:
+
+    dp_vector_refill() = default;
+    explicit dp_vector_refill(dp_vector_t dp_vector) : _dp_vector{std::move(dp_vector)}
+    {}
+
+    using range_type = typename dp_vector_t::range_type;
+    using value_type = typename dp_vector_t::value_type;
+    using reference = typename dp_vector_t::reference;
+    using const_reference = typename dp_vector_t::const_reference;
+
+    reference operator[](size_t const pos) noexcept(noexcept(_dp_vector[pos]))
+    {
+        return _dp_vector[pos];
+    }
+
+    const_reference operator[](size_t const pos) const noexcept(noexcept(_dp_vector[pos]))
+    {
+        return _dp_vector[pos];
+    }
+
+    constexpr size_t size() const noexcept
+    {
+        return _dp_vector.size();
+    }
+
+    dp_vector_t & base() noexcept
+    {
+        return _dp_vector;
+    }
+
+    dp_vector_t const & base() const noexcept
+    {
+        return _dp_vector;
+    }
+
+    decltype(auto) range() noexcept
+    {
+        return _dp_vector.range();
+    }
+
+    decltype(auto) range() const noexcept
+    {
+        return _dp_vector.range();
+    }
+
+    // ----------------------------------------------------------------------------
+    // Lane interface
+    // ----------------------------------------------------------------------------
+
+    void reset_lanes() noexcept
+    {
+        _carried_lanes.fill(false);
+        _lane_offsets.fill(0);
+    }
+
+    void carry_lane(size_t const lane) noexcept
+    {
+        assert(lane < lane_count);
+        _carried_lanes[lane] = true;
+    }
+
+    void shift_lane(size_t const lane, size_t const offset) noexcept
+    {
+        assert(lane < lane_count);
+        _lane_offsets[lane] = offset;
+    }
+
+    // ----------------------------------------------------------------------------
+    // Initialisation interface
+    // ----------------------------------------------------------------------------
+
+    template <typename predecessor_t>
+    struct _factory
+    {
+        predecessor_t _predecessor;
+        dp_vector_refill const & _refill;
+
+        template <typename op_t, typename mask_t>
+        struct _op
+        {
+            op_t _op;
+            dp_vector_refill const & _refill;
+            mask_t _carry_mask;
+            bool _has_carried_lanes;
+            bool _has_shifted_lanes;
+
+            constexpr auto operator()(size_t const index) noexcept
+            {
+                auto cell = _op(index);
+
+                if (_has_shifted_lanes) {
+                    for (size_t lane = 0; lane < lane_count; ++lane) {
+                        if (size_t const offset = _refill._lane_offsets[lane]; offset > 0)
+                            copy_lane(cell, _op(index + offset), lane);
+                    }
+                }
+
+                if (_has_carried_lanes && index < _refill._carried_cells.size()) {
+                    [&] <size_t ...idx> (std::index_sequence<idx...>) {
+                        ((get<idx>(cell) = blend(_carry_mask,
+                                                 get<idx>(_refill._carried_cells[index]),
+                                                 get<idx>(cell))), ...);
+                    } (std::make_index_sequence<std::tuple_size_v<decltype(cell)>>());
+                }
+
+                return cell;
+            }
+
+        private:
+
+            template <typename target_cell_t, typename source_cell_t>
+            static constexpr void copy_lane(target_cell_t & target,
+                                            source_cell_t const & source,
+                                            size_t const lane) noexcept
+            {
+                [&] <size_t ...idx> (std::index_sequence<idx...>) {
+                    ((get<idx>(target)[lane] = get<idx>(source)[lane]), ...);
+                } (std::make_index_sequence<std::tuple_size_v<target_cell_t>>());
+            }
+        };
+
+        template <typename other_score_t>
+        constexpr auto create() const noexcept
+        {
+            static_assert(std::same_as<other_score_t, score_t>,
+                          "The lanes can only be refilled with the score type of the dp vector.");
+
+            score_t carried_flags{};
+            for (size_t lane = 0; lane < lane_count; ++lane)
+                carried_flags[lane] = _refill._carried_lanes[lane];
+
+            using op_t = std::remove_reference_t<decltype(std::declval<predecessor_t>().template create<score_t>())>;
+            using mask_t = decltype(carried_flags.eq(carried_flags));
+            return _op<op_t, mask_t>{_predecessor.template create<score_t>(),
+                                     _refill,
+                                     carried_flags.eq(score_t{1}),
+                                     std::ranges::any_of(_refill._carried_lanes, std::identity{}),
+                                     std::ranges::any_of(_refill._lane_offsets, [] (size_t const offset) {
+                                         return offset > 0;
+                                     })};
+        }
+    };
+
+    template <std::ranges::forward_range sequence_t, typename initialisation_strategy_t>
+    auto initialise(sequence_t && sequence, initialisation_strategy_t && init_strategy)
+    {
+        using pure_strategy_t = std::remove_cvref_t<initialisation_strategy_t>;
+
+        _carried_cells.clear();
+        if (std::ranges::any_of(_carried_lanes, std::identity{}))
+            store_cells();
+
+        return _dp_vector.initialise(std::forward<sequence_t>(sequence),
+                                     _factory<pure_strategy_t>{std::forward<initialisation_strategy_t>(init_strategy),
+                                                               *this});
+    }
+
+private:
+
+    // Copies the cells of the previous run in the order of the sequence positions.
+    // The first cell of every subsequent chunk overlaps with the last cell of its preceding chunk.
+    void store_cells()
+    {
+        for (size_t chunk_idx = 0; chunk_idx < _dp_vector.size(); ++chunk_idx) {
+            auto && chunk = _dp_vector[chunk_idx];
+            for (size_t cell_idx = (chunk_idx > 0); cell_idx < chunk.size(); ++cell_idx)
+                _carried_cells.push_back(static_cast<cell_t>(chunk[cell_idx]));
+        }
+    }
+};
+
+namespace detail
+{
+
+struct dp_vector_refill_factory_fn
+{
+    template <typename dp_vector_t>
+    auto operator()(dp_vector_t && dp_vector) const noexcept
+    {
+        return dp_vector_refill<std::remove_cvref_t<dp_vector_t>>{std::forward<dp_vector_t>(dp_vector)};
+    }
+};
+
+} // namespace detail
+
+inline constexpr detail::dp_vector_refill_factory_fn dp_vector_refill_factory{};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
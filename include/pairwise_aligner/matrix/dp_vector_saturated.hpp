@@ -28,7 +28,8 @@ class dp_vector_saturated
 {
 private:
     using regular_score_t = typename regular_cell_t::score_type;
-    using saturated_score_t = simd_score<int8_t, regular_score_t::size_v>;
+    using saturated_score_t = typename dp_vector_t::value_type::score_type;
+    using saturated_scalar_t = typename saturated_score_t::value_type;
 
     template <bool is_const>
     struct _proxy
@@ -86,7 +87,7 @@ private:
         }
     };
 
-    dp_vector_t _dp_vector{}; // int8_t
+    dp_vector_t _dp_vector{}; // saturated scores
     regular_score_t _regular_offset{}; // int32_t
     regular_score_t _regular_zero_offset{}; // the zero offset in regular score.
     saturated_score_t _saturated_zero_offset{}; // the zero offset in saturated score.
@@ -99,7 +100,7 @@ public:
     using const_reference = _proxy<true>;
 
     dp_vector_saturated() = default;
-    explicit dp_vector_saturated(dp_vector_t dp_vector, int8_t zero_offset) :
+    explicit dp_vector_saturated(dp_vector_t dp_vector, saturated_scalar_t zero_offset) :
         _dp_vector{std::move(dp_vector)},
         _regular_zero_offset{static_cast<typename regular_score_t::value_type>(zero_offset)},
         _saturated_zero_offset{zero_offset}
@@ -166,6 +167,7 @@ public:
     {
         predecessor_t _predecessor;
         regular_score_t & _regular_offset;
+        regular_score_t const & _regular_zero_offset;
 
         template <typename op_t>
         struct _op
@@ -173,29 +175,32 @@ public:
             using small_cell_t = typename dp_vector_t::value_type;
             op_t _op;
             regular_score_t & _regular_offset;
+            regular_score_t const & _regular_zero_offset;
             bool _first_call{true};
 
             constexpr small_cell_t operator()(size_t const index) noexcept
             {
-                auto scalar_cell = _op(index);
+                // The initial values are generated per lane, such that every lane can start from different scores.
+                auto regular_cell = _op(index);
                 if (_first_call)
                 {
-                    _regular_offset = regular_score_t{scalar_cell.score()};
+                    // Store the scores relative to the first cell shifted by the zero offset, which is the same
+                    // representation the column has after its first offset update.
+                    _regular_offset = regular_cell.score() - _regular_zero_offset;
                     _first_call = false;
                 }
 
-                std::apply([this] (auto & ...values) { ((values -= _regular_offset[0]), ...); }, scalar_cell);
-                return small_cell_t{scalar_cell}; // construct simd type with relative scores.
+                std::apply([this] (auto & ...values) { ((values -= _regular_offset), ...); }, regular_cell);
+                return small_cell_t{regular_cell}; // construct simd type with relative scores.
             }
         };
 
         template <typename score_t>
         constexpr auto create() const noexcept
         {
-            using score_value_t = typename regular_score_t::value_type;
             using op_t = std::remove_reference_t<decltype(std::declval<predecessor_t>().template
-                create<score_value_t>())>;
-            return _op<op_t>{_predecessor.template create<score_value_t>(), _regular_offset};
+                create<regular_score_t>())>;
+            return _op<op_t>{_predecessor.template create<regular_score_t>(), _regular_offset, _regular_zero_offset};
         }
     };
 
@@ -203,7 +208,9 @@ public:
     auto initialise(sequence_t && sequence, factory_t && init_factory)
     {
         return _dp_vector.initialise(std::forward<sequence_t>(sequence),
-                                     _factory<factory_t>{std::forward<factory_t>(init_factory), _regular_offset});
+                                     _factory<factory_t>{std::forward<factory_t>(init_factory),
+                                                         _regular_offset,
+                                                         _regular_zero_offset});
     }
 };
 
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <algorithm>
+#include <limits>
 #include <ranges>
 #include <type_traits>
 
@@ -30,6 +31,7 @@ private:
     using regular_score_t = typename regular_cell_t::score_type;
     using cell_t = typename dp_vector_t::value_type;
     using saturated_score_t = typename cell_t::score_type;
+    using saturated_scalar_t = typename saturated_score_t::value_type;
 
     template <bool is_const>
     struct _proxy
@@ -87,7 +89,7 @@ private:
         }
     };
 
-    dp_vector_t _dp_vector{}; // int8_t
+    dp_vector_t _dp_vector{}; // saturated scores
     regular_score_t _local_zero_offset{};
     regular_score_t _threshold{};
     regular_score_t _regular_offset{}; // int32_t
@@ -103,9 +105,9 @@ public:
 
     dp_vector_saturated_local() = default;
     explicit dp_vector_saturated_local(dp_vector_t dp_vector,
-                                 int8_t local_zero_offset,
-                                 int8_t global_zero_offset,
-                                 int8_t threshold) noexcept :
+                                       saturated_scalar_t local_zero_offset,
+                                       saturated_scalar_t global_zero_offset,
+                                       saturated_scalar_t threshold) noexcept :
         _dp_vector{std::move(dp_vector)},
         _local_zero_offset{static_cast<typename regular_score_t::value_type>(local_zero_offset * -1)},
         _threshold{static_cast<typename regular_score_t::value_type>(threshold)},
@@ -219,7 +221,7 @@ public:
 
                 std::apply([this] (auto & ...values) {
                     ((values = std::max<int32_t>(values - _regular_offset[0],
-                                                 std::numeric_limits<int8_t>::lowest())), ...);
+                                                 std::numeric_limits<saturated_scalar_t>::lowest())), ...);
                 }, scalar_cell);
 
                 return small_cell_t{scalar_cell};
@@ -0,0 +1,97 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::dp_vector_workspace.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <concepts>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief Keeps the dp column and the dp row of an aligner between its runs.
+ *
+ * The dp vectors are handed to a run and taken back from its result afterwards, such that the memory they
+ * allocated is reused by the next run. If a run throws, the dp vectors are reset to the ones given on construction.
+ */
+template <typename dp_column_t, typename dp_row_t>
+class dp_vector_workspace
+{
+private:
+    dp_column_t _dp_column;
+    dp_row_t _dp_row;
+    dp_column_t _initial_dp_column;
+    dp_row_t _initial_dp_row;
+
+public:
+
+    dp_vector_workspace() = delete;
+    explicit dp_vector_workspace(dp_column_t dp_column, dp_row_t dp_row) :
+        _dp_column{dp_column},
+        _dp_row{dp_row},
+        _initial_dp_column{std::move(dp_column)},
+        _initial_dp_row{std::move(dp_row)}
+    {}
+
+    dp_column_t & dp_column() noexcept
+    {
+        return _dp_column;
+    }
+
+    dp_row_t & dp_row() noexcept
+    {
+        return _dp_row;
+    }
+
+    //!\brief Invokes `run_fn` with the dp vectors and returns its result, which must give the dp vectors back.
+    template <typename run_fn_t>
+        requires std::invocable<run_fn_t, dp_column_t, dp_row_t>
+    auto run(run_fn_t && run_fn)
+    {
+        try {
+            auto result = std::invoke(std::forward<run_fn_t>(run_fn), std::move(_dp_column), std::move(_dp_row));
+            _dp_column = std::move(result).dp_column();
+            _dp_row = std::move(result).dp_row();
+            return result;
+        } catch (...) {
+            _dp_column = _initial_dp_column;
+            _dp_row = _initial_dp_row;
+            throw;
+        }
+    }
+};
+
+namespace detail
+{
+
+struct dp_vector_workspace_factory_fn
+{
+    template <typename dp_column_t, typename dp_row_t>
+    auto operator()(dp_column_t && dp_column, dp_row_t && dp_row) const
+    {
+        return dp_vector_workspace<std::remove_cvref_t<dp_column_t>, std::remove_cvref_t<dp_row_t>>{
+            std::forward<dp_column_t>(dp_column),
+            std::forward<dp_row_t>(dp_row)
+        };
+    }
+};
+
+} // namespace detail
+
+inline constexpr detail::dp_vector_workspace_factory_fn dp_vector_workspace_factory{};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -14,29 +14,47 @@
 
 #include <ranges>
 
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
+
 namespace seqan::pairwise_aligner
 {
 inline namespace v1
 {
 namespace _aligner_result
 {
-template <typename sequence1_t, typename sequence2_t, typename dp_column_t, typename dp_row_t, typename score_t>
+template <typename sequence1_t,
+          typename sequence2_t,
+          typename dp_column_t,
+          typename dp_row_t,
+          typename score_t,
+          typename coordinate_t>
 struct _value
 {
     struct type;
 };
 
-template <typename sequence1_t, typename sequence2_t, typename dp_column_t, typename dp_row_t, typename score_t>
-using value = typename _value<sequence1_t, sequence2_t, dp_column_t, dp_row_t, score_t>::type;
-
-template <typename sequence1_t, typename sequence2_t, typename dp_column_t, typename dp_row_t, typename score_t>
-struct _value<sequence1_t, sequence2_t, dp_column_t, dp_row_t, score_t>::type
+template <typename sequence1_t,
+          typename sequence2_t,
+          typename dp_column_t,
+          typename dp_row_t,
+          typename score_t,
+          typename coordinate_t>
+using value = typename _value<sequence1_t, sequence2_t, dp_column_t, dp_row_t, score_t, coordinate_t>::type;
+
+template <typename sequence1_t,
+          typename sequence2_t,
+          typename dp_column_t,
+          typename dp_row_t,
+          typename score_t,
+          typename coordinate_t>
+struct _value<sequence1_t, sequence2_t, dp_column_t, dp_row_t, score_t, coordinate_t>::type
 {
     sequence1_t _sequence1;
     sequence2_t _sequence2;
     dp_column_t _dp_column;
     dp_row_t _dp_row;
     score_t _score;
+    coordinate_t _end_coordinate;
 
     dp_column_t const & dp_column() const & noexcept
     {
@@ -72,6 +90,12 @@ struct _value<sequence1_t, sequence2_t, dp_column_t, dp_row_t, score_t>::type
     {
         return _score;
     }
+
+    //!\brief The cell of the optimal score; one seqan::pairwise_aligner::alignment_coordinate per lane of a bulk.
+    coordinate_t const & end_coordinate() const noexcept
+    {
+        return _end_coordinate;
+    }
 };
 
 namespace cpo {
@@ -83,19 +107,23 @@ struct _fn
               std::ranges::viewable_range sequence2_t,
               typename dp_column_t,
               typename dp_row_t,
-              typename score_t>
+              typename score_t,
+              typename coordinate_t>
     auto operator()(sequence1_t && sequence1,
                     sequence2_t && sequence2,
                     dp_column_t dp_column,
                     dp_row_t dp_row,
-                    score_t score) const noexcept
+                    score_t score,
+                    coordinate_t end_coordinate) const noexcept
     {
-        using aligner_result_t = _aligner_result::value<sequence1_t, sequence2_t, dp_column_t, dp_row_t, score_t>;
+        using aligner_result_t =
+            _aligner_result::value<sequence1_t, sequence2_t, dp_column_t, dp_row_t, score_t, coordinate_t>;
         return aligner_result_t{std::forward<sequence1_t>(sequence1),
                                 std::forward<sequence2_t>(sequence2),
                                 std::move(dp_column),
                                 std::move(dp_row),
-                                std::move(score)};
+                                std::move(score),
+                                std::move(end_coordinate)};
     }
 };
 
@@ -0,0 +1,69 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::aligner_result_alignment.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief Extends an aligner result with the CIGAR string and the begin and end coordinate of the alignment.
+ *
+ * By default one alignment is stored for every lane of a bulk. Results of a single pair store the CIGAR string and
+ * the coordinates directly.
+ */
+template <typename aligner_result_t,
+          typename cigar_t = std::vector<std::string>,
+          typename coordinate_t = std::vector<alignment_coordinate>>
+class aligner_result_alignment : public aligner_result_t
+{
+    cigar_t _cigar{};
+    coordinate_t _begin_coordinate{};
+    coordinate_t _end_coordinate{};
+
+public:
+
+    explicit aligner_result_alignment(aligner_result_t result,
+                                      cigar_t cigar,
+                                      coordinate_t begin_coordinate,
+                                      coordinate_t end_coordinate) noexcept :
+        aligner_result_t{std::move(result)},
+        _cigar{std::move(cigar)},
+        _begin_coordinate{std::move(begin_coordinate)},
+        _end_coordinate{std::move(end_coordinate)}
+    {}
+
+    cigar_t const & cigar() const noexcept
+    {
+        return _cigar;
+    }
+
+    coordinate_t const & begin_coordinate() const noexcept
+    {
+        return _begin_coordinate;
+    }
+
+    coordinate_t const & end_coordinate() const noexcept
+    {
+        return _end_coordinate;
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
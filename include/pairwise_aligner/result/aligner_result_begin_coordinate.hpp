@@ -0,0 +1,47 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::aligner_result_begin_coordinate.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <utility>
+
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief Extends an aligner result with the begin coordinate of the local alignment.
+ *
+ * Together with the end coordinate of the wrapped result it spans the local alignment of every lane of a bulk.
+ */
+template <typename aligner_result_t, typename coordinate_t>
+class aligner_result_begin_coordinate : public aligner_result_t
+{
+    coordinate_t _begin_coordinate{};
+
+public:
+
+    explicit aligner_result_begin_coordinate(aligner_result_t result, coordinate_t begin_coordinate) noexcept :
+        aligner_result_t{std::move(result)},
+        _begin_coordinate{std::move(begin_coordinate)}
+    {}
+
+    coordinate_t const & begin_coordinate() const noexcept
+    {
+        return _begin_coordinate;
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -67,6 +67,25 @@ public:
     {
         return _result->score()[_index];
     }
+
+    //!\brief The CIGAR string of the alignment; only available if the aligner was configured to output alignments.
+    auto const & cigar() const noexcept
+        requires requires (aligner_result_t const & result) { result.cigar(); }
+    {
+        return _result->cigar()[_index];
+    }
+
+    auto const & begin_coordinate() const noexcept
+        requires requires (aligner_result_t const & result) { result.begin_coordinate(); }
+    {
+        return _result->begin_coordinate()[_index];
+    }
+
+    auto const & end_coordinate() const noexcept
+        requires requires (aligner_result_t const & result) { result.end_coordinate(); }
+    {
+        return _result->end_coordinate()[_index];
+    }
 };
 
 // namespace cpo
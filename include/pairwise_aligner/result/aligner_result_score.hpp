@@ -0,0 +1,55 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::aligner_result_score.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <ranges>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+//!\brief A result that only stores the aligned sequences and the score, but none of the dp vectors.
+template <typename sequence1_t, typename sequence2_t, typename score_t>
+class aligner_result_score
+{
+    sequence1_t _sequence1;
+    sequence2_t _sequence2;
+    score_t _score;
+
+public:
+
+    explicit aligner_result_score(sequence1_t sequence1, sequence2_t sequence2, score_t score) noexcept :
+        _sequence1{std::move(sequence1)},
+        _sequence2{std::move(sequence2)},
+        _score{std::move(score)}
+    {}
+
+    sequence1_t const & sequence1() const noexcept
+    {
+        return _sequence1;
+    }
+
+    sequence2_t const & sequence2() const noexcept
+    {
+        return _sequence2;
+    }
+
+    score_t const & score() const noexcept
+    {
+        return _score;
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
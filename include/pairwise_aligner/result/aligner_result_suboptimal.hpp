@@ -0,0 +1,50 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::aligner_result_suboptimal.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <pairwise_aligner/result/suboptimal_alignment.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief Extends an aligner result with the non-overlapping local alignments of the pair.
+ *
+ * The alignments are sorted by decreasing score, such that the first one is the optimal alignment of the wrapped
+ * result.
+ */
+template <typename aligner_result_t, typename score_t>
+class aligner_result_suboptimal : public aligner_result_t
+{
+    std::vector<suboptimal_alignment<score_t>> _suboptimal_alignments{};
+
+public:
+
+    explicit aligner_result_suboptimal(aligner_result_t result,
+                                       std::vector<suboptimal_alignment<score_t>> suboptimal_alignments) noexcept :
+        aligner_result_t{std::move(result)},
+        _suboptimal_alignments{std::move(suboptimal_alignments)}
+    {}
+
+    std::vector<suboptimal_alignment<score_t>> const & suboptimal_alignments() const noexcept
+    {
+        return _suboptimal_alignments;
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
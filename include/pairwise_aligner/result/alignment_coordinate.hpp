@@ -0,0 +1,32 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::alignment_coordinate.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+//!\brief A position in the dp matrix given as the number of symbols consumed from either sequence.
+struct alignment_coordinate
+{
+    size_t sequence1_position{};
+    size_t sequence2_position{};
+
+    constexpr bool operator==(alignment_coordinate const &) const noexcept = default;
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
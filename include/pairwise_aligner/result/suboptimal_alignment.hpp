@@ -0,0 +1,34 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::suboptimal_alignment.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+//!\brief A local alignment given by its score and the cells it begins and ends in.
+template <typename score_t>
+struct suboptimal_alignment
+{
+    score_t score{};
+    alignment_coordinate begin_coordinate{};
+    alignment_coordinate end_coordinate{};
+
+    constexpr bool operator==(suboptimal_alignment const &) const noexcept = default;
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
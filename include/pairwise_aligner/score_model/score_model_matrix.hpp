@@ -63,6 +63,21 @@ public:
         return last_diagonal + _substitution_matrix[value1 + value2]; // lookup into 1-D matrix.
     }
 
+    //!\brief Scores all cells of a simd vector of the scalar score type, e.g. the cells of an anti-diagonal.
+    template <simd::simd_type simd_score_t>
+        requires (std::same_as<typename simd_score_t::value_type, score_t>)
+    simd_score_t score(simd_score_t const & last_diagonal,
+                       simd_score_t const & values1,
+                       simd_score_t const & values2) const noexcept
+    {
+        simd_score_t substitution_scores{};
+        for (size_t lane = 0; lane < simd_score_t::size_v; ++lane) {
+            assert(static_cast<size_t>(values1[lane] + values2[lane]) < _substitution_matrix.size());
+            substitution_scores[lane] = _substitution_matrix[values1[lane] + values2[lane]];
+        }
+        return last_diagonal + substitution_scores;
+    }
+
     // TODO: Refactor into separate factory CPO.
     constexpr type make_substitution_scheme() const noexcept
     {
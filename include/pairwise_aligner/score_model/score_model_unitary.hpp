@@ -15,6 +15,7 @@
 #include <concepts>
 #include <type_traits>
 
+#include <pairwise_aligner/simd/concept.hpp>
 #include <pairwise_aligner/utility/math.hpp>
 
 namespace seqan::pairwise_aligner
@@ -49,6 +50,16 @@ public:
         _mismatch_score{std::move(mismatch_score)}
     {}
 
+    constexpr score_t match_score() const noexcept
+    {
+        return _match_score;
+    }
+
+    constexpr score_t mismatch_score() const noexcept
+    {
+        return _mismatch_score;
+    }
+
     template <typename value1_t, typename value2_t>
         requires (std::equality_comparable_with<value1_t, value2_t>)
     score_t score(score_t const & last_diagonal,
@@ -58,6 +69,16 @@ public:
         return add(last_diagonal, ((value1 == value2) ? _match_score : _mismatch_score));
     }
 
+    //!\brief Scores all cells of a simd vector of the scalar score type, e.g. the cells of an anti-diagonal.
+    template <simd::simd_type simd_score_t>
+        requires (std::same_as<typename simd_score_t::value_type, score_t>)
+    simd_score_t score(simd_score_t const & last_diagonal,
+                       simd_score_t const & values1,
+                       simd_score_t const & values2) const noexcept
+    {
+        return last_diagonal + blend(values1.eq(values2), simd_score_t{_match_score}, simd_score_t{_mismatch_score});
+    }
+
     // TODO: Refactor into separate factory CPO.
     constexpr type make_substitution_scheme() const noexcept
     {
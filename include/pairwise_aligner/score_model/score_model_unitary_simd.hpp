@@ -57,6 +57,15 @@ public:
                      }), _match_score, _mismatch_score),  last_diagonal);
     }
 
+    // Symbols stored with a narrower scalar type than the scores are widened before they are compared.
+    template <simd::simd_type value_t>
+        requires (!std::same_as<typename score_type::mask_type, typename value_t::mask_type> &&
+                  value_t::size_v == score_type::size_v)
+    score_type score(score_type const & last_diagonal, value_t const & value1, value_t const & value2) const noexcept
+    {
+        return score(last_diagonal, score_type{value1}, score_type{value2});
+    }
+
     // TODO: Refactor into separate factory CPO.
     constexpr type make_substitution_scheme() const noexcept
     {
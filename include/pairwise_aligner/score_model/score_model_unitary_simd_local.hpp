@@ -12,7 +12,10 @@
 
 #pragma once
 
+#include <limits>
+
 #include <pairwise_aligner/simd/concept.hpp>
+#include <pairwise_aligner/simd/simd_base.hpp>
 #include <pairwise_aligner/utility/math.hpp>
 
 namespace seqan::pairwise_aligner
@@ -53,6 +56,13 @@ public:
         return _zero;
     }
 
+    //!\brief The score of a cell in which a local alignment starts, i.e. the lowest score of a saturated local block.
+    constexpr score_t local_zero() const noexcept
+        requires std::same_as<score_t, simd_score_saturated<typename score_t::value_type, score_t::size_v>>
+    {
+        return score_t{std::numeric_limits<typename score_t::value_type>::lowest()};
+    }
+
     template <simd::simd_type value_t>
         requires (std::same_as<typename score_type::mask_type, typename value_t::mask_type>)
     score_type score(score_type const & last_diagonal, value_t const & value1, value_t const & value2) const noexcept
@@ -0,0 +1,130 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::simd_isa and seqan::pairwise_aligner::select_simd_kernel.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+/*!\brief Appends the simd isa of the translation unit to the name of a kernel entry point.
+ *
+ * The macro `PAIRWISE_ALIGNER_SIMD_KERNEL_ISA` is set by `pairwise_aligner_add_simd_kernels` for every compiled
+ * isa, such that the same kernel source defines one entry point per isa, e.g. `compute_scores_avx2`.
+ */
+#define PAIRWISE_ALIGNER_SIMD_KERNEL_NAME_IMPL(name, isa) name ## _ ## isa
+#define PAIRWISE_ALIGNER_SIMD_KERNEL_NAME_EXPAND(name, isa) PAIRWISE_ALIGNER_SIMD_KERNEL_NAME_IMPL(name, isa)
+#define PAIRWISE_ALIGNER_SIMD_KERNEL_NAME(name) \
+    PAIRWISE_ALIGNER_SIMD_KERNEL_NAME_EXPAND(name, PAIRWISE_ALIGNER_SIMD_KERNEL_ISA)
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+//!\brief The simd instruction sets, ordered by their capabilities, with the same levels as the test suite.
+enum class simd_isa : uint8_t
+{
+    none,
+    sse4,
+    avx2,
+    avx512bw,
+    avx512vbmi
+};
+
+namespace detail
+{
+// The instruction set the translation unit is compiled for, using the macros checked by the test suite.
+#if defined(__AVX512VBMI__)
+inline constexpr simd_isa compiled_simd_isa = simd_isa::avx512vbmi;
+#elif defined(__AVX512BW__)
+inline constexpr simd_isa compiled_simd_isa = simd_isa::avx512bw;
+#elif defined(__AVX2__)
+inline constexpr simd_isa compiled_simd_isa = simd_isa::avx2;
+#elif defined(__SSE4_1__) && defined(__SSE4_2__)
+inline constexpr simd_isa compiled_simd_isa = simd_isa::sse4;
+#else // scalar only
+inline constexpr simd_isa compiled_simd_isa = simd_isa::none;
+#endif
+} // namespace detail
+
+/*!\brief Returns the best simd instruction set supported by the executing processor.
+ *
+ * The processor is queried via cpuid, such that the result is independent of the flags the calling translation unit
+ * was compiled with. The AVX512 levels require the extensions enabled by the kernel flags of
+ * `pairwise_aligner_add_simd_kernels`, i.e. `-march=skylake-avx512` for simd_isa::avx512bw and additionally
+ * `-mavx512vbmi` for simd_isa::avx512vbmi.
+ */
+inline simd_isa host_simd_isa() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    bool const supports_avx512bw = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512cd") &&
+                                   __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512dq") &&
+                                   __builtin_cpu_supports("avx512bw");
+    if (supports_avx512bw && __builtin_cpu_supports("avx512vbmi"))
+        return simd_isa::avx512vbmi;
+    if (supports_avx512bw)
+        return simd_isa::avx512bw;
+    if (__builtin_cpu_supports("avx2"))
+        return simd_isa::avx2;
+    if (__builtin_cpu_supports("sse4.1") && __builtin_cpu_supports("sse4.2"))
+        return simd_isa::sse4;
+#endif
+    return simd_isa::none;
+}
+
+//!\brief An entry point of a kernel compiled for the given simd instruction set.
+template <typename kernel_t>
+struct simd_kernel
+{
+    simd_isa isa{};
+    kernel_t * kernel{};
+};
+
+/*!\brief Selects the kernel compiled for the best simd instruction set that is supported by the given isa.
+ *
+ * \param kernels The entry points of the kernel, one for every compiled instruction set in any order.
+ * \param supported_isa The best instruction set the executing processor supports.
+ *                      Defaults to seqan::pairwise_aligner::host_simd_isa.
+ *
+ * \returns The entry point compiled for the best instruction set not exceeding `supported_isa`.
+ * \throws std::runtime_error if no kernel can be executed with the supported instruction set.
+ *
+ * \details
+ *
+ * The selection is done once, when the aligners are set up, and the returned entry point can be called for every
+ * subsequent alignment. A kernel compiled for simd_isa::none, which uses the scalar score models, should be given as
+ * fall back for processors that support none of the simd instruction sets.
+ */
+template <typename kernel_t, size_t kernel_count>
+inline kernel_t * select_simd_kernel(std::array<simd_kernel<kernel_t>, kernel_count> const & kernels,
+                                     simd_isa const supported_isa = host_simd_isa())
+{
+    simd_kernel<kernel_t> const * selected_kernel{nullptr};
+    for (simd_kernel<kernel_t> const & candidate : kernels) {
+        if (candidate.isa > supported_isa || candidate.kernel == nullptr)
+            continue;
+
+        if (selected_kernel == nullptr || selected_kernel->isa < candidate.isa)
+            selected_kernel = &candidate;
+    }
+
+    if (selected_kernel == nullptr)
+        throw std::runtime_error{"None of the given kernels can be executed with the simd instruction set of the "
+                                 "processor."};
+
+    return selected_kernel->kernel;
+}
+
+} // inline namespace v1
+} // namespace seqan::pairwise_aligner
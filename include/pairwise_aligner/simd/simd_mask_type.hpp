@@ -13,7 +13,9 @@
 #pragma once
 
 #include <array>
+#include <bit>
 #include <concepts>
+#include <cstdint>
 
 #include <seqan3/utility/simd/algorithm.hpp>
 #include <seqan3/utility/simd/simd_traits.hpp>
@@ -89,6 +91,15 @@ public:
         return values[index][offset];
     }
 
+    //!\brief Returns whether the mask is set for any element, without extracting the elements one by one.
+    constexpr bool any() const noexcept
+    {
+        uint64_t set_bits{};
+        for (uint64_t const word : std::bit_cast<std::array<uint64_t, sizeof(mask_type) / sizeof(uint64_t)>>(values))
+            set_bits |= word;
+        return set_bits != 0;
+    }
+
     constexpr simd_mask operator&&(simd_mask tmp) const noexcept
     {
         apply([] (native_mask_t & left, native_mask_t const & right) { left = left && right; },
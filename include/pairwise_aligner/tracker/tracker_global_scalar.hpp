@@ -13,8 +13,10 @@
 #pragma once
 
 #include <cassert>
+#include <utility>
 
 #include <pairwise_aligner/configuration/end_gap_policy.hpp>
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
 
 namespace seqan::pairwise_aligner
 {
@@ -33,39 +35,66 @@ public:
         return score; // no-op.
     }
 
+    constexpr void move_to(size_t const, size_t const) const noexcept
+    {} // no-op.
+
     template <typename sequence1_t, typename sequence2_t, typename dp_column_t, typename dp_row_t>
     constexpr auto max_score([[maybe_unused]] sequence1_t && sequence1,
                              [[maybe_unused]] sequence2_t && sequence2,
                              dp_column_t const & dp_column,
                              dp_row_t const & dp_row) const noexcept
+    {
+        return optimal_cell(dp_column, dp_row).first;
+    }
+
+    template <typename sequence1_t, typename sequence2_t, typename dp_column_t, typename dp_row_t>
+    constexpr alignment_coordinate optimal_coordinate([[maybe_unused]] sequence1_t && sequence1,
+                                                      [[maybe_unused]] sequence2_t && sequence2,
+                                                      dp_column_t const & dp_column,
+                                                      dp_row_t const & dp_row) const noexcept
+    {
+        return optimal_cell(dp_column, dp_row).second;
+    }
+
+private:
+
+    // The last column holds the cells (i, n) and the last row the cells (m, j).
+    template <typename dp_column_t, typename dp_row_t>
+    constexpr auto optimal_cell(dp_column_t const & dp_column, dp_row_t const & dp_row) const noexcept
     {
         assert(dp_column.size() == 1);
         assert(dp_row.size() == 1);
 
         size_t const inner_size = dp_column[0].size();
         auto best_score = dp_column[0][inner_size - 1].score();
+        alignment_coordinate best_coordinate{.sequence1_position = inner_size - 1,
+                                             .sequence2_position = dp_row[0].size() - 1};
 
         if (_end_gap.last_row == cfg::end_gap::free)
         {
-            for (size_t cell_idx = 0; cell_idx < dp_row[0].size(); ++cell_idx)
-                best_score = std::max(dp_row[0][cell_idx].score(), best_score);
+            for (size_t cell_idx = 0; cell_idx < dp_row[0].size(); ++cell_idx) {
+                if (best_score < dp_row[0][cell_idx].score()) {
+                    best_score = dp_row[0][cell_idx].score();
+                    best_coordinate.sequence2_position = cell_idx;
+                }
+            }
         }
 
         if (_end_gap.last_column == cfg::end_gap::free)
         {
-            for (size_t cell_idx = 0; cell_idx < dp_column[0].size(); ++cell_idx)
-                best_score = std::max(dp_column[0][cell_idx].score(), best_score);
+            for (size_t cell_idx = 0; cell_idx < dp_column[0].size(); ++cell_idx) {
+                if (best_score < dp_column[0][cell_idx].score()) {
+                    best_score = dp_column[0][cell_idx].score();
+                    best_coordinate = alignment_coordinate{.sequence1_position = cell_idx,
+                                                           .sequence2_position = dp_row[0].size() - 1};
+                }
+            }
         }
 
-        return best_score;
+        return std::pair{best_score, best_coordinate};
     }
-
-    // TODO: optimal_coordinate()
 };
 
-// this is the capture object which creates a new instance of a tracker every time we call it.
-// the client can provide everything here.
-// I need the factory here but some value to create it.
 struct factory
 {
     // params for free end-gaps.
@@ -12,10 +12,13 @@
 
 #pragma once
 
+#include <array>
 #include <cassert>
 #include <ranges>
+#include <utility>
 
 #include <pairwise_aligner/configuration/end_gap_policy.hpp>
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
 #include <pairwise_aligner/simd/simd_base.hpp>
 
 namespace seqan::pairwise_aligner
@@ -46,21 +49,54 @@ public:
         return score; // no-op.
     }
 
+    constexpr void move_to(size_t const, size_t const) const noexcept
+    {} // no-op.
+
     template <typename sequence1_t, typename sequences2_t, typename dp_column_t, typename dp_row_t>
     constexpr score_t max_score(sequence1_t && sequence1,
                                 sequences2_t && sequences2,
                                 dp_column_t const & dp_column,
                                 dp_row_t const & dp_row) const noexcept
     {
-        std::vector<std::views::all_t<sequence1_t>> sequence1_bulk{};
-        sequence1_bulk.resize(std::ranges::distance(sequences2), sequence1 | std::views::all);
+        return optimal_cell(std::forward<sequence1_t>(sequence1),
+                            std::forward<sequences2_t>(sequences2),
+                            dp_column,
+                            dp_row).first;
+    }
 
-        return max_score(std::move(sequence1_bulk), std::forward<sequences2_t>(sequences2), dp_column, dp_row);
+    template <typename sequence1_t, typename sequences2_t, typename dp_column_t, typename dp_row_t>
+    constexpr auto optimal_coordinate(sequence1_t && sequence1,
+                                      sequences2_t && sequences2,
+                                      dp_column_t const & dp_column,
+                                      dp_row_t const & dp_row) const noexcept
+    {
+        return optimal_cell(std::forward<sequence1_t>(sequence1),
+                            std::forward<sequences2_t>(sequences2),
+                            dp_column,
+                            dp_row).second;
     }
 
+private:
+
+    template <typename sequence1_t, typename sequences2_t, typename dp_column_t, typename dp_row_t>
+    constexpr auto optimal_cell(sequence1_t && sequence1,
+                                sequences2_t && sequences2,
+                                dp_column_t const & dp_column,
+                                dp_row_t const & dp_row) const noexcept
+    {
+        // Repeat the first sequence for every lane without materialising the bulk.
+        auto sequence1_bulk = std::views::iota(std::ptrdiff_t{0}, std::ranges::distance(sequences2))
+                            | std::views::transform([sequence1_view = std::views::all(sequence1)] (std::ptrdiff_t) {
+                                  return sequence1_view;
+                              });
+
+        return optimal_cell(std::move(sequence1_bulk), std::forward<sequences2_t>(sequences2), dp_column, dp_row);
+    }
+
+    // Returns the best score and its cell in the lane's own dp matrix.
     template <typename sequences1_t, typename sequences2_t, typename dp_column_t, typename dp_row_t>
         requires std::ranges::range<std::ranges::range_reference_t<sequences1_t>>
-    constexpr score_t max_score(sequences1_t && sequences1,
+    constexpr auto optimal_cell(sequences1_t && sequences1,
                                 sequences2_t && sequences2,
                                 dp_column_t const & dp_column,
                                 dp_row_t const & dp_row) const noexcept
@@ -68,31 +104,46 @@ public:
         assert(dp_column.size() == 1);
         assert(dp_row.size() == 1);
 
+        std::ptrdiff_t const sequence_count = std::ranges::distance(sequences1);
+        std::array<alignment_coordinate, score_t::size_v> best_coordinate{};
+
         if (_end_gap.last_column == cfg::end_gap::penalised && _end_gap.last_row == cfg::end_gap::penalised) {
             score_t best_score{};
-            for (std::ptrdiff_t idx = 0; idx < std::ranges::distance(sequences1); ++idx) {
+            for (std::ptrdiff_t idx = 0; idx < sequence_count; ++idx) {
                 best_score[idx] = select_max_score(idx, sequences1[idx], sequences2[idx], dp_column[0], dp_row[0]);
+                best_coordinate[idx] = alignment_coordinate{
+                    .sequence1_position = static_cast<size_t>(std::ranges::distance(sequences1[idx])),
+                    .sequence2_position = static_cast<size_t>(std::ranges::distance(sequences2[idx]))};
             }
-            return best_score;
+            return std::pair{best_score, best_coordinate};
         }
 
         score_t best_score{std::numeric_limits<typename score_t::value_type>::lowest()};
         if (_end_gap.last_column == cfg::end_gap::free) {
-            best_score = find_max_score(sequences1, dp_column[0], sequences2, dp_row[0]);
+            auto [column_score, column_position] = find_max_score(sequences1, dp_column[0], sequences2, dp_row[0]);
+            best_score = column_score;
+            for (std::ptrdiff_t idx = 0; idx < sequence_count; ++idx) {
+                best_coordinate[idx] = alignment_coordinate{
+                    .sequence1_position = static_cast<size_t>(column_position[idx]),
+                    .sequence2_position = static_cast<size_t>(std::ranges::distance(sequences2[idx]))};
+            }
         }
 
         if (_end_gap.last_row == cfg::end_gap::free) {
-            best_score = max(best_score, find_max_score(sequences2, dp_row[0], sequences1, dp_column[0]));
+            auto [row_score, row_position] = find_max_score(sequences2, dp_row[0], sequences1, dp_column[0]);
+            for (std::ptrdiff_t idx = 0; idx < sequence_count; ++idx) {
+                if (best_score[idx] < row_score[idx]) {
+                    best_coordinate[idx] = alignment_coordinate{
+                        .sequence1_position = static_cast<size_t>(std::ranges::distance(sequences1[idx])),
+                        .sequence2_position = static_cast<size_t>(row_position[idx])};
+                }
+            }
+            best_score = max(best_score, row_score);
         }
 
-        return best_score;
+        return std::pair{best_score, best_coordinate};
     }
 
-    // TODO: optimal_coordinate()
-
-private:
-
-
     template <typename sequence_t, typename dp_vector_t>
     constexpr auto get_offsets(sequence_t && sequence, dp_vector_t && dp_vector) const noexcept
     {
@@ -129,6 +180,11 @@ private:
         return best_score - (_padding_score[simd_idx] * scale);
     }
 
+    /*!\brief Returns the best score of the projected first vector and its position in the first sequence.
+     *
+     * The position of the first cell with the best score is kept, i.e. the one closest to the first cell of the
+     * lane's own vector.
+     */
     template <typename first_sequence_t, typename first_vector_t, typename second_sequence_t, typename second_vector_t>
     constexpr auto find_max_score(first_sequence_t && first_sequence,
                                   first_vector_t && first_vector,
@@ -145,6 +201,7 @@ private:
 
         offset_simd_t start_offset_second{};
         offset_simd_t end_offset_second{};
+        offset_simd_t last_position_second{};
         score_t scale_second{};
 
         // Prepare the offsets.
@@ -158,6 +215,7 @@ private:
 
             start_offset_second[idx] = second_sequence_size + second_offset;
             end_offset_second[idx] = second_vector_size;
+            last_position_second[idx] = first_vector_size - 1 + second_sequence_size;
             scale_second[idx] = second_offset;
         }
 
@@ -165,28 +223,33 @@ private:
         // padding score from the retrieved values of the corresponding simd index.
 
         score_t best_score{std::numeric_limits<scalar_t>::lowest()};
+        offset_simd_t best_position{};
         score_t scale = _padding_score * scale_first;
         for (unsigned_scalar_t idx = 0; idx < first_vector.size(); ++idx) {
             offset_simd_t simd_idx{idx};
+            score_t const candidate = first_vector[idx].score() - scale;
 
             auto mask = (start_offset_first.le(simd_idx) && simd_idx.lt(end_offset_first));
-            best_score = mask_max(best_score, mask, best_score, first_vector[idx].score() - scale);
+            best_position = blend(mask && best_score.lt(candidate), simd_idx - start_offset_first, best_position);
+            best_score = mask_max(best_score, mask, best_score, candidate);
         }
 
         // Note if second_offset is less than first_offset, the last (first_offset - second_offset) elements of the
         // second vector must be considered as well; these cells contain the values of the projected first vector, which
         // breaks around the cell (n, m) of the extended simd matrix.
-        // This slice starts at the projected second vector cell.
+        // This slice starts at the projected second vector cell and walks the first vector backwards.
         scale = _padding_score * scale_second;
         for (unsigned_scalar_t idx = 0; idx < second_vector.size(); ++idx) {
             offset_simd_t simd_idx{idx};
+            score_t const candidate = second_vector[idx].score() - scale;
 
             auto mask = (start_offset_second.le(simd_idx) && simd_idx.lt(end_offset_second));
-            best_score = mask_max(best_score, mask, best_score, second_vector[idx].score() - scale);
+            best_position = blend(mask && best_score.lt(candidate), last_position_second - simd_idx, best_position);
+            best_score = mask_max(best_score, mask, best_score, candidate);
             scale = mask_add(scale, mask, scale, _padding_score);
         }
 
-        return best_score;
+        return std::pair{best_score, best_position};
     }
 
     template <typename cell_t>
@@ -12,9 +12,14 @@
 
 #pragma once
 
+#include <array>
 #include <cassert>
+#include <ranges>
+#include <tuple>
+#include <utility>
 
 #include <pairwise_aligner/configuration/end_gap_policy.hpp>
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
 #include <pairwise_aligner/simd/simd_score_type.hpp>
 
 namespace seqan::pairwise_aligner
@@ -100,18 +105,26 @@ public:
                                      " row size of 2^24 - 1."};
     }
 
+    // Returns the best score of the last column and the positions of its cell in both sequences.
     constexpr auto in_column(score_t const & padding_score) const noexcept
     {
         auto [column_offsets, row_offsets] = get_offsets();
-        return max(run_first(_dp_column, _dp_column_size, _sequence1_sizes, column_offsets, padding_score),
-                   run_second(_dp_row, _dp_row_size, _sequence2_sizes, row_offsets, padding_score));
+        auto [best_score, best_position] =
+            select_best(run_first(_dp_column, _dp_column_size, _sequence1_sizes, column_offsets, padding_score),
+                        run_second(_dp_row, _dp_row_size, _dp_column_size, _sequence2_sizes, row_offsets,
+                                   padding_score));
+        return std::tuple{best_score, best_position, _sequence2_sizes};
     }
 
+    // Returns the best score of the last row and the positions of its cell in both sequences.
     constexpr auto in_row(score_t const & padding_score) const noexcept
     {
         auto [column_offsets, row_offsets] = get_offsets();
-        return max(run_first(_dp_row, _dp_row_size, _sequence2_sizes, row_offsets, padding_score),
-                   run_second(_dp_column, _dp_column_size, _sequence1_sizes, column_offsets, padding_score));
+        auto [best_score, best_position] =
+            select_best(run_first(_dp_row, _dp_row_size, _sequence2_sizes, row_offsets, padding_score),
+                        run_second(_dp_column, _dp_column_size, _dp_row_size, _sequence1_sizes, column_offsets,
+                                   padding_score));
+        return std::tuple{best_score, _sequence1_sizes, best_position};
     }
 
 private:
@@ -122,6 +135,23 @@ private:
                          score_t{static_cast<scalar_t>(_dp_column_size - 1)} - _sequence1_sizes};
     }
 
+    // The first run wins a tie, since its cells come first in the projected dp vector.
+    static constexpr auto select_best(std::pair<score_t, score_t> const & first,
+                                      std::pair<score_t, score_t> const & second) noexcept
+    {
+        return std::pair{max(first.first, second.first),
+                         blend(first.first.lt(second.first), second.second, first.second)};
+    }
+
+    // The position of the cell within the dp vector, composed of the chunk index and the position in the chunk.
+    template <typename dp_vector_t>
+    static constexpr score_t vector_position(dp_vector_t const & dp_vector,
+                                             size_t const chunk_idx,
+                                             vec_uint8_t const & chunk_position) noexcept
+    {
+        return score_t{static_cast<scalar_t>(chunk_idx * (dp_vector[0].size() - 1))} + score_t{chunk_position};
+    }
+
     template <typename dp_vector_t>
     auto run_first(dp_vector_t const & dp_vector,
                    size_t const dp_vector_size,
@@ -131,11 +161,13 @@ private:
     {
         // Global states
         score_t best_score{std::numeric_limits<scalar_t>::lowest()};
+        score_t best_position{};
         score_t const score_correction = padding_score * vector_offsets;
         score_t const mask_infinity{std::numeric_limits<int8_t>::lowest()};
         size_t const chunk_count = dp_vector.size();
 
         vec_int8_t local_max_score{std::numeric_limits<int8_t>::lowest()};
+        vec_uint8_t local_max_position{};
         mask_uint8_t reached_first{};
         mask_uint8_t reached_last{};
 
@@ -144,11 +176,13 @@ private:
             if (state.chunk_position == state.chunk_end) {
                 // Get max best score.
                 auto in_range = mask_infinity.lt(score_t{local_max_score});
-                best_score = mask_max(best_score,
-                                      in_range,
-                                      best_score,
-                                      (score_t{local_max_score} + dp_vector[state.chunk_idx].offset()) -
-                                        score_correction);
+                score_t const candidate = (score_t{local_max_score} + dp_vector[state.chunk_idx].offset()) -
+                                            score_correction;
+                best_position = blend(in_range && best_score.lt(candidate),
+                                      vector_position(dp_vector, state.chunk_idx, local_max_position) -
+                                        vector_offsets,
+                                      best_position);
+                best_score = mask_max(best_score, in_range, best_score, candidate);
 
                 if (++state.chunk_idx == chunk_count) {
                     return false;
@@ -164,7 +198,11 @@ private:
             mask_uint8_t mask{reached_first & ~reached_last};
 
             auto const & base_chunk = dp_vector[state.chunk_idx].base(); // TODO: No guarantee that base is what it is supposed to be!
-            local_max_score = mask_max(local_max_score, mask, local_max_score, base_chunk[state.chunk_position].score());
+            vec_int8_t const value = base_chunk[state.chunk_position].score();
+            local_max_position = blend(mask && local_max_score.lt(value),
+                                       vec_uint8_t{static_cast<uint8_t>(state.chunk_position)},
+                                       local_max_position);
+            local_max_score = mask_max(local_max_score, mask, local_max_score, value);
             return true;
         };
 
@@ -183,25 +221,33 @@ private:
             run_level1(state, find);
         }
 
-        return best_score;
+        return std::pair{best_score, best_position};
     }
 
+    // The cells of the second vector project the first vector backwards, such that the position of the first
+    // sequence decreases with every cell. The projection ends in the cell of the first position of the sequence;
+    // the cells behind it do not belong to the lane's matrix.
     template <typename dp_vector_t>
     auto run_second(dp_vector_t const & dp_vector,
                     size_t const dp_vector_size,
+                    size_t const other_dp_vector_size,
                     score_t const & sequence_sizes,
                     score_t const & vector_offsets,
                     score_t const & padding_score) const noexcept
     {
         // Global state!
         score_t best_score{std::numeric_limits<scalar_t>::lowest()};
+        score_t best_position{};
+        score_t const last_position = score_t{static_cast<scalar_t>(other_dp_vector_size - 1)} + sequence_sizes;
         score_t const mask_infinity{std::numeric_limits<int8_t>::lowest()};
         size_t const chunk_count = dp_vector.size();
 
         vec_int8_t local_max_score{std::numeric_limits<int8_t>::lowest()};
+        vec_uint8_t local_max_position{};
         vec_int8_t const local_padding_score{padding_score};
         vec_int8_t local_score_correction{0};
         mask_uint8_t reached_first{};
+        mask_uint8_t reached_last{};
 
         auto find = [&] (level_state & state) -> bool {
             if (state.chunk_position == state.chunk_end) {
@@ -209,11 +255,12 @@ private:
                 score_t score_correction =
                     max(score_t{static_cast<scalar_t>(state.chunk_idx * _chunk_size)} - sequence_sizes, vector_offsets) *
                         padding_score;
-                best_score = mask_max(best_score,
-                                      in_range,
-                                      best_score,
-                                      (score_t{local_max_score} + dp_vector[state.chunk_idx].offset() -
-                                        score_correction));
+                score_t const candidate = score_t{local_max_score} + dp_vector[state.chunk_idx].offset() -
+                                            score_correction;
+                best_position = blend(in_range && best_score.lt(candidate),
+                                      last_position - vector_position(dp_vector, state.chunk_idx, local_max_position),
+                                      best_position);
+                best_score = mask_max(best_score, in_range, best_score, candidate);
 
                 if (++state.chunk_idx == chunk_count)
                     return false;
@@ -226,11 +273,15 @@ private:
             }
 
             reached_first |= state.reached_first;
+            reached_last |= state.reached_last;
+            mask_uint8_t mask{reached_first & ~reached_last};
+
             auto const & base_chunk = dp_vector[state.chunk_idx].base();
-            local_max_score = mask_max(local_max_score,
-                                       reached_first,
-                                       local_max_score,
-                                       base_chunk[state.chunk_position].score() - local_score_correction);
+            vec_int8_t const value = base_chunk[state.chunk_position].score() - local_score_correction;
+            local_max_position = blend(mask && local_max_score.lt(value),
+                                       vec_uint8_t{static_cast<uint8_t>(state.chunk_position)},
+                                       local_max_position);
+            local_max_score = mask_max(local_max_score, mask, local_max_score, value);
             local_score_correction = mask_add(local_score_correction,
                                               reached_first,
                                               local_score_correction,
@@ -240,6 +291,7 @@ private:
 
         level_state state{
             .begin_position = min(sequence_sizes + vector_offsets, score_t{static_cast<scalar_t>(dp_vector_size)}),
+            .end_position = min(last_position + score_t{1}, score_t{static_cast<scalar_t>(dp_vector_size)}),
             .chunk_end = dp_vector[0].size() - 1
         };
 
@@ -251,7 +303,7 @@ private:
             run_level1(state, find);
         }
 
-        return best_score;
+        return std::pair{best_score, best_position};
     }
 
     template <typename fn_t>
@@ -332,52 +384,102 @@ public:
         return score; // no-op.
     }
 
+    constexpr void move_to(size_t const, size_t const) const noexcept
+    {} // no-op.
+
     template <typename sequence1_t, typename sequences2_t, typename dp_column_t, typename dp_row_t>
     constexpr score_t max_score(sequence1_t && sequence1,
                                 sequences2_t && sequences2,
                                 dp_column_t const & dp_column,
                                 dp_row_t const & dp_row) const noexcept
     {
-        std::vector<std::views::all_t<sequence1_t>> sequence1_bulk{};
-        sequence1_bulk.resize(std::ranges::distance(sequences2), sequence1 | std::views::all);
+        return optimal_cell(std::forward<sequence1_t>(sequence1),
+                            std::forward<sequences2_t>(sequences2),
+                            dp_column,
+                            dp_row).first;
+    }
+
+    template <typename sequence1_t, typename sequences2_t, typename dp_column_t, typename dp_row_t>
+    constexpr auto optimal_coordinate(sequence1_t && sequence1,
+                                      sequences2_t && sequences2,
+                                      dp_column_t const & dp_column,
+                                      dp_row_t const & dp_row) const noexcept
+    {
+        return optimal_cell(std::forward<sequence1_t>(sequence1),
+                            std::forward<sequences2_t>(sequences2),
+                            dp_column,
+                            dp_row).second;
+    }
+
+    constexpr type & in_block_tracker(score_t const &) noexcept {
+        return *this;
+    }
+
+private:
+
+    template <typename sequence1_t, typename sequences2_t, typename dp_column_t, typename dp_row_t>
+    constexpr auto optimal_cell(sequence1_t && sequence1,
+                                sequences2_t && sequences2,
+                                dp_column_t const & dp_column,
+                                dp_row_t const & dp_row) const noexcept
+    {
+        // Repeat the first sequence for every lane without materialising the bulk.
+        auto sequence1_bulk = std::views::iota(std::ptrdiff_t{0}, std::ranges::distance(sequences2))
+                            | std::views::transform([sequence1_view = std::views::all(sequence1)] (std::ptrdiff_t) {
+                                  return sequence1_view;
+                              });
 
-        return max_score(std::move(sequence1_bulk), std::forward<sequences2_t>(sequences2), dp_column, dp_row);
+        return optimal_cell(std::move(sequence1_bulk), std::forward<sequences2_t>(sequences2), dp_column, dp_row);
     }
 
+    // Returns the best score and its cell in the lane's own dp matrix.
     template <typename sequences1_t, typename sequences2_t, typename dp_column_t, typename dp_row_t>
         requires std::ranges::range<std::ranges::range_reference_t<sequences1_t>>
-    constexpr score_t max_score(sequences1_t && sequences1,
+    constexpr auto optimal_cell(sequences1_t && sequences1,
                                 sequences2_t && sequences2,
                                 dp_column_t const & dp_column,
                                 dp_row_t const & dp_row) const noexcept {
+        std::ptrdiff_t const sequence_count = std::ranges::distance(sequences1);
+        std::array<alignment_coordinate, score_t::size_v> best_coordinate{};
+
         if (_end_gap.last_column == cfg::end_gap::penalised && _end_gap.last_row == cfg::end_gap::penalised) {
             score_t best_score{};
-            for (std::ptrdiff_t idx = 0; idx < std::ranges::distance(sequences1); ++idx) {
+            for (std::ptrdiff_t idx = 0; idx < sequence_count; ++idx) {
                 best_score[idx] = select_max_score(idx, sequences1[idx], sequences2[idx], dp_column, dp_row);
+                best_coordinate[idx] = alignment_coordinate{
+                    .sequence1_position = static_cast<size_t>(std::ranges::distance(sequences1[idx])),
+                    .sequence2_position = static_cast<size_t>(std::ranges::distance(sequences2[idx]))};
             }
-            return best_score;
+            return std::pair{best_score, best_coordinate};
         }
 
         using max_score_finder_t = detail::saturated_max_score_finder<score_t, dp_column_t const &, dp_row_t const &>;
         max_score_finder_t max_score_finder{dp_column, dp_row, sequences1, sequences2, _chunk_size};
 
         score_t best_score{std::numeric_limits<typename score_t::value_type>::lowest()};
+        score_t best_sequence1_position{};
+        score_t best_sequence2_position{};
         if (_end_gap.last_column == cfg::end_gap::free) {
-            best_score = max_score_finder.in_column(_padding_score);
+            std::tie(best_score, best_sequence1_position, best_sequence2_position) =
+                max_score_finder.in_column(_padding_score);
         }
 
         if (_end_gap.last_row == cfg::end_gap::free) {
-            best_score = max(best_score, max_score_finder.in_row(_padding_score));
+            auto [row_score, row_sequence1_position, row_sequence2_position] = max_score_finder.in_row(_padding_score);
+            auto is_better = best_score.lt(row_score);
+            best_score = max(best_score, row_score);
+            best_sequence1_position = blend(is_better, row_sequence1_position, best_sequence1_position);
+            best_sequence2_position = blend(is_better, row_sequence2_position, best_sequence2_position);
         }
-        return best_score;
-    }
 
-    constexpr type & in_block_tracker(score_t const &) noexcept {
-        return *this;
-    }
-    // TODO: optimal_coordinate()
+        for (std::ptrdiff_t idx = 0; idx < sequence_count; ++idx) {
+            best_coordinate[idx] = alignment_coordinate{
+                .sequence1_position = static_cast<size_t>(best_sequence1_position[idx]),
+                .sequence2_position = static_cast<size_t>(best_sequence2_position[idx])};
+        }
 
-private:
+        return std::pair{best_score, best_coordinate};
+    }
 
     template <typename sequence_t, typename dp_vector_t>
     constexpr auto get_offsets(sequence_t && sequence, dp_vector_t && dp_vector) const noexcept
@@ -411,15 +513,13 @@ private:
         size_t scale = std::min(column_offset, row_offset);
         scalar_t best_score{};
 
-        size_t const chunk_size = dp_column[0].size() - 1;
-
         if (scale == column_offset) {
             auto [chunk_id, chunk_position] =
-                to_local_position(column_sequence_size + column_offset, chunk_size, dp_column.size());
+                to_local_position(column_sequence_size + column_offset, dp_column[0].size() - 1, dp_column.size());
             best_score = score_at(dp_column[chunk_id][chunk_position], simd_idx);
         } else {
             auto [chunk_id, chunk_position] =
-                to_local_position(row_sequence_size + row_offset, chunk_size, dp_row.size());
+                to_local_position(row_sequence_size + row_offset, dp_row[0].size() - 1, dp_row.size());
             best_score = score_at(dp_row[chunk_id][chunk_position], simd_idx);
         }
 
@@ -12,7 +12,10 @@
 
 #pragma once
 
+#include <limits>
+
 #include <pairwise_aligner/configuration/end_gap_policy.hpp>
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
 
 namespace seqan::pairwise_aligner
 {
@@ -36,10 +39,21 @@ class _tracker<score_t>::type
 public:
 
     score_t _max_score{std::numeric_limits<score_t>::lowest()};
+    alignment_coordinate _optimal_coordinate{};
+    alignment_coordinate _current_coordinate{};
+
+    // The next tracked score is the one of the given cell, the scores after it are the ones of the cells to its right.
+    constexpr void move_to(size_t const sequence1_position, size_t const sequence2_position) noexcept {
+        _current_coordinate = alignment_coordinate{.sequence1_position = sequence1_position,
+                                                   .sequence2_position = sequence2_position};
+    }
 
     score_t const & track(score_t const & score) noexcept {
-        using std::max;
-        _max_score = max(_max_score, score);
+        if (_max_score < score) {
+            _max_score = score;
+            _optimal_coordinate = _current_coordinate;
+        }
+        ++_current_coordinate.sequence2_position;
         return score;
     }
 
@@ -48,12 +62,12 @@ public:
         return _max_score;
     }
 
-    // TODO: optimal_coordinate()
+    template <typename ...args_t>
+    alignment_coordinate optimal_coordinate([[maybe_unused]] args_t && ...args) const noexcept {
+        return _optimal_coordinate;
+    }
 };
 
-// this is the capture object which creates a new instance of a tracker every time we call it.
-// the client can provide everything here.
-// I need the factory here but some value to create it.
 template <typename score_t>
 struct _factory
 {
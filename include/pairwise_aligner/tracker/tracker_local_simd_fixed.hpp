@@ -12,6 +12,13 @@
 
 #pragma once
 
+#include <array>
+#include <limits>
+#include <type_traits>
+
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
+#include <pairwise_aligner/simd/simd_score_type.hpp>
+
 namespace seqan::pairwise_aligner
 {
 inline namespace v1
@@ -19,6 +26,12 @@ inline namespace v1
 
 namespace tracker::local_simd_fixed {
 
+/*!\brief Tracks the best score of every lane together with the first cell that reaches it.
+ *
+ * The scores tracked after a call to move_to() form a segment of one row. They are buffered and only compared
+ * against the best scores when the next segment begins, such that every cell costs a single maximum and a store.
+ * The coordinates of a lane are only resolved if the segment contains a strictly better score.
+ */
 template <typename score_t>
 struct _tracker
 {
@@ -33,20 +46,104 @@ class _tracker<score_t>::type
 {
 public:
 
+    //!\brief At least 32 bit positions per lane, which covers the sequence lengths independent of the score width.
+    using coordinate_type = simd_score<std::conditional_t<(sizeof(typename score_t::value_type) > sizeof(int32_t)),
+                                                          typename score_t::value_type,
+                                                          int32_t>,
+                                       score_t::size_v>;
+
+    //!\brief The number of buffered scores, which is larger than the lanes of the dp matrix blocks.
+    static constexpr size_t segment_capacity = 16;
+
     score_t _max_score{std::numeric_limits<typename score_t::value_type>::lowest()};
+    coordinate_type _max_sequence1_position{};
+    coordinate_type _max_sequence2_position{};
+
+private:
+
+    std::array<score_t, segment_capacity> _segment_scores{};
+    score_t _segment_max_score{std::numeric_limits<typename score_t::value_type>::lowest()};
+    size_t _segment_size{};
+    int32_t _sequence1_position{};
+    int32_t _sequence2_position{};
+
+public:
+
+    // The next tracked score is the one of the given cell, the scores after it are the ones of the cells to its right.
+    constexpr void move_to(size_t const sequence1_position, size_t const sequence2_position) noexcept {
+        flush();
+        _sequence1_position = static_cast<int32_t>(sequence1_position);
+        _sequence2_position = static_cast<int32_t>(sequence2_position);
+    }
 
     score_t const & track(score_t const & score) noexcept {
         using std::max;
-        _max_score = max(_max_score, score);
+        if (_segment_size == segment_capacity) [[unlikely]] {
+            flush();
+            _sequence2_position += segment_capacity;
+        }
+        _segment_scores[_segment_size++] = score;
+        _segment_max_score = max(_segment_max_score, score);
         return score;
     }
 
+    //!\brief Merges the buffered segment into the best scores and their coordinates.
+    constexpr void flush() noexcept {
+        merge_segment(_max_score, _max_sequence1_position, _max_sequence2_position);
+        _segment_max_score = score_t{std::numeric_limits<typename score_t::value_type>::lowest()};
+        _segment_size = 0;
+    }
+
     template <typename ...args_t>
     auto max_score([[maybe_unused]] args_t && ...args) const noexcept {
-        return _max_score;
+        using std::max;
+        return max(_max_score, _segment_max_score);
+    }
+
+    template <typename ...args_t>
+    auto optimal_coordinate([[maybe_unused]] args_t && ...args) const noexcept {
+        score_t max_score = _max_score;
+        coordinate_type max_sequence1_position = _max_sequence1_position;
+        coordinate_type max_sequence2_position = _max_sequence2_position;
+        merge_segment(max_score, max_sequence1_position, max_sequence2_position);
+
+        std::array<alignment_coordinate, score_t::size_v> coordinates{};
+        for (size_t lane = 0; lane < score_t::size_v; ++lane) {
+            coordinates[lane] = alignment_coordinate{
+                .sequence1_position = static_cast<size_t>(max_sequence1_position[lane]),
+                .sequence2_position = static_cast<size_t>(max_sequence2_position[lane])};
+        }
+        return coordinates;
     }
 
-    // TODO: optimal_coordinate()
+private:
+
+    // Only lanes with a strictly better score in the segment take the first cell of the segment holding it.
+    constexpr void merge_segment(score_t & max_score,
+                                 coordinate_type & max_sequence1_position,
+                                 coordinate_type & max_sequence2_position) const noexcept {
+        using std::max;
+        auto const is_better = max_score.lt(_segment_max_score);
+        if (!is_better.any())
+            return;
+
+        // The index within the segment fits into the score type, such that only the result is widened.
+        using segment_index_t = typename score_t::value_type;
+        score_t segment_index{};
+        for (size_t index = _segment_size; index > 0; --index)
+            segment_index = blend(_segment_scores[index - 1].eq(_segment_max_score),
+                                  score_t{static_cast<segment_index_t>(index - 1)},
+                                  segment_index);
+
+        coordinate_type const segment_position = coordinate_type{segment_index} +
+                                                 coordinate_type{_sequence2_position};
+        typename coordinate_type::mask_type is_better_coordinate{is_better};
+        max_score = max(max_score, _segment_max_score);
+        max_sequence1_position = blend(is_better_coordinate,
+                                       coordinate_type{_sequence1_position},
+                                       max_sequence1_position);
+        max_sequence2_position = blend(is_better_coordinate, segment_position, max_sequence2_position);
+    }
 };
 
 // this is the capture object which creates a new instance of a tracker every time we call it.
@@ -34,7 +34,11 @@ class _tracker<saturated_score_t, regular_score_t>::type
 {
 private:
 
+    using coordinate_t = typename local_simd_fixed::tracker<saturated_score_t>::coordinate_type;
+
     regular_score_t _max_score{std::numeric_limits<typename regular_score_t::value_type>::lowest()};
+    coordinate_t _max_sequence1_position{};
+    coordinate_t _max_sequence2_position{};
 
     struct _in_block_tracker : public local_simd_fixed::tracker<saturated_score_t>
     {
@@ -46,14 +50,32 @@ private:
 
     public:
         _in_block_tracker() = delete;
+        // Starts from the best scores so far, such that only the segments improving them resolve their coordinates.
         _in_block_tracker(type & parent_tracker, regular_score_t const & score_offset) noexcept :
             base_t{},
             _parent_tracker{parent_tracker},
             _score_offset{score_offset}
-        {} // initialising the local tracker
+        {
+            using saturated_value_t = typename saturated_score_t::value_type;
+            using regular_value_t = typename regular_score_t::value_type;
+            regular_score_t const lowest{std::numeric_limits<saturated_value_t>::lowest()};
+            regular_score_t const highest{std::numeric_limits<saturated_value_t>::max()};
+
+            // The initial best score of the parent is kept, since subtracting the offset would overflow.
+            regular_score_t const & max_score = _parent_tracker._max_score;
+            auto const is_initial = max_score.eq(regular_score_t{std::numeric_limits<regular_value_t>::lowest()});
+            base_t::_max_score = saturated_score_t{blend(is_initial,
+                                                         lowest,
+                                                         min(max(max_score - _score_offset, lowest), highest))};
+            base_t::_max_sequence1_position = _parent_tracker._max_sequence1_position;
+            base_t::_max_sequence2_position = _parent_tracker._max_sequence2_position;
+        }
         ~_in_block_tracker() noexcept
         {
-            _parent_tracker.track(regular_score_t{base_t::max_score()} + _score_offset);
+            base_t::flush();
+            _parent_tracker.track(regular_score_t{base_t::max_score()} + _score_offset,
+                                  base_t::_max_sequence1_position,
+                                  base_t::_max_sequence2_position);
         }
     };
 
@@ -63,8 +85,17 @@ public:
         return _in_block_tracker{*this, score_offset};
     }
 
-    constexpr void track(regular_score_t const & in_block_score) noexcept {
+    constexpr void move_to(size_t const, size_t const) const noexcept
+    {} // no-op: the cells are tracked by the in-block trackers.
+
+    // Keeps the coordinates of a block maximum only if it is strictly better, such that the first cell wins a tie.
+    constexpr void track(regular_score_t const & in_block_score,
+                         coordinate_t const & sequence1_position,
+                         coordinate_t const & sequence2_position) noexcept {
+        typename coordinate_t::mask_type is_better{_max_score.lt(in_block_score)};
         _max_score = max(_max_score, in_block_score);
+        _max_sequence1_position = blend(is_better, sequence1_position, _max_sequence1_position);
+        _max_sequence2_position = blend(is_better, sequence2_position, _max_sequence2_position);
     }
 
     template <typename ...args_t>
@@ -72,7 +103,16 @@ public:
         return _max_score;
     }
 
-    // TODO: optimal_coordinate()
+    template <typename ...args_t>
+    constexpr auto optimal_coordinate([[maybe_unused]] args_t && ...args) const noexcept {
+        std::array<alignment_coordinate, regular_score_t::size_v> coordinates{};
+        for (size_t lane = 0; lane < regular_score_t::size_v; ++lane) {
+            coordinates[lane] = alignment_coordinate{
+                .sequence1_position = static_cast<size_t>(_max_sequence1_position[lane]),
+                .sequence2_position = static_cast<size_t>(_max_sequence2_position[lane])};
+        }
+        return coordinates;
+    }
 };
 
 // this is the capture object which creates a new instance of a tracker every time we call it.
@@ -74,5 +74,13 @@ struct lazy_type
 template <typename lazy_type, typename ...types>
 using instantiate_t = typename lazy_type::type<types...>;
 
+//!\brief Defers a dp algorithm template, which is only parameterised by the implementation of the algorithm.
+template <template <typename> typename algorithm_template_t>
+struct lazy_algorithm_template
+{
+    template <typename algorithm_impl_t>
+    using type = algorithm_template_t<algorithm_impl_t>;
+};
+
 } // inline namespace v1
 }  // namespace seqan::pairwise_aligner
@@ -0,0 +1,40 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::make_cigar.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+//!\brief Run-length encodes a sequence of alignment operations, e.g. "MMDMM" becomes "2M1D2M".
+inline std::string make_cigar(std::string_view const operations)
+{
+    std::string cigar{};
+    for (auto it = operations.begin(); it != operations.end();) {
+        auto run_end = std::ranges::find_if(it, operations.end(), [&] (char const operation) {
+            return operation != *it;
+        });
+        cigar.append(std::to_string(run_end - it));
+        cigar.push_back(*it);
+        it = run_end;
+    }
+    return cigar;
+}
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
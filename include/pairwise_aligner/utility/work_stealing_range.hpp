@@ -0,0 +1,95 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::work_stealing_range.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief A lock-free range of task indices owned by one thread, from which other threads can steal.
+ *
+ * The owner takes the tasks one by one from the front of the range, while other threads steal the back half of
+ * the remaining tasks. Both ends are stored in a single atomic word, such that every operation is one
+ * compare-and-swap on the pair of bounds. Task indices are never handed out twice, since both the owner and the
+ * thieves only shrink the range they observed.
+ */
+class work_stealing_range
+{
+private:
+    std::atomic<uint64_t> _bounds{};
+
+    static constexpr uint64_t pack(uint64_t const first, uint64_t const last) noexcept
+    {
+        return (last << 32) | first;
+    }
+
+    static constexpr uint32_t first_of(uint64_t const bounds) noexcept
+    {
+        return static_cast<uint32_t>(bounds);
+    }
+
+    static constexpr uint32_t last_of(uint64_t const bounds) noexcept
+    {
+        return static_cast<uint32_t>(bounds >> 32);
+    }
+
+public:
+
+    work_stealing_range() = default;
+    work_stealing_range(work_stealing_range const &) = delete;
+    work_stealing_range & operator=(work_stealing_range const &) = delete;
+
+    //!\brief Sets the range to [first, last). Only the owner may call this while the range is empty.
+    void assign(size_t const first, size_t const last) noexcept
+    {
+        assert(first <= last);
+        assert(last <= std::numeric_limits<uint32_t>::max());
+        _bounds.store(pack(first, last), std::memory_order_release);
+    }
+
+    //!\brief Takes the next task from the front of the range.
+    std::optional<size_t> pop() noexcept
+    {
+        uint64_t bounds = _bounds.load(std::memory_order_acquire);
+        while (first_of(bounds) < last_of(bounds)) {
+            if (_bounds.compare_exchange_weak(bounds, pack(first_of(bounds) + 1, last_of(bounds)),
+                                              std::memory_order_acq_rel))
+                return first_of(bounds);
+        }
+        return std::nullopt;
+    }
+
+    //!\brief Removes the back half of the remaining tasks and returns them as [first, last).
+    std::optional<std::pair<size_t, size_t>> steal() noexcept
+    {
+        uint64_t bounds = _bounds.load(std::memory_order_acquire);
+        while (first_of(bounds) < last_of(bounds)) {
+            uint32_t const middle = first_of(bounds) + (last_of(bounds) - first_of(bounds)) / 2;
+            if (_bounds.compare_exchange_weak(bounds, pack(first_of(bounds), middle), std::memory_order_acq_rel))
+                return std::pair<size_t, size_t>{middle, last_of(bounds)};
+        }
+        return std::nullopt;
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -0,0 +1,152 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::worker_pool.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief A fixed set of threads that sleep between the jobs given to them.
+ *
+ * The threads are started once by the constructor and joined by the destructor. A call to run wakes the first
+ * `participant_count` threads, calls the job with the id of the thread on each of them and blocks until all of
+ * them have returned. Hence, repeated calls only pay for a wake-up instead of starting and joining new threads.
+ */
+class worker_pool
+{
+private:
+    std::vector<std::thread> _threads{};
+    std::mutex _mutex{};
+    std::condition_variable _start_condition{};
+    std::condition_variable _done_condition{};
+    std::function<void(size_t)> _job{};
+    size_t _participant_count{};
+    size_t _pending_count{};
+    uint64_t _generation{};
+    bool _stop{false};
+
+public:
+
+    worker_pool() = delete;
+    worker_pool(worker_pool const &) = delete;
+    worker_pool & operator=(worker_pool const &) = delete;
+
+    //!\brief Starts the threads; the i-th thread is bound to the i-th logical core if requested (linux only).
+    explicit worker_pool(size_t const thread_count, bool const pin_threads = false)
+    {
+        _threads.reserve(thread_count);
+        try {
+            for (size_t thread_id = 0; thread_id < thread_count; ++thread_id) {
+                _threads.emplace_back([this, thread_id] () { work(thread_id); });
+                if (pin_threads)
+                    pin_thread(_threads.back(), thread_id);
+            }
+        } catch (...) {
+            stop();
+            throw;
+        }
+    }
+
+    ~worker_pool()
+    {
+        stop();
+    }
+
+    //!\brief Returns the number of threads.
+    size_t size() const noexcept
+    {
+        return _threads.size();
+    }
+
+    //!\brief Calls `job(thread_id)` on the first `participant_count` threads and waits for them. Must not throw.
+    void run(size_t const participant_count, std::function<void(size_t)> job)
+    {
+        assert(participant_count <= size());
+
+        std::unique_lock lock{_mutex};
+        _job = std::move(job);
+        _participant_count = participant_count;
+        _pending_count = participant_count;
+        ++_generation;
+        _start_condition.notify_all();
+        _done_condition.wait(lock, [&] () { return _pending_count == 0; });
+        _job = nullptr;
+    }
+
+private:
+
+    void work(size_t const thread_id)
+    {
+        uint64_t seen_generation{};
+        std::unique_lock lock{_mutex};
+        for (;;) {
+            _start_condition.wait(lock, [&] () { return _stop || _generation != seen_generation; });
+            if (_stop)
+                return;
+
+            seen_generation = _generation;
+            if (thread_id >= _participant_count)
+                continue;
+
+            // The job is not modified before all participants have finished, so it is called without the lock.
+            lock.unlock();
+            _job(thread_id);
+            lock.lock();
+
+            if (--_pending_count == 0)
+                _done_condition.notify_one();
+        }
+    }
+
+    void stop() noexcept
+    {
+        {
+            std::lock_guard lock{_mutex};
+            _stop = true;
+        }
+        _start_condition.notify_all();
+        std::ranges::for_each(_threads, [] (std::thread & thread) { thread.join(); });
+        _threads.clear();
+    }
+
+    static void pin_thread([[maybe_unused]] std::thread & thread, [[maybe_unused]] size_t const thread_id) noexcept
+    {
+#if defined(__linux__)
+        size_t const core_count = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(thread_id % core_count, &cpu_set);
+        pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpu_set); // pinning is a hint only.
+#endif
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
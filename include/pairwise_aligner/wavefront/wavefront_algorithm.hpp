@@ -0,0 +1,392 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan::pairwise_aligner::wavefront_algorithm.
+ * \author Rene Rahn <rahn AT molgen.mpg.de>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <pairwise_aligner/configuration/end_gap_policy.hpp>
+#include <pairwise_aligner/result/aligner_result.hpp>
+#include <pairwise_aligner/result/alignment_coordinate.hpp>
+#include <pairwise_aligner/simd/simd_score_type.hpp>
+
+namespace seqan::pairwise_aligner
+{
+inline namespace v1
+{
+
+/*!\brief Computes the global affine alignment score with the wavefront algorithm of Marco-Sola et al.
+ *
+ * The scores are transformed into the penalties of an alignment with a match penalty of 0, such that
+ * `2 * score = match_score * (|seq1| + |seq2|) - penalty`. With the match score a, the mismatch score x, the gap open
+ * score o and the gap extension score e the penalties are 2 * (a - x) for a mismatch, -2 * o for opening a gap and
+ * a - 2 * e for every gap position, divided by their greatest common divisor.
+ * For every penalty s the furthest reaching cell on every diagonal is computed from the wavefronts of the penalties
+ * s - mismatch, s - gap open - gap extension and s - gap extension, and is extended along the matching symbols.
+ * Hence, the cost grows with the penalty of the alignment instead of the size of the dp matrix.
+ * With more than one lane, every lane of a simd vector of offsets computes another pair of the bulk. The lanes are
+ * computed until the pair with the highest penalty reached its last cell. Only the score is computed, i.e. the dp
+ * column and the dp row keep their initial values.
+ */
+template <size_t lane_count_v, typename ...policies_t>
+struct _wavefront_algorithm
+{
+    class type;
+};
+
+template <size_t lane_count_v, typename ...policies_t>
+using wavefront_algorithm = typename _wavefront_algorithm<lane_count_v, policies_t...>::type;
+
+template <size_t lane_count_v, typename ...policies_t>
+class _wavefront_algorithm<lane_count_v, policies_t...>::type : protected policies_t...
+{
+protected:
+
+    //!\brief The offset of the furthest reaching cell of a diagonal, i.e. the number of consumed symbols of seq2.
+    using offset_type = std::conditional_t<lane_count_v == 1, int32_t, simd_score<int32_t, lane_count_v>>;
+
+    //!\brief Marks a diagonal that was not reached with the current penalty.
+    static constexpr int32_t null_offset = std::numeric_limits<int32_t>::lowest() / 2;
+
+public:
+
+    //!\brief The number of pairs computed at once.
+    static constexpr size_t lane_count = lane_count_v;
+
+    type() = default;
+    explicit type(policies_t const & ...policies) : policies_t{policies}...
+    {}
+
+protected:
+
+    template <typename sequence1_t, typename sequence2_t, typename dp_column_t, typename dp_row_t>
+    auto run(sequence1_t && sequence1, sequence2_t && sequence2, dp_column_t dp_column, dp_row_t dp_row) const
+    {
+        penalties const penalty_setting = make_penalties();
+
+        if constexpr (lane_count == 1) {
+            std::array sequences1{std::ranges::ref_view{sequence1}};
+            std::array sequences2{std::ranges::ref_view{sequence2}};
+            auto [scores, end_coordinate] = compute_scores(sequences1, sequences2, 1, penalty_setting);
+
+            return aligner_result(std::forward<sequence1_t>(sequence1),
+                                  std::forward<sequence2_t>(sequence2),
+                                  std::move(dp_column),
+                                  std::move(dp_row),
+                                  scores[0],
+                                  end_coordinate[0]);
+        } else {
+            size_t const pair_count = std::ranges::distance(sequence1);
+            assert(pair_count <= lane_count);
+            assert(static_cast<size_t>(std::ranges::distance(sequence2)) == pair_count);
+
+            auto [scores, end_coordinate] = compute_scores(sequence1, sequence2, pair_count, penalty_setting);
+
+            return aligner_result(std::forward<sequence1_t>(sequence1),
+                                  std::forward<sequence2_t>(sequence2),
+                                  std::move(dp_column),
+                                  std::move(dp_row),
+                                  std::move(scores),
+                                  std::move(end_coordinate));
+        }
+    }
+
+private:
+
+    // The penalties of the alignment with a match penalty of 0.
+    struct penalties
+    {
+        int32_t match_score{};
+        int32_t divisor{};
+        int32_t mismatch{};
+        int32_t gap_open{};
+        int32_t gap_extension{};
+    };
+
+    // The furthest reaching offsets of all diagonals in [low, high] for one penalty.
+    struct wavefront
+    {
+        bool is_null{true};
+        int32_t low{};
+        int32_t high{};
+        std::vector<offset_type> matches{};
+        std::vector<offset_type> insertions{};
+        std::vector<offset_type> deletions{};
+    };
+
+    penalties make_penalties() const
+    {
+        if (this->first_column == cfg::end_gap::free || this->first_row == cfg::end_gap::free ||
+            this->last_column == cfg::end_gap::free || this->last_row == cfg::end_gap::free)
+            throw std::invalid_argument{"The wavefront alignment requires penalised end gaps."};
+
+        int32_t const match_score = this->match_score();
+        int32_t const mismatch_score = this->mismatch_score();
+        auto const [gap_open_score, gap_extension_score] = gap_scores();
+
+        penalties penalty_setting{.match_score = match_score,
+                                  .divisor = 1,
+                                  .mismatch = 2 * (match_score - mismatch_score),
+                                  .gap_open = -2 * gap_open_score,
+                                  .gap_extension = match_score - 2 * gap_extension_score};
+
+        if (penalty_setting.mismatch <= 0 || penalty_setting.gap_open < 0 || penalty_setting.gap_extension <= 0)
+            throw std::invalid_argument{"The wavefront alignment requires a mismatch score below the match score, "
+                                        "a gap open score of at most 0 and a gap extension score below half of the "
+                                        "match score."};
+
+        // Penalties that are never reached are skipped by scaling them down.
+        penalty_setting.divisor = std::gcd(std::gcd(penalty_setting.mismatch, penalty_setting.gap_open),
+                                           penalty_setting.gap_extension);
+        penalty_setting.mismatch /= penalty_setting.divisor;
+        penalty_setting.gap_open /= penalty_setting.divisor;
+        penalty_setting.gap_extension /= penalty_setting.divisor;
+        return penalty_setting;
+    }
+
+    // The gap model is either the affine one or the linear one, which has no gap open score.
+    constexpr std::pair<int32_t, int32_t> gap_scores() const noexcept
+    {
+        if constexpr (requires { this->gap_open_score; })
+            return {this->gap_open_score, this->gap_extension_score};
+        else
+            return {0, this->gap_score};
+    }
+
+    // Returns the score of every lane and the cell it was found in, which is always the last cell.
+    template <typename sequences1_t, typename sequences2_t>
+    std::pair<std::array<int32_t, lane_count>, std::array<alignment_coordinate, lane_count>>
+    compute_scores(sequences1_t const & sequences1,
+                   sequences2_t const & sequences2,
+                   size_t const pair_count,
+                   penalties const & penalty_setting) const
+    {
+        using sequence1_t = std::ranges::range_reference_t<sequences1_t const>;
+        using sequence2_t = std::ranges::range_reference_t<sequences2_t const>;
+
+        static_assert(std::ranges::random_access_range<sequence1_t> &&
+                      std::ranges::random_access_range<sequence2_t>,
+                      "The wavefront alignment requires random access sequences!");
+        static_assert(std::equality_comparable_with<std::ranges::range_reference_t<sequence1_t>,
+                                                    std::ranges::range_reference_t<sequence2_t>>,
+                      "The wavefront alignment requires symbols that are comparable with each other!");
+
+        // ----------------------------------------------------------------------------
+        // Initialisation
+        // ----------------------------------------------------------------------------
+
+        // The padded lanes align two empty sequences, such that they are done with the first wavefront.
+        std::array<std::ranges::iterator_t<sequence1_t>, lane_count> sequence1_begin{};
+        std::array<std::ranges::iterator_t<sequence2_t>, lane_count> sequence2_begin{};
+        std::array<int32_t, lane_count> sizes1{};
+        std::array<int32_t, lane_count> sizes2{};
+        std::array<bool, lane_count> is_done{};
+        for (size_t lane = 0; lane < lane_count; ++lane) {
+            if (lane < pair_count) {
+                sequence1_begin[lane] = std::ranges::begin(sequences1[lane]);
+                sequence2_begin[lane] = std::ranges::begin(sequences2[lane]);
+                sizes1[lane] = std::ranges::distance(sequences1[lane]);
+                sizes2[lane] = std::ranges::distance(sequences2[lane]);
+            }
+            is_done[lane] = lane >= pair_count;
+        }
+
+        offset_type size1{};
+        offset_type size2{};
+        for (size_t lane = 0; lane < lane_count; ++lane) {
+            lane_at(size1, lane) = sizes1[lane];
+            lane_at(size2, lane) = sizes2[lane];
+        }
+
+        int32_t const min_diagonal = -std::ranges::max(sizes1);
+        int32_t const max_diagonal = std::ranges::max(sizes2);
+
+        // The wavefronts of the last penalties are kept in a ring buffer, which covers the furthest look back.
+        int32_t const ring_size = std::max(penalty_setting.mismatch,
+                                           penalty_setting.gap_open + penalty_setting.gap_extension) + 1;
+        std::vector<wavefront> wavefronts(ring_size);
+        wavefront const null_wavefront{};
+
+        auto wavefront_at = [&] (int32_t const penalty) -> wavefront const & {
+            return (penalty < 0) ? null_wavefront : wavefronts[penalty % ring_size];
+        };
+
+        // Returns the offset of the diagonal or the null offset if the wavefront does not cover it.
+        auto offset_at = [&] (wavefront const & source,
+                              std::vector<offset_type> wavefront::* component,
+                              int32_t const diagonal) -> offset_type {
+            if (source.is_null || diagonal < source.low || diagonal > source.high)
+                return offset_type{null_offset};
+
+            return (source.*component)[diagonal - source.low];
+        };
+
+        // Invalidates the offsets that leave the dp matrix of their lane.
+        auto limit = [&] (offset_type const & offset, int32_t const diagonal) -> offset_type {
+            if constexpr (lane_count == 1) {
+                return (offset >= 0 && offset <= size2 && offset - diagonal <= size1) ? offset : null_offset;
+            } else {
+                auto const is_valid = offset_type{-1}.lt(offset) &&
+                                      offset.le(size2) &&
+                                      (offset - offset_type{diagonal}).le(size1);
+                return blend(is_valid, offset, offset_type{null_offset});
+            }
+        };
+
+        // Slides every reached cell of the current wavefront along the matching symbols of its diagonal.
+        auto extend = [&] (wavefront & current) {
+            for (int32_t diagonal = current.low; diagonal <= current.high; ++diagonal) {
+                offset_type & offsets = current.matches[diagonal - current.low];
+                for (size_t lane = 0; lane < pair_count; ++lane) {
+                    int32_t offset = lane_at(offsets, lane);
+                    if (is_done[lane] || offset < 0)
+                        continue;
+
+                    auto const sequence1_it = sequence1_begin[lane] + (offset - diagonal);
+                    auto const sequence2_it = sequence2_begin[lane] + offset;
+                    int32_t const max_extension = std::min(sizes1[lane] - (offset - diagonal),
+                                                           sizes2[lane] - offset);
+                    int32_t extension = 0;
+                    while (extension < max_extension && sequence1_it[extension] == sequence2_it[extension])
+                        ++extension;
+
+                    lane_at(offsets, lane) = offset + extension;
+                }
+            }
+        };
+
+        // Marks the lanes whose last cell was reached with the current penalty.
+        std::array<int32_t, lane_count> lane_penalties{};
+        auto mark_done = [&] (wavefront const & current, int32_t const penalty) {
+            for (size_t lane = 0; lane < pair_count; ++lane) {
+                int32_t const last_diagonal = sizes2[lane] - sizes1[lane];
+                if (is_done[lane] || last_diagonal < current.low || last_diagonal > current.high)
+                    continue;
+
+                if (lane_at(current.matches[last_diagonal - current.low], lane) == sizes2[lane]) {
+                    is_done[lane] = true;
+                    lane_penalties[lane] = penalty;
+                }
+            }
+        };
+
+        wavefront & first = wavefronts[0];
+        first = wavefront{.is_null = false,
+                          .low = 0,
+                          .high = 0,
+                          .matches = {offset_type{0}},
+                          .insertions = {offset_type{null_offset}},
+                          .deletions = {offset_type{null_offset}}};
+        extend(first);
+        mark_done(first, 0);
+
+        // ----------------------------------------------------------------------------
+        // Recursion
+        // ----------------------------------------------------------------------------
+
+        for (int32_t penalty = 1; !std::ranges::all_of(is_done, std::identity{}); ++penalty) {
+            wavefront const & mismatch_source = wavefront_at(penalty - penalty_setting.mismatch);
+            wavefront const & open_source = wavefront_at(penalty - penalty_setting.gap_open -
+                                                         penalty_setting.gap_extension);
+            wavefront const & extension_source = wavefront_at(penalty - penalty_setting.gap_extension);
+            wavefront & current = wavefronts[penalty % ring_size];
+
+            current.is_null = mismatch_source.is_null && open_source.is_null && extension_source.is_null;
+            if (current.is_null)
+                continue;
+
+            current.low = max_diagonal;
+            current.high = min_diagonal;
+            for (wavefront const * source : {&mismatch_source, &open_source, &extension_source}) {
+                if (!source->is_null) {
+                    current.low = std::min(current.low, source->low - 1);
+                    current.high = std::max(current.high, source->high + 1);
+                }
+            }
+            current.low = std::max(current.low, min_diagonal);
+            current.high = std::min(current.high, max_diagonal);
+
+            size_t const diagonal_count = current.high - current.low + 1;
+            current.matches.resize(diagonal_count);
+            current.insertions.resize(diagonal_count);
+            current.deletions.resize(diagonal_count);
+
+            for (int32_t diagonal = current.low; diagonal <= current.high; ++diagonal) {
+                offset_type const insertion =
+                    limit(maximum(offset_at(open_source, &wavefront::matches, diagonal - 1),
+                                  offset_at(extension_source, &wavefront::insertions, diagonal - 1)) + 1,
+                          diagonal);
+                offset_type const deletion =
+                    limit(maximum(offset_at(open_source, &wavefront::matches, diagonal + 1),
+                                  offset_at(extension_source, &wavefront::deletions, diagonal + 1)),
+                          diagonal);
+                offset_type const mismatch =
+                    limit(offset_at(mismatch_source, &wavefront::matches, diagonal) + 1, diagonal);
+
+                size_t const position = diagonal - current.low;
+                current.insertions[position] = insertion;
+                current.deletions[position] = deletion;
+                current.matches[position] = maximum(mismatch, maximum(insertion, deletion));
+            }
+
+            extend(current);
+            mark_done(current, penalty);
+        }
+
+        // ----------------------------------------------------------------------------
+        // Result
+        // ----------------------------------------------------------------------------
+
+        std::array<int32_t, lane_count> scores{};
+        std::array<alignment_coordinate, lane_count> end_coordinate{};
+        for (size_t lane = 0; lane < pair_count; ++lane) {
+            int64_t const doubled_score = int64_t{penalty_setting.match_score} * (sizes1[lane] + sizes2[lane]) -
+                                          int64_t{penalty_setting.divisor} * lane_penalties[lane];
+            scores[lane] = static_cast<int32_t>(doubled_score / 2);
+            end_coordinate[lane] = alignment_coordinate{.sequence1_position = static_cast<size_t>(sizes1[lane]),
+                                                        .sequence2_position = static_cast<size_t>(sizes2[lane])};
+        }
+
+        return {scores, end_coordinate};
+    }
+
+    template <typename offsets_t>
+    static constexpr decltype(auto) lane_at(offsets_t && offsets, [[maybe_unused]] size_t const lane) noexcept
+    {
+        if constexpr (lane_count == 1)
+            return (offsets);
+        else
+            return offsets[lane];
+    }
+
+    static constexpr offset_type maximum(offset_type const & left, offset_type const & right) noexcept
+    {
+        if constexpr (lane_count == 1)
+            return std::max(left, right);
+        else
+            return max(left, right);
+    }
+};
+
+} // inline namespace v1
+}  // namespace seqan::pairwise_aligner
@@ -0,0 +1,181 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/method_global.hpp>
+#include <pairwise_aligner/configuration/method_local.hpp>
+#include <pairwise_aligner/configuration/score_model_matrix.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary.hpp>
+#include <pairwise_aligner/score_model/substitution_matrix.hpp>
+
+#include "../fixture/random_sequence.hpp"
+#include "../fixture/reference_aligner.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+inline constexpr pa::cfg::leading_end_gap free_leading_gap{.first_column = pa::cfg::end_gap::free,
+                                                           .first_row = pa::cfg::end_gap::free};
+inline constexpr pa::cfg::trailing_end_gap free_trailing_gap{.last_column = pa::cfg::end_gap::free,
+                                                             .last_row = pa::cfg::end_gap::free};
+
+// The anti-diagonal score models compute single pairs with simd vectors if both sequences span a simd vector.
+struct affine_anti_diagonal_scalar_test : public ::testing::Test
+{
+    static constexpr int32_t gap_open_score = -10;
+    static constexpr int32_t gap_extension_score = -1;
+
+    // The scores of the last column and the last row as well as the optimal score.
+    struct reference_result
+    {
+        std::vector<int32_t> last_column{};
+        std::vector<int32_t> last_row{};
+        int32_t score{};
+    };
+
+    pairwise_aligner::test::random_sequence_generator random_sequence{};
+
+    template <typename substitution_fn_t>
+    static reference_result gotoh(std::string const & sequence1,
+                                  std::string const & sequence2,
+                                  substitution_fn_t && substitution_score,
+                                  bool const is_local,
+                                  pa::cfg::leading_end_gap const leading_gap = {},
+                                  pa::cfg::trailing_end_gap const trailing_gap = {})
+    {
+        auto const best = pairwise_aligner::test::gotoh(sequence1,
+                                                        sequence2,
+                                                        substitution_score,
+                                                        {gap_open_score, gap_extension_score},
+                                                        is_local,
+                                                        leading_gap);
+
+        reference_result result{.last_row = best.back(),
+                                .score = pairwise_aligner::test::optimal_score(best, is_local, trailing_gap)};
+        for (std::vector<int32_t> const & row : best)
+            result.last_column.push_back(row.back());
+        return result;
+    }
+
+    // Compares the score as well as the last column and the last row.
+    template <typename aligner_t>
+    static void compare(aligner_t & aligner,
+                        std::string const & sequence1,
+                        std::string const & sequence2,
+                        reference_result const & expected)
+    {
+        auto result = aligner.compute(sequence1, sequence2);
+        EXPECT_EQ(result.score(), expected.score);
+
+        auto const & dp_column = result.dp_column()[0];
+        ASSERT_EQ(dp_column.size(), expected.last_column.size());
+        for (size_t i = 1; i < dp_column.size(); ++i)
+            EXPECT_EQ(get<0>(dp_column[i]), expected.last_column[i]) << "row: " << i;
+
+        auto const & dp_row = result.dp_row()[0];
+        ASSERT_EQ(dp_row.size(), expected.last_row.size());
+        for (size_t j = 1; j < dp_row.size(); ++j)
+            EXPECT_EQ(get<0>(dp_row[j]), expected.last_row[j]) << "column: " << j;
+    }
+
+    static int32_t unitary_score(char const symbol1, char const symbol2)
+    {
+        return (symbol1 == symbol2) ? 4 : -5;
+    }
+};
+
+TEST_F(affine_anti_diagonal_scalar_test, global)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary_anti_diagonal(
+        pa::cfg::method_global(pa::cfg::gap_model_affine(-10, -1), pa::cfg::leading_end_gap{},
+                               pa::cfg::trailing_end_gap{}), 4, -5));
+
+    for (size_t index = 0; index < 20; ++index) {
+        std::string sequence1 = random_sequence(0, 300, "ACGT");
+        std::string sequence2 = random_sequence(0, 300, "ACGT");
+        compare(aligner, sequence1, sequence2, gotoh(sequence1, sequence2, unitary_score, false));
+    }
+}
+
+TEST_F(affine_anti_diagonal_scalar_test, global_free_end_gaps)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary_anti_diagonal(
+        pa::cfg::method_global(pa::cfg::gap_model_affine(-10, -1), free_leading_gap, free_trailing_gap), 4, -5));
+
+    for (size_t index = 0; index < 20; ++index) {
+        std::string sequence1 = random_sequence(0, 300, "ACGT");
+        std::string sequence2 = random_sequence(0, 300, "ACGT");
+        compare(aligner, sequence1, sequence2,
+                gotoh(sequence1, sequence2, unitary_score, false, free_leading_gap, free_trailing_gap));
+    }
+}
+
+TEST_F(affine_anti_diagonal_scalar_test, local)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary_anti_diagonal(
+        pa::cfg::method_local(pa::cfg::gap_model_affine(-10, -1)), 4, -5));
+
+    for (size_t index = 0; index < 20; ++index) {
+        std::string sequence1 = random_sequence(1, 300, "ACGT");
+        std::string sequence2 = random_sequence(1, 300, "ACGT");
+        EXPECT_EQ(aligner.compute(sequence1, sequence2).score(),
+                  gotoh(sequence1, sequence2, unitary_score, true).score);
+    }
+}
+
+TEST_F(affine_anti_diagonal_scalar_test, substitution_matrix)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_matrix_anti_diagonal(
+        pa::cfg::method_global(pa::cfg::gap_model_affine(-10, -1), pa::cfg::leading_end_gap{},
+                               pa::cfg::trailing_end_gap{}), pa::blosum62_standard<>));
+
+    auto blosum62_score = [] (char const symbol1, char const symbol2) -> int32_t {
+        auto const & matrix = pa::blosum62_standard<>;
+        auto rank = [&] (char const symbol) {
+            return std::ranges::find(matrix, symbol, [] (auto const & row) { return row.first; }) - matrix.begin();
+        };
+        return matrix[rank(symbol1)].second[rank(symbol2)];
+    };
+
+    for (size_t index = 0; index < 20; ++index) {
+        std::string sequence1 = random_sequence(0, 300, "ACDEFGHIKLMNPQRSTVWXY");
+        std::string sequence2 = random_sequence(0, 300, "ACDEFGHIKLMNPQRSTVWXY");
+        compare(aligner, sequence1, sequence2, gotoh(sequence1, sequence2, blosum62_score, false));
+    }
+}
+
+TEST_F(affine_anti_diagonal_scalar_test, same_as_standard)
+{
+    auto make_method = [] () {
+        return pa::cfg::method_global(pa::cfg::gap_model_affine(-10, -1), free_leading_gap, free_trailing_gap);
+    };
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary_anti_diagonal(make_method(), 4, -5));
+    auto standard_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(make_method(), 4, -5));
+
+    for (size_t index = 0; index < 20; ++index) {
+        std::string sequence1 = random_sequence(0, 300, "ACGT");
+        std::string sequence2 = random_sequence(0, 300, "ACGT");
+        auto standard_result = standard_aligner.compute(sequence1, sequence2);
+
+        auto const & dp_column = standard_result.dp_column()[0];
+        auto const & dp_row = standard_result.dp_row()[0];
+
+        reference_result expected{.score = standard_result.score()};
+        for (size_t i = 0; i < dp_column.size(); ++i)
+            expected.last_column.push_back(get<0>(dp_column[i]));
+        for (size_t j = 0; j < dp_row.size(); ++j)
+            expected.last_row.push_back(get<0>(dp_row[j]));
+
+        compare(aligner, sequence1, sequence2, expected);
+    }
+}
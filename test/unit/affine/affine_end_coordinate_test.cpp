@@ -0,0 +1,246 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/method_global.hpp>
+#include <pairwise_aligner/configuration/method_local.hpp>
+#include <pairwise_aligner/configuration/score_model_matrix_striped.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd_saturated.hpp>
+#include <pairwise_aligner/score_model/substitution_matrix.hpp>
+
+#include "../fixture/random_sequence.hpp"
+#include "../fixture/reference_aligner.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+inline constexpr pa::cfg::leading_end_gap free_leading_gap{.first_column = pa::cfg::end_gap::free,
+                                                           .first_row = pa::cfg::end_gap::free};
+inline constexpr pa::cfg::trailing_end_gap free_trailing_gap{.last_column = pa::cfg::end_gap::free,
+                                                             .last_row = pa::cfg::end_gap::free};
+
+// The end coordinate must point to a cell of the dp matrix, whose score is the reported optimal score.
+struct affine_end_coordinate_test : public ::testing::Test
+{
+    static constexpr int32_t gap_open_score = -10;
+    static constexpr int32_t gap_extension_score = -1;
+
+    pairwise_aligner::test::random_sequence_generator random_sequence{};
+
+    static int32_t unitary_score(char const symbol1, char const symbol2)
+    {
+        return (symbol1 == symbol2) ? 4 : -5;
+    }
+
+    static int32_t blosum62_score(char const symbol1, char const symbol2)
+    {
+        auto const & matrix = pa::blosum62_standard<>;
+        auto rank = [&] (char const symbol) {
+            return std::ranges::find(matrix, symbol, [] (auto const & row) { return row.first; }) - matrix.begin();
+        };
+        return matrix[rank(symbol1)].second[rank(symbol2)];
+    }
+
+    // The scores of all cells computed with Gotoh's algorithm.
+    template <typename substitution_fn_t>
+    static auto gotoh(std::string const & sequence1,
+                      std::string const & sequence2,
+                      substitution_fn_t && substitution_score,
+                      bool const is_local,
+                      pa::cfg::leading_end_gap const leading_gap = {})
+    {
+        return pairwise_aligner::test::gotoh(sequence1,
+                                             sequence2,
+                                             substitution_score,
+                                             {gap_open_score, gap_extension_score},
+                                             is_local,
+                                             leading_gap);
+    }
+
+    // A local score of 0 is the empty alignment, which has no meaningful end.
+    template <typename result_t, typename substitution_fn_t>
+    static void check_local(result_t const & result,
+                            std::string const & sequence1,
+                            std::string const & sequence2,
+                            substitution_fn_t && substitution_score)
+    {
+        auto const matrix = gotoh(sequence1, sequence2, substitution_score, true);
+        int32_t const score = static_cast<int32_t>(result.score());
+        if (score == 0)
+            return;
+
+        pa::alignment_coordinate const end = result.end_coordinate();
+        ASSERT_LE(end.sequence1_position, sequence1.size());
+        ASSERT_LE(end.sequence2_position, sequence2.size());
+        EXPECT_EQ(matrix[end.sequence1_position][end.sequence2_position], score)
+            << "end: (" << end.sequence1_position << ", " << end.sequence2_position << ")";
+    }
+
+    // The end coordinate must be in the last row or the last column, unless it is the last cell.
+    template <typename result_t>
+    static void check_global(result_t const & result,
+                             std::string const & sequence1,
+                             std::string const & sequence2,
+                             pa::cfg::leading_end_gap const leading_gap,
+                             pa::cfg::trailing_end_gap const trailing_gap)
+    {
+        auto const matrix = gotoh(sequence1, sequence2, unitary_score, false, leading_gap);
+        pa::alignment_coordinate const end = result.end_coordinate();
+        ASSERT_LE(end.sequence1_position, sequence1.size());
+        ASSERT_LE(end.sequence2_position, sequence2.size());
+
+        bool const in_last_row = end.sequence1_position == sequence1.size();
+        bool const in_last_column = end.sequence2_position == sequence2.size();
+        EXPECT_TRUE((in_last_row && in_last_column) ||
+                    (in_last_row && trailing_gap.last_row == pa::cfg::end_gap::free) ||
+                    (in_last_column && trailing_gap.last_column == pa::cfg::end_gap::free))
+            << "end: (" << end.sequence1_position << ", " << end.sequence2_position << ")";
+        EXPECT_EQ(matrix[end.sequence1_position][end.sequence2_position], static_cast<int32_t>(result.score()))
+            << "end: (" << end.sequence1_position << ", " << end.sequence2_position << ")";
+    }
+};
+
+TEST_F(affine_end_coordinate_test, local_scalar)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(
+        pa::cfg::method_local(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score)), 4, -5));
+
+    for (size_t index = 0; index < 40; ++index) {
+        std::string sequence1 = random_sequence(1, (index < 20) ? 7 : 300, "ACGT");
+        std::string sequence2 = random_sequence(1, (index < 20) ? 7 : 300, "ACGT");
+        check_local(aligner.compute(sequence1, sequence2), sequence1, sequence2, unitary_score);
+    }
+}
+
+TEST_F(affine_end_coordinate_test, local_anti_diagonal)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary_anti_diagonal(
+        pa::cfg::method_local(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score)), 4, -5));
+
+    // The short pairs are computed column by column and the long ones along the anti-diagonals.
+    for (size_t index = 0; index < 40; ++index) {
+        std::string sequence1 = random_sequence(1, (index < 20) ? 7 : 300, "ACGT");
+        std::string sequence2 = random_sequence(1, (index < 20) ? 7 : 300, "ACGT");
+        check_local(aligner.compute(sequence1, sequence2), sequence1, sequence2, unitary_score);
+    }
+}
+
+TEST_F(affine_end_coordinate_test, local_striped)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_matrix_striped(
+        pa::cfg::method_local(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score)),
+        pa::blosum62_standard<>));
+
+    for (size_t index = 0; index < 20; ++index) {
+        std::string sequence1 = random_sequence(1, 300, "ACDEFGHIKLMNPQRSTVWXY");
+        std::string sequence2 = random_sequence(1, 300, "ACDEFGHIKLMNPQRSTVWXY");
+        check_local(aligner.compute(sequence1, sequence2), sequence1, sequence2, blosum62_score);
+    }
+}
+
+TEST_F(affine_end_coordinate_test, local_simd_fixed)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary_simd(
+        pa::cfg::method_local(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score)), 4, -5));
+
+    std::vector<std::string> sequences1 = random_sequence.collection(pa::simd_score<int32_t>::size_v, 1, 200);
+    std::vector<std::string> sequences2 = random_sequence.collection(pa::simd_score<int32_t>::size_v, 1, 200);
+    for (auto const & result : aligner.compute(sequences1, sequences2))
+        check_local(result, result.sequence1(), result.sequence2(), unitary_score);
+}
+
+TEST_F(affine_end_coordinate_test, local_simd_saturated)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary_simd_saturated(
+        pa::cfg::method_local(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score)), 4, -5));
+
+    std::vector<std::string> sequences1 = random_sequence.collection(pa::simd_score<int8_t>::size_v, 1, 300);
+    std::vector<std::string> sequences2 = random_sequence.collection(pa::simd_score<int8_t>::size_v, 1, 300);
+    for (auto const & result : aligner.compute(sequences1, sequences2))
+        check_local(result, result.sequence1(), result.sequence2(), unitary_score);
+}
+
+TEST_F(affine_end_coordinate_test, global_scalar)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(
+        pa::cfg::method_global(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score),
+                               free_leading_gap,
+                               free_trailing_gap), 4, -5));
+
+    for (size_t index = 0; index < 20; ++index) {
+        std::string sequence1 = random_sequence(0, 300, "ACGT");
+        std::string sequence2 = random_sequence(0, 300, "ACGT");
+        check_global(aligner.compute(sequence1, sequence2), sequence1, sequence2, free_leading_gap, free_trailing_gap);
+    }
+}
+
+TEST_F(affine_end_coordinate_test, global_scalar_penalised)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(
+        pa::cfg::method_global(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score),
+                               pa::cfg::leading_end_gap{},
+                               pa::cfg::trailing_end_gap{}), 4, -5));
+
+    std::string const sequence1 = random_sequence(50, 100, "ACGT");
+    std::string const sequence2 = random_sequence(50, 100, "ACGT");
+    pa::alignment_coordinate const end = aligner.compute(sequence1, sequence2).end_coordinate();
+    EXPECT_EQ(end.sequence1_position, sequence1.size());
+    EXPECT_EQ(end.sequence2_position, sequence2.size());
+}
+
+TEST_F(affine_end_coordinate_test, global_simd_fixed)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary_simd(
+        pa::cfg::method_global(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score),
+                               free_leading_gap,
+                               free_trailing_gap), 4, -5));
+
+    std::vector<std::string> sequences1 = random_sequence.collection(pa::simd_score<int32_t>::size_v, 1, 200);
+    std::vector<std::string> sequences2 = random_sequence.collection(pa::simd_score<int32_t>::size_v, 1, 200);
+    for (auto const & result : aligner.compute(sequences1, sequences2))
+        check_global(result, result.sequence1(), result.sequence2(), free_leading_gap, free_trailing_gap);
+}
+
+TEST_F(affine_end_coordinate_test, global_simd_saturated)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary_simd_saturated(
+        pa::cfg::method_global(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score),
+                               free_leading_gap,
+                               free_trailing_gap), 4, -5));
+
+    std::vector<std::string> sequences1 = random_sequence.collection(pa::simd_score<int8_t>::size_v, 1, 300);
+    std::vector<std::string> sequences2 = random_sequence.collection(pa::simd_score<int8_t>::size_v, 1, 300);
+    for (auto const & result : aligner.compute(sequences1, sequences2))
+        check_global(result, result.sequence1(), result.sequence2(), free_leading_gap, free_trailing_gap);
+}
+
+// The projection of a short lane's last column onto the last row of a longer bulk must end in its first row.
+TEST_F(affine_end_coordinate_test, global_simd_saturated_skewed_sizes)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary_simd_saturated(
+        pa::cfg::method_global(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score),
+                               pa::cfg::leading_end_gap{},
+                               free_trailing_gap), 4, -5));
+
+    std::vector<std::string> sequences1 = random_sequence.collection(pa::simd_score<int8_t>::size_v * 4, 10, 100);
+    std::vector<std::string> sequences2 = random_sequence.collection(pa::simd_score<int8_t>::size_v * 4, 10, 300);
+    for (auto const & result : aligner.compute(sequences1, sequences2)) {
+        auto const matrix = gotoh(result.sequence1(), result.sequence2(), unitary_score, false);
+        EXPECT_EQ(static_cast<int32_t>(result.score()), pairwise_aligner::test::optimal_score(matrix,
+                                                                                              false,
+                                                                                              free_trailing_gap));
+        check_global(result, result.sequence1(), result.sequence2(), pa::cfg::leading_end_gap{}, free_trailing_gap);
+    }
+}
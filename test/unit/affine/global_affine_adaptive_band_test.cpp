@@ -0,0 +1,134 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <pairwise_aligner/configuration/band_adaptive.hpp>
+#include <pairwise_aligner/configuration/band_static.hpp>
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/method_global.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary.hpp>
+
+#include "../fixture/random_sequence.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+inline constexpr auto global_config =
+    pa::cfg::method_global(
+        pa::cfg::gap_model_affine(-10, -1),
+        pa::cfg::leading_end_gap{}, pa::cfg::trailing_end_gap{}
+    );
+
+inline constexpr auto overlap_config =
+    pa::cfg::method_global(
+        pa::cfg::gap_model_affine(-10, -1),
+        pa::cfg::leading_end_gap{},
+        pa::cfg::trailing_end_gap{.last_column = pa::cfg::end_gap::free, .last_row = pa::cfg::end_gap::free}
+    );
+
+struct global_affine_adaptive_band_test : public ::testing::Test
+{
+    pairwise_aligner::test::random_sequence_generator random_sequence{};
+
+    // Substitutes every tenth symbol on average.
+    std::string mutate(std::string sequence)
+    {
+        std::uniform_int_distribution<size_t> edit_distribution{0, 9};
+        std::ranges::for_each(sequence, [&] (char & symbol) {
+            if (edit_distribution(random_sequence.random_engine) == 0)
+                symbol = random_sequence(1)[0];
+        });
+        return sequence;
+    }
+
+    // Deletes a few symbols every step many symbols, such that the alignment drifts away from the main diagonal.
+    std::string drift(std::string const & sequence, size_t const step, size_t const deletion_size)
+    {
+        std::string drifted_sequence{};
+        for (size_t position = 0; position < sequence.size(); position += step + deletion_size)
+            drifted_sequence += sequence.substr(position, step);
+        return mutate(std::move(drifted_sequence));
+    }
+};
+
+TEST_F(global_affine_adaptive_band_test, wide_band)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(global_config, 4, -5));
+    auto banded_aligner =
+        pa::cfg::configure_aligner(pa::cfg::band_adaptive(pa::cfg::score_model_unitary(global_config, 4, -5), 300));
+
+    for (size_t index = 0; index < 100; ++index) {
+        std::string sequence1 = random_sequence(0, 150);
+        std::string sequence2 = random_sequence(0, 150);
+
+        EXPECT_EQ(banded_aligner.compute(sequence1, sequence2).score(), aligner.compute(sequence1, sequence2).score())
+            << "index: " << index;
+    }
+}
+
+TEST_F(global_affine_adaptive_band_test, narrow_band)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(global_config, 4, -5));
+    auto banded_aligner =
+        pa::cfg::configure_aligner(pa::cfg::band_adaptive(pa::cfg::score_model_unitary(global_config, 4, -5), 4));
+
+    for (size_t index = 0; index < 100; ++index) {
+        std::string sequence1 = random_sequence(0, 150);
+        std::string sequence2 = random_sequence(0, 150);
+
+        // The banded score belongs to a valid alignment, which can not be better than the optimal one.
+        int32_t const banded_score = banded_aligner.compute(sequence1, sequence2).score();
+        EXPECT_LE(banded_score, aligner.compute(sequence1, sequence2).score()) << "index: " << index;
+        EXPECT_GE(banded_score, -10 - static_cast<int32_t>(sequence1.size() + sequence2.size()) * 11)
+            << "index: " << index;
+    }
+}
+
+TEST_F(global_affine_adaptive_band_test, follows_indels)
+{
+    // The alignment drifts 100 diagonals away from the main diagonal.
+    std::string sequence1 = random_sequence(1000);
+    std::string sequence2 = drift(sequence1, 27, 3);
+
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(global_config, 4, -5));
+    auto adaptive_aligner =
+        pa::cfg::configure_aligner(pa::cfg::band_adaptive(pa::cfg::score_model_unitary(global_config, 4, -5), 32));
+    auto static_aligner =
+        pa::cfg::configure_aligner(pa::cfg::band_static(pa::cfg::score_model_unitary(global_config, 4, -5), -16, 16));
+
+    int32_t const expected_score = aligner.compute(sequence1, sequence2).score();
+    EXPECT_EQ(adaptive_aligner.compute(sequence1, sequence2).score(), expected_score);
+    EXPECT_LT(static_aligner.compute(sequence1, sequence2).score(), expected_score);
+
+    // Also if the alignment drifts in the other direction.
+    EXPECT_EQ(adaptive_aligner.compute(sequence2, sequence1).score(), aligner.compute(sequence2, sequence1).score());
+}
+
+TEST_F(global_affine_adaptive_band_test, free_trailing_gaps)
+{
+    std::string sequence1 = random_sequence(500);
+    std::string sequence2 = drift(sequence1.substr(0, 300), 27, 3);
+
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(overlap_config, 4, -5));
+    auto adaptive_aligner =
+        pa::cfg::configure_aligner(pa::cfg::band_adaptive(pa::cfg::score_model_unitary(overlap_config, 4, -5), 32));
+
+    EXPECT_EQ(adaptive_aligner.compute(sequence1, sequence2).score(), aligner.compute(sequence1, sequence2).score());
+}
+
+TEST_F(global_affine_adaptive_band_test, invalid_band_width)
+{
+    EXPECT_THROW(pa::cfg::band_adaptive(pa::cfg::score_model_unitary(global_config, 4, -5), -1),
+                 std::invalid_argument);
+}
@@ -0,0 +1,183 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <pairwise_aligner/configuration/band_static.hpp>
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/method_global.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd.hpp>
+
+#include "../fixture/random_sequence.hpp"
+#include "../fixture/reference_aligner.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+struct global_affine_banded_test : public ::testing::Test
+{
+    static constexpr int32_t match_score = 4;
+    static constexpr int32_t mismatch_score = -5;
+
+    std::vector<std::string> sequence_collection1{};
+    std::vector<std::string> sequence_collection2{};
+
+    pairwise_aligner::test::random_sequence_generator random_sequence{};
+
+    static int32_t substitution_score(char const lhs, char const rhs)
+    {
+        return (lhs == rhs) ? match_score : mismatch_score;
+    }
+
+    // Generates pairs of related sequences, whose length differs by at most max_length_difference.
+    void generate_sequences(size_t const count, size_t const max_size, size_t const max_length_difference)
+    {
+        std::uniform_int_distribution<size_t> difference_distribution{0, max_length_difference};
+        std::uniform_int_distribution<size_t> edit_distribution{0, 1};
+
+        for (size_t index = 0; index < count; ++index) {
+            std::string sequence = random_sequence(0, max_size);
+
+            std::string other_sequence = sequence;
+            std::ranges::for_each(other_sequence, [&] (char & symbol) {
+                if (edit_distribution(random_sequence.random_engine) == 0)
+                    symbol = random_sequence(1)[0];
+            });
+            other_sequence.erase(0, std::min(difference_distribution(random_sequence.random_engine),
+                                             other_sequence.size()));
+
+            sequence_collection1.push_back(std::move(sequence));
+            sequence_collection2.push_back(std::move(other_sequence));
+        }
+    }
+
+    // The banded global alignment score of the reference aligner, whose cells outside of the band are masked.
+    static int32_t banded_score(std::string const & sequence1,
+                                std::string const & sequence2,
+                                std::ptrdiff_t const lower_diagonal,
+                                std::ptrdiff_t const upper_diagonal,
+                                pa::cfg::trailing_end_gap const trailing_gap = {})
+    {
+        return pairwise_aligner::test::optimal_score(pairwise_aligner::test::banded_gotoh(sequence1,
+                                                                                          sequence2,
+                                                                                          substitution_score,
+                                                                                          {-10, -1},
+                                                                                          lower_diagonal,
+                                                                                          upper_diagonal),
+                                                     false,
+                                                     trailing_gap);
+    }
+};
+
+inline constexpr auto global_config =
+    pa::cfg::method_global(
+        pa::cfg::gap_model_affine(-10, -1),
+        pa::cfg::leading_end_gap{}, pa::cfg::trailing_end_gap{}
+    );
+
+inline constexpr pa::cfg::trailing_end_gap overlap_trailing_gap{.last_column = pa::cfg::end_gap::free,
+                                                                .last_row = pa::cfg::end_gap::free};
+
+TEST_F(global_affine_banded_test, wide_band)
+{
+    generate_sequences(50, 100, 100);
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::band_static(pa::cfg::score_model_unitary(global_config, match_score, mismatch_score), -200, 200));
+    auto unbanded_aligner = pa::cfg::configure_aligner(
+        pa::cfg::score_model_unitary(global_config, match_score, mismatch_score));
+
+    for (size_t index = 0; index < sequence_collection1.size(); ++index) {
+        EXPECT_EQ(aligner.compute(sequence_collection1[index], sequence_collection2[index]).score(),
+                  unbanded_aligner.compute(sequence_collection1[index], sequence_collection2[index]).score())
+            << "index: " << index;
+    }
+}
+
+TEST_F(global_affine_banded_test, scalar)
+{
+    generate_sequences(100, 150, 5);
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::band_static(pa::cfg::score_model_unitary(global_config, match_score, mismatch_score), -7, 3));
+
+    for (size_t index = 0; index < sequence_collection1.size(); ++index) {
+        EXPECT_EQ(aligner.compute(sequence_collection1[index], sequence_collection2[index]).score(),
+                  banded_score(sequence_collection1[index], sequence_collection2[index], -7, 3))
+            << "index: " << index;
+    }
+}
+
+TEST_F(global_affine_banded_test, scalar_free_trailing_gaps)
+{
+    generate_sequences(100, 150, 5);
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::band_static(
+            pa::cfg::score_model_unitary(
+                pa::cfg::method_global(pa::cfg::gap_model_affine(-10, -1),
+                                       pa::cfg::leading_end_gap{},
+                                       overlap_trailing_gap),
+                match_score,
+                mismatch_score),
+            -6, 2));
+
+    for (size_t index = 0; index < sequence_collection1.size(); ++index) {
+        EXPECT_EQ(aligner.compute(sequence_collection1[index], sequence_collection2[index]).score(),
+                  banded_score(sequence_collection1[index], sequence_collection2[index], -6, 2, overlap_trailing_gap))
+            << "index: " << index;
+    }
+}
+
+TEST_F(global_affine_banded_test, simd_fixed)
+{
+    generate_sequences(100, 150, 5);
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::band_static(pa::cfg::score_model_unitary_simd(global_config, match_score, mismatch_score), -9, 4));
+
+    auto results = aligner.compute(sequence_collection1, sequence_collection2);
+
+    ASSERT_EQ(results.size(), sequence_collection1.size());
+    for (size_t index = 0; index < results.size(); ++index) {
+        EXPECT_EQ(results[index].score(), banded_score(sequence_collection1[index], sequence_collection2[index], -9, 4))
+            << "index: " << index;
+    }
+}
+
+TEST_F(global_affine_banded_test, simd_fixed_free_trailing_gaps)
+{
+    generate_sequences(100, 150, 5);
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::band_static(
+            pa::cfg::score_model_unitary_simd(
+                pa::cfg::method_global(pa::cfg::gap_model_affine(-10, -1),
+                                       pa::cfg::leading_end_gap{},
+                                       overlap_trailing_gap),
+                match_score,
+                mismatch_score),
+            -9, 4));
+
+    auto results = aligner.compute(sequence_collection1, sequence_collection2);
+
+    ASSERT_EQ(results.size(), sequence_collection1.size());
+    for (size_t index = 0; index < results.size(); ++index) {
+        EXPECT_EQ(results[index].score(),
+                  banded_score(sequence_collection1[index], sequence_collection2[index], -9, 4, overlap_trailing_gap))
+            << "index: " << index;
+    }
+}
+
+TEST_F(global_affine_banded_test, invalid_band)
+{
+    EXPECT_THROW(pa::cfg::band_static(1, 4), std::invalid_argument);
+    EXPECT_THROW(pa::cfg::band_static(-4, -1), std::invalid_argument);
+}
@@ -0,0 +1,140 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cctype>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/method_global.hpp>
+#include <pairwise_aligner/configuration/output_alignment.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary.hpp>
+
+#include "../fixture/random_sequence.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+inline constexpr auto global_config =
+    pa::cfg::method_global(
+        pa::cfg::gap_model_affine(-10, -1),
+        pa::cfg::leading_end_gap{}, pa::cfg::trailing_end_gap{}
+    );
+
+struct global_affine_hirschberg_test : public ::testing::Test
+{
+    pairwise_aligner::test::random_sequence_generator generate_sequence{};
+
+    // Replays the CIGAR string on both sequences and returns the score of the alignment.
+    static int32_t rescore(std::string const & cigar, std::string const & sequence1, std::string const & sequence2)
+    {
+        int32_t score = 0;
+        size_t position1 = 0;
+        size_t position2 = 0;
+        size_t count = 0;
+        for (char const symbol : cigar) {
+            if (std::isdigit(symbol)) {
+                count = count * 10 + (symbol - '0');
+                continue;
+            }
+
+            switch (symbol) {
+                case 'M': {
+                    for (size_t k = 0; k < count; ++k, ++position1, ++position2)
+                        score += (sequence1.at(position1) == sequence2.at(position2)) ? 4 : -5;
+                    break;
+                }
+                case 'D': score += -10 - static_cast<int32_t>(count); position1 += count; break;
+                case 'I': score += -10 - static_cast<int32_t>(count); position2 += count; break;
+                default: ADD_FAILURE() << "unexpected CIGAR operation " << symbol;
+            }
+            count = 0;
+        }
+
+        EXPECT_EQ(position1, sequence1.size());
+        EXPECT_EQ(position2, sequence2.size());
+        return score;
+    }
+
+    void run_and_compare(std::string const & sequence1, std::string const & sequence2)
+    {
+        auto score_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(global_config, 4, -5));
+        auto aligner = pa::cfg::configure_aligner(
+            pa::cfg::output_alignment(pa::cfg::score_model_unitary(global_config, 4, -5)));
+
+        int32_t const expected_score = score_aligner.compute(sequence1, sequence2).score();
+        auto result = aligner.compute(sequence1, sequence2);
+
+        EXPECT_EQ(result.score(), expected_score) << sequence1 << " " << sequence2;
+        EXPECT_EQ(result.begin_coordinate(), (pa::alignment_coordinate{0, 0}));
+        EXPECT_EQ(result.end_coordinate(), (pa::alignment_coordinate{sequence1.size(), sequence2.size()}));
+        EXPECT_EQ(rescore(result.cigar(), sequence1, sequence2), expected_score) << sequence1 << " " << sequence2;
+    }
+};
+
+TEST_F(global_affine_hirschberg_test, single_pair)
+{
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::output_alignment(pa::cfg::score_model_unitary(global_config, 4, -5)));
+
+    auto result = aligner.compute(std::string{"ACGT"}, std::string{"AGT"});
+
+    EXPECT_EQ(result.score(), 1);
+    EXPECT_EQ(result.cigar(), "1M1D2M");
+    EXPECT_EQ(result.end_coordinate(), (pa::alignment_coordinate{4, 3}));
+}
+
+TEST_F(global_affine_hirschberg_test, empty_sequences)
+{
+    run_and_compare("", "");
+    run_and_compare("ACGT", "");
+    run_and_compare("", "ACGT");
+    run_and_compare("A", "ACGT");
+}
+
+TEST_F(global_affine_hirschberg_test, random_pairs)
+{
+    for (size_t index = 0; index < 200; ++index)
+        run_and_compare(generate_sequence(0, 60), generate_sequence(0, 60));
+}
+
+TEST_F(global_affine_hirschberg_test, long_deletion)
+{
+    // The optimal alignment deletes the middle of the first sequence, such that it is split within the deletion.
+    std::string const prefix = generate_sequence(50, 50);
+    std::string const suffix = generate_sequence(50, 50);
+    run_and_compare(prefix + generate_sequence(40, 40) + suffix, prefix + suffix);
+    run_and_compare(prefix + suffix, prefix + generate_sequence(40, 40) + suffix);
+}
+
+TEST_F(global_affine_hirschberg_test, long_pair)
+{
+    std::string const sequence1 = generate_sequence(2000, 2000);
+    std::string sequence2 = sequence1;
+    std::uniform_int_distribution<size_t> position_distribution{0, sequence2.size() - 1};
+    for (size_t edit = 0; edit < 100; ++edit)
+        sequence2[position_distribution(generate_sequence.random_engine)] = "ACGT"[edit % 4];
+    sequence2.erase(position_distribution(generate_sequence.random_engine), 30);
+
+    run_and_compare(sequence1, sequence2);
+}
+
+TEST_F(global_affine_hirschberg_test, free_end_gaps)
+{
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::output_alignment(pa::cfg::score_model_unitary(
+            pa::cfg::method_global(
+                pa::cfg::gap_model_affine(-10, -1),
+                pa::cfg::leading_end_gap{.first_column = pa::cfg::end_gap::free},
+                pa::cfg::trailing_end_gap{}),
+            4, -5)));
+
+    EXPECT_THROW(aligner.compute(std::string{"ACGT"}, std::string{"AGT"}), std::invalid_argument);
+}
@@ -0,0 +1,186 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/method_global.hpp>
+#include <pairwise_aligner/configuration/output_alignment.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd_saturated.hpp>
+
+#include "../fixture/random_sequence.hpp"
+#include "../fixture/reference_aligner.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+inline constexpr auto global_config =
+    pa::cfg::method_global(
+        pa::cfg::gap_model_affine(-10, -1),
+        pa::cfg::leading_end_gap{}, pa::cfg::trailing_end_gap{}
+    );
+
+inline constexpr auto semi_global_config =
+    pa::cfg::method_global(
+        pa::cfg::gap_model_affine(-10, -1),
+        pa::cfg::leading_end_gap{.first_column = pa::cfg::end_gap::free, .first_row = pa::cfg::end_gap::free},
+        pa::cfg::trailing_end_gap{}
+    );
+
+inline constexpr auto overlap_config =
+    pa::cfg::method_global(
+        pa::cfg::gap_model_affine(-10, -1),
+        pa::cfg::leading_end_gap{},
+        pa::cfg::trailing_end_gap{.last_column = pa::cfg::end_gap::free, .last_row = pa::cfg::end_gap::free}
+    );
+
+struct global_affine_traceback_test : public ::testing::Test
+{
+    std::vector<std::string> sequence_collection1{};
+    std::vector<std::string> sequence_collection2{};
+
+    pairwise_aligner::test::random_sequence_generator random_sequence{};
+
+    void generate_sequences(size_t const count, size_t const min_size, size_t const max_size)
+    {
+        std::ranges::generate_n(std::back_inserter(sequence_collection1), count,
+                                [&] () { return random_sequence(min_size, max_size); });
+        std::ranges::generate_n(std::back_inserter(sequence_collection2), count,
+                                [&] () { return random_sequence(min_size, max_size); });
+    }
+
+    // The CIGAR string must replay from the begin to the end coordinate with the optimal score. The alignment begins
+    // in the first row or column and ends in the last row or column, which is the last cell for penalised end gaps.
+    template <typename aligner_t, typename scalar_config_t>
+    void run_and_compare(aligner_t & aligner,
+                         scalar_config_t const & scalar_config,
+                         bool const free_trailing_gaps = false)
+    {
+        auto scalar_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(scalar_config, 4, -5));
+
+        auto results = aligner.compute(sequence_collection1, sequence_collection2);
+
+        ASSERT_EQ(results.size(), sequence_collection1.size());
+        for (size_t index = 0; index < results.size(); ++index) {
+            auto const & result = results[index];
+            std::string const & sequence1 = sequence_collection1[index];
+            std::string const & sequence2 = sequence_collection2[index];
+            int32_t const expected_score = scalar_aligner.compute(sequence1, sequence2).score();
+            pa::alignment_coordinate const & begin = result.begin_coordinate();
+            pa::alignment_coordinate const & end = result.end_coordinate();
+
+            EXPECT_EQ(static_cast<int32_t>(result.score()), expected_score) << "index: " << index;
+            EXPECT_TRUE(begin.sequence1_position == 0 || begin.sequence2_position == 0) << "index: " << index;
+            if (free_trailing_gaps) {
+                EXPECT_TRUE(end.sequence1_position == sequence1.size() || end.sequence2_position == sequence2.size())
+                    << "index: " << index;
+            } else {
+                EXPECT_EQ(end, (pa::alignment_coordinate{sequence1.size(), sequence2.size()})) << "index: " << index;
+            }
+
+            auto substitution_score = [] (char const lhs, char const rhs) { return (lhs == rhs) ? 4 : -5; };
+            pairwise_aligner::test::cigar_replay const replay =
+                pairwise_aligner::test::replay_cigar(result.cigar(),
+                                                     sequence1,
+                                                     sequence2,
+                                                     begin.sequence1_position,
+                                                     begin.sequence2_position,
+                                                     substitution_score,
+                                                     {-10, -1});
+            EXPECT_EQ(replay.score, expected_score) << "index: " << index;
+            EXPECT_EQ((pa::alignment_coordinate{replay.sequence1_position, replay.sequence2_position}), end)
+                << "index: " << index;
+        }
+    }
+};
+
+TEST_F(global_affine_traceback_test, single_pair)
+{
+    sequence_collection1.push_back("ACGT");
+    sequence_collection2.push_back("AGT");
+
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::output_alignment(pa::cfg::score_model_unitary_simd(global_config, (int32_t)4, (int32_t)-5)));
+
+    auto results = aligner.compute(sequence_collection1, sequence_collection2);
+
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0].score(), 1);
+    EXPECT_EQ(results[0].cigar(), "1M1D2M");
+    EXPECT_EQ(results[0].begin_coordinate(), (pa::alignment_coordinate{0, 0}));
+    EXPECT_EQ(results[0].end_coordinate(), (pa::alignment_coordinate{4, 3}));
+}
+
+TEST_F(global_affine_traceback_test, fixed)
+{
+    generate_sequences(100, 0, 150);
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::output_alignment(pa::cfg::score_model_unitary_simd(global_config, (int32_t)4, (int32_t)-5)));
+    run_and_compare(aligner, global_config);
+}
+
+TEST_F(global_affine_traceback_test, saturated)
+{
+    generate_sequences(100, 0, 300);
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::output_alignment(pa::cfg::score_model_unitary_simd_saturated(global_config,
+                                                                              (int32_t)4,
+                                                                              (int32_t)-5)));
+    run_and_compare(aligner, global_config);
+}
+
+TEST_F(global_affine_traceback_test, free_leading_gaps)
+{
+    generate_sequences(100, 10, 150);
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::output_alignment(pa::cfg::score_model_unitary_simd(semi_global_config,
+                                                                    (int32_t)4,
+                                                                    (int32_t)-5)));
+    run_and_compare(aligner, semi_global_config);
+}
+
+TEST_F(global_affine_traceback_test, free_trailing_gaps_single_pair)
+{
+    sequence_collection1.push_back("ACGTTTTTTT");
+    sequence_collection2.push_back("CCCCCACGT");
+
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::output_alignment(pa::cfg::score_model_unitary_simd(overlap_config, (int32_t)4, (int32_t)-5)));
+
+    auto results = aligner.compute(sequence_collection1, sequence_collection2);
+
+    // The trailing Ts of the first sequence are free, such that the alignment ends after its fourth symbol.
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0].score(), 1);
+    EXPECT_EQ(results[0].cigar(), "5I4M");
+    EXPECT_EQ(results[0].begin_coordinate(), (pa::alignment_coordinate{0, 0}));
+    EXPECT_EQ(results[0].end_coordinate(), (pa::alignment_coordinate{4, 9}));
+}
+
+TEST_F(global_affine_traceback_test, free_trailing_gaps)
+{
+    generate_sequences(100, 10, 150);
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::output_alignment(pa::cfg::score_model_unitary_simd(overlap_config, (int32_t)4, (int32_t)-5)));
+    run_and_compare(aligner, overlap_config, true);
+}
+
+TEST_F(global_affine_traceback_test, free_trailing_gaps_saturated)
+{
+    generate_sequences(100, 10, 300);
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::output_alignment(pa::cfg::score_model_unitary_simd_saturated(overlap_config,
+                                                                              (int32_t)4,
+                                                                              (int32_t)-5)));
+    run_and_compare(aligner, overlap_config, true);
+}
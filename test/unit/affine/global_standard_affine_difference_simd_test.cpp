@@ -0,0 +1,148 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/method_global.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd_difference.hpp>
+
+#include "../fixture/random_sequence.hpp"
+#include "../fixture/reference_aligner.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+struct global_standard_affine_difference_simd_test : public ::testing::Test
+{
+    pairwise_aligner::test::random_sequence_generator random_dna{};
+
+    static int32_t global_score(std::string const & sequence1,
+                                std::string const & sequence2,
+                                int32_t const match_score,
+                                int32_t const mismatch_score,
+                                int32_t const gap_open_score,
+                                int32_t const gap_extension_score)
+    {
+        auto unitary_score = [&] (char const symbol1, char const symbol2) {
+            return (symbol1 == symbol2) ? match_score : mismatch_score;
+        };
+        return pairwise_aligner::test::gotoh(sequence1, sequence2, unitary_score,
+                                             {gap_open_score, gap_extension_score}, false).back().back();
+    }
+
+    template <typename aligner_t>
+    void check_scores(aligner_t & aligner,
+                      std::vector<std::string> const & sequences1,
+                      std::vector<std::string> const & sequences2,
+                      int32_t const match_score,
+                      int32_t const mismatch_score,
+                      int32_t const gap_open_score,
+                      int32_t const gap_extension_score)
+    {
+        auto results = aligner.compute(sequences1, sequences2);
+
+        ASSERT_EQ(results.size(), sequences1.size());
+        for (size_t index = 0; index < results.size(); ++index) {
+            EXPECT_EQ(results[index].score(), global_score(sequences1[index],
+                                                           sequences2[index],
+                                                           match_score,
+                                                           mismatch_score,
+                                                           gap_open_score,
+                                                           gap_extension_score)) << "index: " << index;
+        }
+    }
+
+    static auto make_aligner(int32_t const match_score,
+                             int32_t const mismatch_score,
+                             int32_t const gap_open_score,
+                             int32_t const gap_extension_score)
+    {
+        return pa::cfg::configure_aligner(
+            pa::cfg::score_model_unitary_simd_difference(
+                pa::cfg::method_global(
+                    pa::cfg::gap_model_affine(gap_open_score, gap_extension_score),
+                    pa::cfg::leading_end_gap{}, pa::cfg::trailing_end_gap{}
+                ),
+                match_score, mismatch_score
+            )
+        );
+    }
+};
+
+TEST_F(global_standard_affine_difference_simd_test, varying_sizes)
+{
+    auto aligner = make_aligner(4, -5, -10, -1);
+
+    std::vector<std::string> sequences1{};
+    std::vector<std::string> sequences2{};
+    for (size_t index = 0; index < 70; ++index) {
+        sequences1.push_back(random_dna(0, 150));
+        sequences2.push_back(random_dna(0, 150));
+    }
+
+    check_scores(aligner, sequences1, sequences2, 4, -5, -10, -1);
+}
+
+TEST_F(global_standard_affine_difference_simd_test, long_sequences)
+{
+    // The scores exceed the range of 8 bit scores by far, while their differences do not.
+    auto aligner = make_aligner(4, -5, -10, -1);
+
+    std::vector<std::string> sequences1{};
+    std::vector<std::string> sequences2{};
+    for (size_t index = 0; index < 40; ++index) {
+        std::string sequence = random_dna(1000, 1500);
+        sequences2.push_back(random_dna(0, 20) + sequence + random_dna(0, 20));
+        sequences1.push_back(std::move(sequence));
+    }
+
+    check_scores(aligner, sequences1, sequences2, 4, -5, -10, -1);
+}
+
+TEST_F(global_standard_affine_difference_simd_test, exceeding_differences)
+{
+    // The differences exceed the range of 8 bit scores, such that the standard algorithm computes the scores.
+    auto aligner = make_aligner(60, -40, -30, -5);
+
+    std::vector<std::string> sequences1{};
+    std::vector<std::string> sequences2{};
+    for (size_t index = 0; index < 40; ++index) {
+        sequences1.push_back(random_dna(50, 150));
+        sequences2.push_back(random_dna(50, 150));
+    }
+
+    check_scores(aligner, sequences1, sequences2, 60, -40, -30, -5);
+}
+
+TEST_F(global_standard_affine_difference_simd_test, free_end_gaps)
+{
+    // Free end gaps are computed with the standard algorithm.
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::score_model_unitary_simd_difference(
+            pa::cfg::method_global(
+                pa::cfg::gap_model_affine(-10, -1),
+                pa::cfg::leading_end_gap{.first_column = pa::cfg::end_gap::free},
+                pa::cfg::trailing_end_gap{.last_column = pa::cfg::end_gap::free}
+            ),
+            4, -5
+        )
+    );
+
+    std::vector<std::string> sequences1{"ACGTACGTAC"};
+    std::vector<std::string> sequences2{"TTTTACGTACGTACTTTT"};
+
+    // The first sequence is aligned into the infix of the second one.
+    auto results = aligner.compute(sequences2, sequences1);
+
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0].score(), 40);
+}
@@ -0,0 +1,187 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/method_local.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd_adaptive.hpp>
+
+#include "../fixture/random_sequence.hpp"
+#include "../fixture/reference_aligner.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+struct local_affine_adaptive_simd_test : public ::testing::Test
+{
+    static constexpr int32_t match_score = 4;
+    static constexpr int32_t mismatch_score = -5;
+    static constexpr int32_t gap_open_score = -10;
+    static constexpr int32_t gap_extension_score = -1;
+
+    pairwise_aligner::test::random_sequence_generator random_sequence{};
+
+    static int32_t local_score(std::string const & sequence1, std::string const & sequence2)
+    {
+        auto unitary_score = [] (char const symbol1, char const symbol2) {
+            return (symbol1 == symbol2) ? match_score : mismatch_score;
+        };
+        return pairwise_aligner::test::local_score(sequence1, sequence2, unitary_score,
+                                                   {gap_open_score, gap_extension_score});
+    }
+
+    static auto make_aligner()
+    {
+        return pa::cfg::configure_aligner(
+            pa::cfg::score_model_unitary_simd_adaptive(
+                pa::cfg::method_local(
+                    pa::cfg::gap_model_affine(gap_open_score, gap_extension_score)
+                ),
+                match_score, mismatch_score
+            )
+        );
+    }
+};
+
+TEST_F(local_affine_adaptive_simd_test, narrow_scores)
+{
+    auto aligner = make_aligner();
+
+    std::vector<std::string> sequences1{};
+    std::vector<std::string> sequences2{};
+    for (size_t index = 0; index < 40; ++index) {
+        sequences1.push_back(random_sequence(10 + index));
+        sequences2.push_back(random_sequence(50 - index));
+    }
+
+    auto results = aligner.compute(sequences1, sequences2);
+
+    ASSERT_EQ(results.size(), sequences1.size());
+    for (size_t index = 0; index < results.size(); ++index) {
+        EXPECT_EQ(results[index].score(), local_score(sequences1[index], sequences2[index])) << "index: " << index;
+        EXPECT_TRUE(std::ranges::equal(results[index].sequence1(), sequences1[index]));
+    }
+
+    EXPECT_EQ(aligner.pair_counts()[0], sequences1.size());
+    EXPECT_EQ(aligner.pair_counts()[1], 0u);
+    EXPECT_EQ(aligner.pair_counts()[2], 0u);
+}
+
+TEST_F(local_affine_adaptive_simd_test, promotes_saturated_pairs)
+{
+    auto aligner = make_aligner();
+
+    // Every fifth pair shares a long infix, whose score exceeds the range of 8 bit scores, and the last pair
+    // shares one whose score exceeds the range of 16 bit scores.
+    std::vector<std::string> sequences1{};
+    std::vector<std::string> sequences2{};
+    for (size_t index = 0; index < 40; ++index) {
+        if (index % 5 == 0) {
+            std::string const infix = random_sequence(40 + index);
+            sequences1.push_back(random_sequence(20) + infix + random_sequence(5));
+            sequences2.push_back(random_sequence(7) + infix + random_sequence(30));
+        } else {
+            sequences1.push_back(random_sequence(60));
+            sequences2.push_back(random_sequence(60));
+        }
+    }
+
+    std::string const long_sequence = random_sequence(8300);
+    sequences1.push_back(long_sequence);
+    sequences2.push_back(random_sequence(3) + long_sequence);
+
+    std::vector<int32_t> scores(sequences1.size());
+    aligner.compute_scores(sequences1, sequences2, std::span{scores});
+
+    for (size_t index = 0; index < scores.size(); ++index)
+        EXPECT_EQ(scores[index], local_score(sequences1[index], sequences2[index])) << "index: " << index;
+
+    EXPECT_GT(scores.back(), std::numeric_limits<int16_t>::max());
+
+    size_t const int8_saturated_count = std::ranges::count_if(scores, [] (int32_t const score) {
+        return score >= std::numeric_limits<int8_t>::max();
+    });
+
+    EXPECT_EQ(aligner.pair_counts()[0], sequences1.size());
+    EXPECT_EQ(aligner.pair_counts()[1], int8_saturated_count);
+    EXPECT_EQ(aligner.pair_counts()[2], 1u);
+}
+
+TEST_F(local_affine_adaptive_simd_test, wide_scoring_schemes)
+{
+    struct scoring_scheme
+    {
+        int32_t match_score;
+        int32_t mismatch_score;
+        int32_t gap_open_score;
+        int32_t gap_extension_score;
+        size_t first_level;
+    };
+
+    // The scores that do not fit into 8 bit or 16 bit scores skip the respective precision.
+    std::array const scoring_schemes{scoring_scheme{4, -5, -124, -4, 0},
+                                     scoring_scheme{4, -5, -125, -4, 1},
+                                     scoring_scheme{4, -5, -10, -200, 1},
+                                     scoring_scheme{300, -5, -10, -1, 1},
+                                     scoring_scheme{4, -200, -10, -1, 1},
+                                     scoring_scheme{4, -5, -40000, -1, 2},
+                                     scoring_scheme{40000, -5, -10, -1, 2}};
+
+    std::vector<std::string> sequences1{};
+    std::vector<std::string> sequences2{};
+    for (size_t index = 0; index < 20; ++index) {
+        std::string const infix = random_sequence(10 + index);
+        sequences1.push_back(random_sequence(15) + infix + random_sequence(20));
+        sequences2.push_back(random_sequence(30) + infix + random_sequence(5));
+    }
+
+    for (scoring_scheme const & scheme : scoring_schemes) {
+        auto aligner = pa::cfg::configure_aligner(
+            pa::cfg::score_model_unitary_simd_adaptive(
+                pa::cfg::method_local(pa::cfg::gap_model_affine(scheme.gap_open_score, scheme.gap_extension_score)),
+                scheme.match_score, scheme.mismatch_score
+            )
+        );
+
+        auto unitary_score = [&] (char const symbol1, char const symbol2) {
+            return (symbol1 == symbol2) ? scheme.match_score : scheme.mismatch_score;
+        };
+
+        std::vector<int32_t> scores(sequences1.size());
+        aligner.compute_scores(sequences1, sequences2, std::span{scores});
+
+        for (size_t index = 0; index < scores.size(); ++index) {
+            EXPECT_EQ(scores[index],
+                      pairwise_aligner::test::local_score(sequences1[index], sequences2[index], unitary_score,
+                                                          {scheme.gap_open_score, scheme.gap_extension_score}))
+                << "first level: " << scheme.first_level << " index: " << index;
+        }
+
+        EXPECT_EQ(aligner.pair_counts()[scheme.first_level], sequences1.size());
+        for (size_t level = 0; level < scheme.first_level; ++level)
+            EXPECT_EQ(aligner.pair_counts()[level], 0u);
+    }
+}
+
+TEST_F(local_affine_adaptive_simd_test, empty_collection)
+{
+    auto aligner = make_aligner();
+
+    std::vector<std::string> sequences1{};
+    std::vector<std::string> sequences2{};
+
+    EXPECT_TRUE(aligner.compute(sequences1, sequences2).empty());
+    EXPECT_EQ(aligner.pair_counts(), (std::array<size_t, 3>{0, 0, 0}));
+}
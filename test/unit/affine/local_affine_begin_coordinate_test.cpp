@@ -0,0 +1,120 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/method_local.hpp>
+#include <pairwise_aligner/configuration/output_begin_coordinate.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd_saturated.hpp>
+
+#include "../fixture/random_sequence.hpp"
+#include "../fixture/reference_aligner.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+// The sequences between the begin and the end coordinate must align globally with the optimal local score.
+struct local_affine_begin_coordinate_test : public ::testing::Test
+{
+    static constexpr int32_t gap_open_score = -10;
+    static constexpr int32_t gap_extension_score = -1;
+
+    pairwise_aligner::test::random_sequence_generator random_sequence{};
+
+    // Gotoh's algorithm for the global alignment with penalised end gaps.
+    static int32_t global_score(std::string const & sequence1, std::string const & sequence2)
+    {
+        auto unitary_score = [] (char const symbol1, char const symbol2) { return (symbol1 == symbol2) ? 4 : -5; };
+        return pairwise_aligner::test::gotoh(sequence1,
+                                             sequence2,
+                                             unitary_score,
+                                             {gap_open_score, gap_extension_score},
+                                             false).back().back();
+    }
+
+    template <typename result_t>
+    static void check(result_t const & result)
+    {
+        std::string const & sequence1 = result.sequence1();
+        std::string const & sequence2 = result.sequence2();
+        int32_t const score = static_cast<int32_t>(result.score());
+
+        pa::alignment_coordinate const begin = result.begin_coordinate();
+        pa::alignment_coordinate const end = result.end_coordinate();
+        ASSERT_LE(begin.sequence1_position, end.sequence1_position);
+        ASSERT_LE(begin.sequence2_position, end.sequence2_position);
+        ASSERT_LE(end.sequence1_position, sequence1.size());
+        ASSERT_LE(end.sequence2_position, sequence2.size());
+
+        // A local score of 0 is the empty alignment, which begins where it ends.
+        if (score == 0) {
+            EXPECT_EQ(begin, end);
+            return;
+        }
+
+        std::string const infix1 = sequence1.substr(begin.sequence1_position,
+                                                     end.sequence1_position - begin.sequence1_position);
+        std::string const infix2 = sequence2.substr(begin.sequence2_position,
+                                                    end.sequence2_position - begin.sequence2_position);
+        EXPECT_EQ(global_score(infix1, infix2), score)
+            << "begin: (" << begin.sequence1_position << ", " << begin.sequence2_position << "), "
+            << "end: (" << end.sequence1_position << ", " << end.sequence2_position << ")";
+    }
+};
+
+TEST_F(local_affine_begin_coordinate_test, simd_fixed)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::output_begin_coordinate(pa::cfg::score_model_unitary_simd(
+        pa::cfg::method_local(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score)), 4, -5)));
+
+    for (size_t round = 0; round < 4; ++round) {
+        std::vector<std::string> sequences1 = random_sequence.collection(pa::simd_score<int32_t>::size_v, 1, 200);
+        std::vector<std::string> sequences2 = random_sequence.collection(pa::simd_score<int32_t>::size_v, 1, 200);
+        for (auto const & result : aligner.compute(sequences1, sequences2))
+            check(result);
+    }
+}
+
+TEST_F(local_affine_begin_coordinate_test, simd_saturated)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::output_begin_coordinate(
+        pa::cfg::score_model_unitary_simd_saturated(
+            pa::cfg::method_local(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score)), 4, -5)));
+
+    for (size_t round = 0; round < 2; ++round) {
+        std::vector<std::string> sequences1 = random_sequence.collection(pa::simd_score<int8_t>::size_v, 1, 300);
+        std::vector<std::string> sequences2 = random_sequence.collection(pa::simd_score<int8_t>::size_v, 1, 300);
+        for (auto const & result : aligner.compute(sequences1, sequences2))
+            check(result);
+    }
+}
+
+TEST_F(local_affine_begin_coordinate_test, planted_match)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::output_begin_coordinate(pa::cfg::score_model_unitary_simd(
+        pa::cfg::method_local(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score)), 4, -5)));
+
+    std::string const match{"ACGTTGCAACGTAGGCTA"};
+    std::vector<std::string> sequences1{"TTTTTTTTTT" + match + "TTTTT", match, "CCC" + match};
+    std::vector<std::string> sequences2{"GGGG" + match + "GGGGGGGGGG", "GGGG" + match, match + "GGG"};
+
+    std::vector<pa::alignment_coordinate> const expected_begin{{10, 4}, {0, 4}, {3, 0}};
+
+    size_t index = 0;
+    for (auto const & result : aligner.compute(sequences1, sequences2)) {
+        EXPECT_EQ(result.score(), static_cast<int32_t>(match.size()) * 4);
+        EXPECT_EQ(result.begin_coordinate(), expected_begin[index]);
+        EXPECT_EQ(result.end_coordinate().sequence1_position, expected_begin[index].sequence1_position + match.size());
+        EXPECT_EQ(result.end_coordinate().sequence2_position, expected_begin[index].sequence2_position + match.size());
+        ++index;
+    }
+}
@@ -0,0 +1,138 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/method_local.hpp>
+#include <pairwise_aligner/configuration/score_model_matrix_simd_NxN.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd_saturated.hpp>
+#include <pairwise_aligner/configuration/score_threshold.hpp>
+#include <pairwise_aligner/score_model/substitution_matrix.hpp>
+
+#include "../fixture/random_sequence.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+// The pairs reaching the threshold get their optimal score, the others any score below the threshold.
+struct local_affine_score_threshold_test : public ::testing::Test
+{
+    static constexpr int32_t gap_open_score = -10;
+    static constexpr int32_t gap_extension_score = -1;
+
+    pairwise_aligner::test::random_sequence_generator random_sequence{};
+
+    // Every second pair contains a common infix, such that some pairs of a bulk reach the threshold.
+    void generate_pairs(size_t const count,
+                        std::vector<std::string> & sequences1,
+                        std::vector<std::string> & sequences2)
+    {
+        std::uniform_int_distribution<size_t> size_distribution{1, 200};
+        for (size_t index = 0; index < count; ++index) {
+            sequences1.push_back(random_sequence(1, 200));
+            sequences2.push_back(random_sequence(1, 200));
+            if (index % 2 == 0) {
+                std::string const infix = random_sequence(size_distribution(random_sequence.random_engine) / 4);
+                sequences1.back().insert(sequences1.back().size() / 2, infix);
+                sequences2.back().insert(sequences2.back().size() / 3, infix);
+            }
+        }
+    }
+
+    template <typename aligner_t, typename threshold_aligner_t>
+    void check(aligner_t & aligner,
+               threshold_aligner_t & threshold_aligner,
+               int32_t const threshold,
+               size_t const count)
+    {
+        std::vector<std::string> sequences1{};
+        std::vector<std::string> sequences2{};
+        generate_pairs(count, sequences1, sequences2);
+
+        auto const results = aligner.compute(sequences1, sequences2);
+        auto const threshold_results = threshold_aligner.compute(sequences1, sequences2);
+
+        size_t reaching_pair_count = 0;
+        auto threshold_result_it = threshold_results.begin();
+        for (auto const & result : results) {
+            if (static_cast<int32_t>(result.score()) >= threshold) {
+                EXPECT_EQ(threshold_result_it->score(), result.score());
+                EXPECT_EQ(threshold_result_it->end_coordinate(), result.end_coordinate());
+                ++reaching_pair_count;
+            } else {
+                EXPECT_LE(threshold_result_it->score(), result.score());
+            }
+            ++threshold_result_it;
+        }
+        EXPECT_GT(reaching_pair_count, 0u);
+        EXPECT_LT(reaching_pair_count, count);
+    }
+};
+
+TEST_F(local_affine_score_threshold_test, simd_fixed)
+{
+    auto base_config = pa::cfg::method_local(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score));
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary_simd(base_config, 4, -5));
+    auto threshold_aligner = pa::cfg::configure_aligner(pa::cfg::score_threshold(
+        pa::cfg::score_model_unitary_simd(base_config, 4, -5), 60));
+
+    check(aligner, threshold_aligner, 60, pa::simd_score<int32_t>::size_v * 4);
+}
+
+TEST_F(local_affine_score_threshold_test, simd_saturated)
+{
+    auto base_config = pa::cfg::method_local(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score));
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary_simd_saturated(base_config, 4, -5));
+    auto threshold_aligner = pa::cfg::configure_aligner(pa::cfg::score_threshold(
+        pa::cfg::score_model_unitary_simd_saturated(base_config, 4, -5), 60));
+
+    check(aligner, threshold_aligner, 60, pa::simd_score<int8_t>::size_v * 2);
+}
+
+TEST_F(local_affine_score_threshold_test, simd_fixed_matrix)
+{
+    auto base_config = pa::cfg::method_local(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score));
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_matrix_simd_NxN(base_config,
+                                                                                   pa::blosum62_standard<int32_t>));
+    auto threshold_aligner = pa::cfg::configure_aligner(pa::cfg::score_threshold(
+        pa::cfg::score_model_matrix_simd_NxN(base_config, pa::blosum62_standard<int32_t>), 100));
+
+    check(aligner, threshold_aligner, 100, pa::simd_score<int32_t>::size_v * 4);
+}
+
+TEST_F(local_affine_score_threshold_test, skips_remaining_columns)
+{
+    // The common infix is at the end of the second sequence, which is only computed if the threshold can be reached.
+    size_t const count = pa::simd_score<int32_t>::size_v;
+    std::vector<std::string> sequences1{};
+    std::vector<std::string> sequences2{};
+    for (size_t index = 0; index < count; ++index) {
+        sequences1.push_back(random_sequence(100));
+        sequences2.push_back(random_sequence(400) + sequences1.back().substr(40, 20));
+    }
+
+    auto base_config = pa::cfg::method_local(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score));
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary_simd(base_config, 4, -5));
+    auto threshold_aligner = pa::cfg::configure_aligner(pa::cfg::score_threshold(
+        pa::cfg::score_model_unitary_simd(base_config, 4, -5), 200));
+
+    auto const results = aligner.compute(sequences1, sequences2);
+    auto const threshold_results = threshold_aligner.compute(sequences1, sequences2);
+    auto threshold_result_it = threshold_results.begin();
+    for (auto const & result : results) {
+        EXPECT_GE(result.score(), 80);
+        EXPECT_LT(threshold_result_it->score(), 80);
+        EXPECT_LT(threshold_result_it->end_coordinate().sequence2_position, 400u);
+        ++threshold_result_it;
+    }
+}
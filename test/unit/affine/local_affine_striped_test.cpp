@@ -0,0 +1,87 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/method_local.hpp>
+#include <pairwise_aligner/configuration/score_model_matrix_striped.hpp>
+#include <pairwise_aligner/score_model/substitution_matrix.hpp>
+
+#include "../fixture/random_sequence.hpp"
+#include "../fixture/reference_aligner.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+struct local_affine_striped_test : public ::testing::Test
+{
+    pairwise_aligner::test::random_sequence_generator random_protein{.alphabet = "ACDEFGHIKLMNPQRSTVWXY"};
+
+    static int32_t blosum62_score(char const symbol1, char const symbol2)
+    {
+        auto const & matrix = pa::blosum62_standard<>;
+        auto rank = [&] (char const symbol) {
+            return std::ranges::find(matrix, symbol, [] (auto const & row) { return row.first; }) - matrix.begin();
+        };
+        return matrix[rank(symbol1)].second[rank(symbol2)];
+    }
+
+    static int32_t local_score(std::string const & sequence1,
+                               std::string const & sequence2,
+                               int32_t const gap_open_score,
+                               int32_t const gap_extension_score)
+    {
+        return pairwise_aligner::test::local_score(sequence1, sequence2, blosum62_score,
+                                                   {gap_open_score, gap_extension_score});
+    }
+};
+
+TEST_F(local_affine_striped_test, random_pairs)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_matrix_striped(
+        pa::cfg::method_local(pa::cfg::gap_model_affine(-10, -1)), pa::blosum62_standard<>));
+
+    for (size_t index = 0; index < 50; ++index) {
+        std::string sequence1 = random_protein(1, 400);
+        std::string sequence2 = random_protein(1, 400);
+
+        EXPECT_EQ(aligner.compute(sequence1, sequence2).score(), local_score(sequence1, sequence2, -10, -1))
+            << "index: " << index;
+    }
+}
+
+TEST_F(local_affine_striped_test, long_vertical_gaps)
+{
+    // Cheap gaps, such that the vertical gaps run through many segments and lanes in the lazy-F loop.
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_matrix_striped(
+        pa::cfg::method_local(pa::cfg::gap_model_affine(-2, 0)), pa::blosum62_standard<>));
+
+    for (size_t index = 0; index < 20; ++index) {
+        std::string sequence1 = random_protein(100, 300);
+        std::string sequence2 = sequence1.substr(0, 20) + sequence1.substr(sequence1.size() - 20);
+
+        EXPECT_EQ(aligner.compute(sequence1, sequence2).score(), local_score(sequence1, sequence2, -2, 0))
+            << "index: " << index;
+    }
+}
+
+TEST_F(local_affine_striped_test, short_query)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_matrix_striped(
+        pa::cfg::method_local(pa::cfg::gap_model_affine(-10, -1)), pa::blosum62_standard<>));
+
+    std::string const sequence1{"WYC"};
+    std::string const sequence2{"AAAWYCAAA"};
+
+    EXPECT_EQ(aligner.compute(sequence1, sequence2).score(), 11 + 7 + 9);
+    EXPECT_EQ(aligner.compute(sequence2, sequence1).score(), 11 + 7 + 9);
+}
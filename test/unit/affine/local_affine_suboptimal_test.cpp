@@ -0,0 +1,199 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/method_local.hpp>
+#include <pairwise_aligner/configuration/output_suboptimal_alignments.hpp>
+#include <pairwise_aligner/configuration/score_model_matrix.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary.hpp>
+#include <pairwise_aligner/score_model/substitution_matrix.hpp>
+
+#include "../fixture/random_sequence.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+struct local_affine_suboptimal_test : public ::testing::Test
+{
+    static constexpr int32_t gap_open_score = -10;
+    static constexpr int32_t gap_extension_score = -1;
+
+    using alignment_t = pa::suboptimal_alignment<int32_t>;
+    using substitution_fn_t = std::function<int32_t(char, char)>;
+
+    pairwise_aligner::test::random_sequence_generator random_sequence{};
+
+    static int32_t blosum62_score(char const symbol1, char const symbol2)
+    {
+        auto const & matrix = pa::blosum62_standard<>;
+        auto rank = [&] (char const symbol) {
+            return std::ranges::find(matrix, symbol, [] (auto const & row) { return row.first; }) - matrix.begin();
+        };
+        return matrix[rank(symbol1)].second[rank(symbol2)];
+    }
+
+    /*!\brief Enumerates the alignments by recomputing the full matrix after every alignment.
+     *
+     * Selects the best cell of the same regions of 64 diagonals and traces back with the same preference as the
+     * aligner, such that both report the same alignments.
+     */
+    static std::vector<alignment_t> declump(std::string const & sequence1,
+                                            std::string const & sequence2,
+                                            substitution_fn_t const & substitution_score,
+                                            size_t const alignment_count)
+    {
+        int32_t const infinity = std::numeric_limits<int32_t>::lowest() / 2;
+        size_t const rows = sequence1.size() + 1;
+        size_t const columns = sequence2.size() + 1;
+
+        std::vector<std::vector<bool>> is_masked(rows, std::vector<bool>(columns, false));
+        std::vector<alignment_t> alignments{};
+        while (alignments.size() < alignment_count) {
+            std::vector<std::vector<int32_t>> best(rows, std::vector<int32_t>(columns, 0));
+            std::vector<std::vector<int32_t>> horizontal(rows, std::vector<int32_t>(columns, infinity));
+            std::vector<std::vector<int32_t>> vertical = horizontal;
+
+            for (size_t i = 1; i < rows; ++i) {
+                for (size_t j = 1; j < columns; ++j) {
+                    horizontal[i][j] = std::max(best[i][j - 1] + gap_open_score, horizontal[i][j - 1]) +
+                                       gap_extension_score;
+                    vertical[i][j] = std::max(best[i - 1][j] + gap_open_score, vertical[i - 1][j]) +
+                                     gap_extension_score;
+                    best[i][j] = std::max({0, horizontal[i][j], vertical[i][j]});
+                    if (!is_masked[i][j])
+                        best[i][j] = std::max(best[i][j], best[i - 1][j - 1] +
+                                                          substitution_score(sequence1[i - 1], sequence2[j - 1]));
+                }
+            }
+
+            // The first best cell in row-major order of the first region with the best score.
+            std::vector<alignment_t> region_best((rows + columns - 3) / 64 + 1);
+            for (size_t i = 1; i < rows; ++i) {
+                for (size_t j = 1; j < columns; ++j) {
+                    alignment_t & candidate = region_best[(j + rows - 1 - i) / 64];
+                    if (candidate.score < best[i][j])
+                        candidate = alignment_t{.score = best[i][j], .end_coordinate = {i, j}};
+                }
+            }
+
+            alignment_t alignment = *std::ranges::max_element(region_best, std::less<>{}, &alignment_t::score);
+            if (alignment.score <= 0)
+                break;
+
+            size_t i = alignment.end_coordinate.sequence1_position;
+            size_t j = alignment.end_coordinate.sequence2_position;
+            char state = 'B';
+            while (true) {
+                if (state == 'H') {
+                    if (horizontal[i][j] == best[i][j - 1] + gap_open_score + gap_extension_score)
+                        state = 'B';
+                    --j;
+                } else if (state == 'V') {
+                    if (vertical[i][j] == best[i - 1][j] + gap_open_score + gap_extension_score)
+                        state = 'B';
+                    --i;
+                } else if (best[i][j] == 0) {
+                    break;
+                } else if (!is_masked[i][j] &&
+                           best[i][j] == best[i - 1][j - 1] + substitution_score(sequence1[i - 1], sequence2[j - 1])) {
+                    is_masked[i--][j--] = true;
+                } else {
+                    state = (best[i][j] == horizontal[i][j]) ? 'H' : 'V';
+                }
+            }
+
+            alignment.begin_coordinate = pa::alignment_coordinate{i, j};
+            alignments.push_back(alignment);
+        }
+        return alignments;
+    }
+};
+
+TEST_F(local_affine_suboptimal_test, unitary)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::output_suboptimal_alignments(pa::cfg::score_model_unitary(
+        pa::cfg::method_local(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score)), 4, -5), 5));
+
+    auto unitary_score = [] (char const symbol1, char const symbol2) { return (symbol1 == symbol2) ? 4 : -5; };
+    for (size_t index = 0; index < 20; ++index) {
+        std::string sequence1 = random_sequence(1 + index * 13, "ACGT");
+        std::string sequence2 = random_sequence(1 + (index * 29) % 200, "ACGT");
+
+        auto result = aligner.compute(sequence1, sequence2);
+        std::vector<alignment_t> expected = declump(sequence1, sequence2, unitary_score, 5);
+        EXPECT_EQ(result.suboptimal_alignments(), expected) << "index: " << index;
+        EXPECT_EQ(result.score(), expected.empty() ? 0 : expected[0].score) << "index: " << index;
+    }
+}
+
+TEST_F(local_affine_suboptimal_test, repeated_domains)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::output_suboptimal_alignments(pa::cfg::score_model_matrix(
+        pa::cfg::method_local(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score)),
+        pa::blosum62_standard<>), 4));
+
+    std::string_view const alphabet{"ACDEFGHIKLMNPQRSTVWY"};
+    std::string const domain = random_sequence(60, alphabet);
+    std::string const sequence1 = random_sequence(30, alphabet) + domain + random_sequence(80, alphabet) + domain +
+                                  random_sequence(50, alphabet) + domain + random_sequence(20, alphabet);
+    std::string const sequence2 = random_sequence(10, alphabet) + domain + random_sequence(10, alphabet);
+
+    auto result = aligner.compute(sequence1, sequence2);
+    EXPECT_EQ(result.suboptimal_alignments(), declump(sequence1, sequence2, blosum62_score, 4));
+
+    // Every copy of the domain is found once, before any alignment of the random flanks.
+    ASSERT_GE(result.suboptimal_alignments().size(), 3u);
+    std::vector<size_t> domain_begins{};
+    for (size_t index = 0; index < 3; ++index) {
+        alignment_t const & alignment = result.suboptimal_alignments()[index];
+        EXPECT_GE(alignment.score, result.suboptimal_alignments()[0].score / 2);
+        domain_begins.push_back(alignment.begin_coordinate.sequence1_position);
+    }
+    std::ranges::sort(domain_begins);
+    EXPECT_NEAR(domain_begins[0], 30, 3);
+    EXPECT_NEAR(domain_begins[1], 30 + 60 + 80, 3);
+    EXPECT_NEAR(domain_begins[2], 30 + 60 + 80 + 60 + 50, 3);
+
+    for (size_t index = 1; index < result.suboptimal_alignments().size(); ++index)
+        EXPECT_LE(result.suboptimal_alignments()[index].score, result.suboptimal_alignments()[index - 1].score);
+}
+
+TEST_F(local_affine_suboptimal_test, long_pairs)
+{
+    // Covers several regions of diagonals and recomputations crossing their borders.
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::output_suboptimal_alignments(pa::cfg::score_model_matrix(
+        pa::cfg::method_local(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score)),
+        pa::blosum62_standard<>), 10));
+
+    for (size_t index = 0; index < 3; ++index) {
+        std::string sequence1 = random_sequence(300, "ACDEFGHIKLMNPQRSTVWY");
+        std::string sequence2 = random_sequence(250, "ACDEFGHIKLMNPQRSTVWY");
+        EXPECT_EQ(aligner.compute(sequence1, sequence2).suboptimal_alignments(),
+                  declump(sequence1, sequence2, blosum62_score, 10))
+            << "index: " << index;
+    }
+}
+
+TEST_F(local_affine_suboptimal_test, no_positive_score)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::output_suboptimal_alignments(pa::cfg::score_model_unitary(
+        pa::cfg::method_local(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score)), 4, -5), 3));
+
+    auto result = aligner.compute(std::string{"AAAA"}, std::string{"CCC"});
+    EXPECT_EQ(result.score(), 0);
+    EXPECT_TRUE(result.suboptimal_alignments().empty());
+
+    EXPECT_TRUE(aligner.compute(std::string{}, std::string{"CCC"}).suboptimal_alignments().empty());
+}
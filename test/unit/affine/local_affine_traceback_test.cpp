@@ -0,0 +1,156 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/method_local.hpp>
+#include <pairwise_aligner/configuration/output_alignment.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd_saturated.hpp>
+
+#include "../fixture/random_sequence.hpp"
+#include "../fixture/reference_aligner.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+inline constexpr auto local_config = pa::cfg::method_local(pa::cfg::gap_model_affine(-10, -1));
+
+struct local_affine_traceback_test : public ::testing::Test
+{
+    std::vector<std::string> sequence_collection1{};
+    std::vector<std::string> sequence_collection2{};
+
+    pairwise_aligner::test::random_sequence_generator random_sequence{};
+
+    static int32_t substitution_score(char const lhs, char const rhs)
+    {
+        return (lhs == rhs) ? 4 : -5;
+    }
+
+    void generate_sequences(size_t const count, size_t const min_size, size_t const max_size)
+    {
+        std::ranges::generate_n(std::back_inserter(sequence_collection1), count,
+                                [&] () { return random_sequence(min_size, max_size); });
+        std::ranges::generate_n(std::back_inserter(sequence_collection2), count,
+                                [&] () { return random_sequence(min_size, max_size); });
+    }
+
+    // The CIGAR string must replay from the begin to the end coordinate with the optimal local score.
+    template <typename aligner_t>
+    void run_and_compare(aligner_t & aligner)
+    {
+        auto results = aligner.compute(sequence_collection1, sequence_collection2);
+
+        ASSERT_EQ(results.size(), sequence_collection1.size());
+        for (size_t index = 0; index < results.size(); ++index) {
+            auto const & result = results[index];
+            std::string const & sequence1 = sequence_collection1[index];
+            std::string const & sequence2 = sequence_collection2[index];
+            int32_t const expected_score =
+                pairwise_aligner::test::optimal_score(pairwise_aligner::test::gotoh(sequence1,
+                                                                                    sequence2,
+                                                                                    substitution_score,
+                                                                                    {-10, -1},
+                                                                                    true),
+                                                      true);
+            pa::alignment_coordinate const & begin = result.begin_coordinate();
+            pa::alignment_coordinate const & end = result.end_coordinate();
+
+            EXPECT_EQ(static_cast<int32_t>(result.score()), expected_score) << "index: " << index;
+
+            pairwise_aligner::test::cigar_replay const replay =
+                pairwise_aligner::test::replay_cigar(result.cigar(),
+                                                     sequence1,
+                                                     sequence2,
+                                                     begin.sequence1_position,
+                                                     begin.sequence2_position,
+                                                     substitution_score,
+                                                     {-10, -1});
+            EXPECT_EQ(replay.score, expected_score) << "index: " << index;
+            EXPECT_EQ((pa::alignment_coordinate{replay.sequence1_position, replay.sequence2_position}), end)
+                << "index: " << index;
+        }
+    }
+};
+
+TEST_F(local_affine_traceback_test, single_pair)
+{
+    sequence_collection1.push_back("TTACGTAA");
+    sequence_collection2.push_back("GGACGTCC");
+
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::output_alignment(pa::cfg::score_model_unitary_simd(local_config, (int32_t)4, (int32_t)-5)));
+
+    auto results = aligner.compute(sequence_collection1, sequence_collection2);
+
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0].score(), 16);
+    EXPECT_EQ(results[0].cigar(), "4M");
+    EXPECT_EQ(results[0].begin_coordinate(), (pa::alignment_coordinate{2, 2}));
+    EXPECT_EQ(results[0].end_coordinate(), (pa::alignment_coordinate{6, 6}));
+}
+
+TEST_F(local_affine_traceback_test, no_match)
+{
+    sequence_collection1.push_back("AAAA");
+    sequence_collection2.push_back("CCCCCC");
+
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::output_alignment(pa::cfg::score_model_unitary_simd(local_config, (int32_t)4, (int32_t)-5)));
+
+    auto results = aligner.compute(sequence_collection1, sequence_collection2);
+
+    // The empty alignment begins where it ends.
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0].score(), 0);
+    EXPECT_EQ(results[0].cigar(), "");
+    EXPECT_EQ(results[0].begin_coordinate(), results[0].end_coordinate());
+}
+
+TEST_F(local_affine_traceback_test, fixed)
+{
+    generate_sequences(100, 0, 150);
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::output_alignment(pa::cfg::score_model_unitary_simd(local_config, (int32_t)4, (int32_t)-5)));
+    run_and_compare(aligner);
+}
+
+TEST_F(local_affine_traceback_test, saturated)
+{
+    generate_sequences(100, 0, 300);
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::output_alignment(pa::cfg::score_model_unitary_simd_saturated(local_config,
+                                                                              (int32_t)4,
+                                                                              (int32_t)-5)));
+    run_and_compare(aligner);
+}
+
+// Long similar sequences have high scores, which leave the saturated local blocks.
+TEST_F(local_affine_traceback_test, saturated_similar_sequences)
+{
+    for (size_t index = 0; index < 40; ++index) {
+        std::string sequence1 = random_sequence(400, 800);
+        std::string sequence2 = random_sequence(20, 50) + sequence1 + random_sequence(20, 50);
+        for (size_t position = 0; position < sequence2.size(); position += 37)
+            sequence2[position] = (sequence2[position] == 'A') ? 'C' : 'A';
+
+        sequence_collection1.push_back(std::move(sequence1));
+        sequence_collection2.push_back(std::move(sequence2));
+    }
+
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::output_alignment(pa::cfg::score_model_unitary_simd_saturated(local_config,
+                                                                              (int32_t)4,
+                                                                              (int32_t)-5)));
+    run_and_compare(aligner);
+}
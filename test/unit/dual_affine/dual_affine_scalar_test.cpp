@@ -0,0 +1,170 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <random>
+#include <string>
+
+#include <pairwise_aligner/configuration/band_static.hpp>
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/gap_model_dual_affine.hpp>
+#include <pairwise_aligner/configuration/method_global.hpp>
+#include <pairwise_aligner/configuration/method_local.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary.hpp>
+
+#include "../fixture/random_sequence.hpp"
+#include "../fixture/reference_aligner.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+inline constexpr pa::cfg::leading_end_gap free_leading_gap{.first_column = pa::cfg::end_gap::free,
+                                                           .first_row = pa::cfg::end_gap::free};
+inline constexpr pa::cfg::trailing_end_gap free_trailing_gap{.last_column = pa::cfg::end_gap::free,
+                                                             .last_row = pa::cfg::end_gap::free};
+
+struct dual_affine_scalar_test : public ::testing::Test
+{
+    static constexpr int32_t match_score = 4;
+    static constexpr int32_t mismatch_score = -5;
+    static constexpr int32_t gap_open_score = -6;
+    static constexpr int32_t gap_extension_score = -2;
+    static constexpr int32_t long_gap_open_score = -20;
+    static constexpr int32_t long_gap_extension_score = -1;
+
+    pairwise_aligner::test::random_sequence_generator random_sequence{};
+
+    // Drops a random infix of the given size, such that the pair is only aligned well with a long gap.
+    std::string drop_infix(std::string sequence, size_t const infix_size)
+    {
+        std::uniform_int_distribution<size_t> position_distribution{0, sequence.size() - infix_size};
+        return sequence.erase(position_distribution(random_sequence.random_engine), infix_size);
+    }
+
+    // Scores every gap with the better of both affine pieces.
+    static int32_t dual_gotoh(std::string const & sequence1,
+                              std::string const & sequence2,
+                              bool const is_local,
+                              pa::cfg::leading_end_gap const leading_gap = {},
+                              pa::cfg::trailing_end_gap const trailing_gap = {})
+    {
+        auto unitary_score = [] (char const symbol1, char const symbol2) {
+            return (symbol1 == symbol2) ? match_score : mismatch_score;
+        };
+        std::array<pairwise_aligner::test::affine_gap, 2> const gaps{{{gap_open_score, gap_extension_score},
+                                                                      {long_gap_open_score, long_gap_extension_score}}};
+
+        return pairwise_aligner::test::optimal_score(
+            pairwise_aligner::test::gotoh(sequence1, sequence2, unitary_score, gaps, is_local, leading_gap),
+            is_local,
+            trailing_gap);
+    }
+};
+
+TEST_F(dual_affine_scalar_test, global)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(
+        pa::cfg::method_global(pa::cfg::gap_model_dual_affine(gap_open_score,
+                                                              gap_extension_score,
+                                                              long_gap_open_score,
+                                                              long_gap_extension_score),
+                               pa::cfg::leading_end_gap{},
+                               pa::cfg::trailing_end_gap{}),
+        match_score, mismatch_score));
+
+    for (size_t index = 0; index < 50; ++index) {
+        std::string sequence1 = random_sequence(0, 200);
+        std::string sequence2 = (index % 2) ? drop_infix(sequence1, std::min<size_t>(sequence1.size(), 40))
+                                            : random_sequence(0, 200);
+
+        EXPECT_EQ(aligner.compute(sequence1, sequence2).score(), dual_gotoh(sequence1, sequence2, false))
+            << "index: " << index;
+    }
+}
+
+TEST_F(dual_affine_scalar_test, global_free_end_gaps)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(
+        pa::cfg::method_global(pa::cfg::gap_model_dual_affine(gap_open_score,
+                                                              gap_extension_score,
+                                                              long_gap_open_score,
+                                                              long_gap_extension_score),
+                               free_leading_gap,
+                               free_trailing_gap),
+        match_score, mismatch_score));
+
+    for (size_t index = 0; index < 50; ++index) {
+        std::string sequence1 = random_sequence(0, 200);
+        std::string sequence2 = random_sequence(0, 200);
+
+        EXPECT_EQ(aligner.compute(sequence1, sequence2).score(),
+                  dual_gotoh(sequence1, sequence2, false, free_leading_gap, free_trailing_gap)) << "index: " << index;
+    }
+}
+
+TEST_F(dual_affine_scalar_test, local)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(
+        pa::cfg::method_local(pa::cfg::gap_model_dual_affine(gap_open_score,
+                                                             gap_extension_score,
+                                                             long_gap_open_score,
+                                                             long_gap_extension_score)),
+        match_score, mismatch_score));
+
+    for (size_t index = 0; index < 50; ++index) {
+        std::string sequence1 = random_sequence(1, 200);
+        std::string sequence2 = drop_infix(sequence1, std::min<size_t>(sequence1.size() - 1, 40));
+
+        EXPECT_EQ(aligner.compute(sequence1, sequence2).score(), dual_gotoh(sequence1, sequence2, true))
+            << "index: " << index;
+    }
+}
+
+TEST_F(dual_affine_scalar_test, static_band)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::band_static(pa::cfg::score_model_unitary(
+        pa::cfg::method_global(pa::cfg::gap_model_dual_affine(gap_open_score,
+                                                              gap_extension_score,
+                                                              long_gap_open_score,
+                                                              long_gap_extension_score),
+                               pa::cfg::leading_end_gap{},
+                               pa::cfg::trailing_end_gap{}),
+        match_score, mismatch_score), -60, 60));
+
+    for (size_t index = 0; index < 20; ++index) {
+        std::string sequence1 = random_sequence(100, 200);
+        std::string sequence2 = drop_infix(sequence1, 40);
+
+        EXPECT_EQ(aligner.compute(sequence1, sequence2).score(), dual_gotoh(sequence1, sequence2, false))
+            << "index: " << index;
+    }
+}
+
+TEST_F(dual_affine_scalar_test, equal_pieces)
+{
+    // Two equal pieces compute the same scores as a single affine piece.
+    auto dual_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(
+        pa::cfg::method_global(pa::cfg::gap_model_dual_affine(-10, -1, -10, -1),
+                               pa::cfg::leading_end_gap{},
+                               pa::cfg::trailing_end_gap{}),
+        match_score, mismatch_score));
+    auto affine_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(
+        pa::cfg::method_global(pa::cfg::gap_model_affine(-10, -1),
+                               pa::cfg::leading_end_gap{},
+                               pa::cfg::trailing_end_gap{}),
+        match_score, mismatch_score));
+
+    for (size_t index = 0; index < 20; ++index) {
+        std::string sequence1 = random_sequence(0, 200);
+        std::string sequence2 = random_sequence(0, 200);
+
+        EXPECT_EQ(dual_aligner.compute(sequence1, sequence2).score(),
+                  affine_aligner.compute(sequence1, sequence2).score()) << "index: " << index;
+    }
+}
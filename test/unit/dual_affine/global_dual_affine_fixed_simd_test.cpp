@@ -0,0 +1,65 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <pairwise_aligner/configuration/gap_model_dual_affine.hpp>
+#include <pairwise_aligner/configuration/method_global.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd.hpp>
+
+#include "../affine/alignment_simd_test_template.hpp"
+
+namespace global::dual_affine::fixed_simd {
+
+namespace aligner = seqan::pairwise_aligner;
+
+inline constexpr auto base_config =
+    aligner::cfg::method_global(
+        aligner::cfg::gap_model_dual_affine(-6, -2, -20, -1),
+        aligner::cfg::leading_end_gap{}, aligner::cfg::trailing_end_gap{}
+    );
+
+DEFINE_TEST_VALUES(equal_size_32,
+    .base_configurator = base_config,
+    .score_configurator = aligner::cfg::score_model_unitary_simd,
+    .substitution_scores = alignment::test::simd::unitary_model<int32_t>{4, -5},
+    .sequence_generation_param{aligner::simd_score<int32_t>::size_v, 210, 210},
+)
+
+DEFINE_TEST_VALUES(equal_size_16,
+    .base_configurator = base_config,
+    .score_configurator = aligner::cfg::score_model_unitary_simd,
+    .substitution_scores = alignment::test::simd::unitary_model<int16_t>{4, -5},
+    .sequence_generation_param{aligner::simd_score<int16_t>::size_v, 150, 150}
+)
+
+DEFINE_TEST_VALUES(variable_size_32,
+    .base_configurator = base_config,
+    .score_configurator = aligner::cfg::score_model_unitary_simd,
+    .substitution_scores = alignment::test::simd::unitary_model<int32_t>{4, -5},
+    .sequence_generation_param{aligner::simd_score<int32_t>::size_v, 11, 200},
+)
+
+DEFINE_TEST_VALUES(sequence_size_1000_variable_32,
+    .base_configurator = base_config,
+    .score_configurator = aligner::cfg::score_model_unitary_simd,
+    .substitution_scores = alignment::test::simd::unitary_model<int32_t>{4, -5},
+    .sequence_generation_param{aligner::simd_score<int32_t>::size_v, 900, 1100},
+)
+
+using test_types =
+    ::testing::Types<
+        pairwise_aligner::test::fixture<&equal_size_32>,
+        pairwise_aligner::test::fixture<&equal_size_16>,
+        pairwise_aligner::test::fixture<&variable_size_32>,
+        pairwise_aligner::test::fixture<&sequence_size_1000_variable_32>
+    >;
+} // namespace global::dual_affine::fixed_simd
+
+INSTANTIATE_TYPED_TEST_SUITE_P(test,
+                               test_suite,
+                               global::dual_affine::fixed_simd::test_types,);
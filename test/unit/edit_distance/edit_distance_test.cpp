@@ -0,0 +1,245 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/gap_model_linear.hpp>
+#include <pairwise_aligner/configuration/method_global.hpp>
+#include <pairwise_aligner/configuration/score_model_edit_distance.hpp>
+
+#include "../fixture/random_sequence.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+struct edit_distance_test : public ::testing::Test
+{
+    pairwise_aligner::test::random_sequence_generator random_sequence{};
+
+    // Changes about a tenth of the symbols, such that the distances are small compared to the sizes.
+    std::string mutate(std::string sequence)
+    {
+        std::uniform_int_distribution<size_t> operation_distribution{0, 29};
+        std::string mutated{};
+        for (char const symbol : sequence) {
+            switch (operation_distribution(random_sequence.random_engine)) {
+                case 0: mutated.push_back('A'); break; // substitution
+                case 1: break; // deletion
+                case 2: mutated.push_back('C'); mutated.push_back(symbol); break; // insertion
+                default: mutated.push_back(symbol);
+            }
+        }
+        return mutated;
+    }
+
+    // The negated unit cost edit distance computed column by column.
+    static int32_t edit_score(std::string const & sequence1,
+                              std::string const & sequence2,
+                              pa::cfg::leading_end_gap const leading_gap = {},
+                              pa::cfg::trailing_end_gap const trailing_gap = {})
+    {
+        bool const free_first_column = leading_gap.first_column == pa::cfg::end_gap::free;
+        bool const free_first_row = leading_gap.first_row == pa::cfg::end_gap::free;
+        size_t const rows = sequence1.size();
+
+        std::vector<int32_t> column(rows + 1);
+        for (size_t i = 0; i <= rows; ++i)
+            column[i] = free_first_column ? 0 : -static_cast<int32_t>(i);
+
+        int32_t best_last_row = column[rows];
+        for (size_t j = 1; j <= sequence2.size(); ++j) {
+            int32_t diagonal = column[0];
+            column[0] = free_first_row ? 0 : -static_cast<int32_t>(j);
+            for (size_t i = 1; i <= rows; ++i) {
+                int32_t const cell = std::max({diagonal - (sequence1[i - 1] != sequence2[j - 1]),
+                                               column[i] - 1,
+                                               column[i - 1] - 1});
+                diagonal = column[i];
+                column[i] = cell;
+            }
+            best_last_row = std::max(best_last_row, column[rows]);
+        }
+
+        int32_t score = column[rows];
+        if (trailing_gap.last_row == pa::cfg::end_gap::free)
+            score = std::max(score, best_last_row);
+        if (trailing_gap.last_column == pa::cfg::end_gap::free)
+            score = std::max(score, std::ranges::max(column));
+        return score;
+    }
+
+    template <typename aligner_t>
+    void check(aligner_t & aligner,
+               std::vector<std::string> const & sequences1,
+               std::vector<std::string> const & sequences2,
+               pa::cfg::leading_end_gap const leading_gap = {},
+               pa::cfg::trailing_end_gap const trailing_gap = {})
+    {
+        auto results = aligner.compute(sequences1, sequences2);
+        ASSERT_EQ(results.size(), sequences1.size());
+        for (size_t index = 0; index < results.size(); ++index)
+            EXPECT_EQ(results[index].score(), edit_score(sequences1[index], sequences2[index], leading_gap,
+                                                         trailing_gap)) << "index: " << index;
+    }
+};
+
+TEST_F(edit_distance_test, global)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_edit_distance(
+        pa::cfg::method_global(pa::cfg::gap_model_linear(-1), pa::cfg::leading_end_gap{},
+                               pa::cfg::trailing_end_gap{})));
+
+    std::vector<std::string> sequences1{};
+    std::vector<std::string> sequences2{};
+    for (size_t index = 0; index < 50; ++index) {
+        sequences1.push_back(random_sequence(0, 300));
+        sequences2.push_back(random_sequence(0, 300));
+    }
+    check(aligner, sequences1, sequences2);
+}
+
+TEST_F(edit_distance_test, similar_sequences)
+{
+    // The sizes around multiples of the word size test the carries between the blocks.
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_edit_distance(
+        pa::cfg::method_global(pa::cfg::gap_model_linear(-1), pa::cfg::leading_end_gap{},
+                               pa::cfg::trailing_end_gap{})));
+
+    std::vector<std::string> sequences1{};
+    std::vector<std::string> sequences2{};
+    for (size_t const size : {1, 63, 64, 65, 127, 128, 129, 500, 1000}) {
+        sequences1.push_back(random_sequence(size, size));
+        sequences2.push_back(mutate(sequences1.back()));
+    }
+    check(aligner, sequences1, sequences2);
+}
+
+TEST_F(edit_distance_test, affine_gap_model)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_edit_distance(
+        pa::cfg::method_global(pa::cfg::gap_model_affine(0, -1), pa::cfg::leading_end_gap{},
+                               pa::cfg::trailing_end_gap{})));
+
+    std::vector<std::string> sequences1{"ACGTACGT", "", "AAAA", ""};
+    std::vector<std::string> sequences2{"ACGACGTT", "ACG", "", ""};
+
+    auto results = aligner.compute(sequences1, sequences2);
+    EXPECT_EQ(results[0].score(), -2);
+    EXPECT_EQ(results[1].score(), -3);
+    EXPECT_EQ(results[2].score(), -4);
+    EXPECT_EQ(results[3].score(), 0);
+}
+
+TEST_F(edit_distance_test, free_end_gaps)
+{
+    using pa::cfg::end_gap;
+
+    std::vector<std::string> sequences1{};
+    std::vector<std::string> sequences2{};
+    for (size_t index = 0; index < 20; ++index) {
+        sequences1.push_back(random_sequence(0, 200));
+        sequences2.push_back(random_sequence(0, 200));
+    }
+    sequences1.push_back("");
+    sequences2.push_back("ACGT");
+    sequences1.push_back("ACGT");
+    sequences2.push_back("");
+
+    for (end_gap const first_column : {end_gap::penalised, end_gap::free}) {
+        for (end_gap const first_row : {end_gap::penalised, end_gap::free}) {
+            for (end_gap const last_column : {end_gap::penalised, end_gap::free}) {
+                for (end_gap const last_row : {end_gap::penalised, end_gap::free}) {
+                    pa::cfg::leading_end_gap const leading_gap{.first_column = first_column, .first_row = first_row};
+                    pa::cfg::trailing_end_gap const trailing_gap{.last_column = last_column, .last_row = last_row};
+
+                    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_edit_distance(
+                        pa::cfg::method_global(pa::cfg::gap_model_linear(-1), leading_gap, trailing_gap)));
+
+                    check(aligner, sequences1, sequences2, leading_gap, trailing_gap);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(edit_distance_test, end_coordinate)
+{
+    using pa::cfg::end_gap;
+
+    std::vector<std::string> sequences1{"ACGTTTTT", "ACG", "ACGT", ""};
+    std::vector<std::string> sequences2{"ACGT", "ACGTTT", "ACGA", "ACG"};
+
+    auto penalised_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_edit_distance(
+        pa::cfg::method_global(pa::cfg::gap_model_linear(-1), pa::cfg::leading_end_gap{},
+                               pa::cfg::trailing_end_gap{})));
+
+    auto results = penalised_aligner.compute(sequences1, sequences2);
+    for (size_t index = 0; index < results.size(); ++index) {
+        EXPECT_EQ(results[index].end_coordinate().sequence1_position, sequences1[index].size());
+        EXPECT_EQ(results[index].end_coordinate().sequence2_position, sequences2[index].size());
+    }
+
+    pa::cfg::trailing_end_gap const free_trailing_gap{.last_column = end_gap::free, .last_row = end_gap::free};
+    auto free_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_edit_distance(
+        pa::cfg::method_global(pa::cfg::gap_model_linear(-1), pa::cfg::leading_end_gap{}, free_trailing_gap)));
+
+    results = free_aligner.compute(sequences1, sequences2);
+    EXPECT_EQ(results[0].score(), 0);
+    EXPECT_EQ(results[0].end_coordinate().sequence1_position, 4u); // last column
+    EXPECT_EQ(results[0].end_coordinate().sequence2_position, 4u);
+    EXPECT_EQ(results[1].score(), 0);
+    EXPECT_EQ(results[1].end_coordinate().sequence1_position, 3u); // last row
+    EXPECT_EQ(results[1].end_coordinate().sequence2_position, 3u);
+    EXPECT_EQ(results[2].score(), -1);
+    EXPECT_EQ(results[2].end_coordinate().sequence1_position, 4u); // last cell wins the tie
+    EXPECT_EQ(results[2].end_coordinate().sequence2_position, 4u);
+    EXPECT_EQ(results[3].score(), 0);
+    EXPECT_EQ(results[3].end_coordinate().sequence1_position, 0u);
+    EXPECT_EQ(results[3].end_coordinate().sequence2_position, 0u);
+}
+
+TEST_F(edit_distance_test, compute_scores)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_edit_distance(
+        pa::cfg::method_global(pa::cfg::gap_model_linear(-1), pa::cfg::leading_end_gap{},
+                               pa::cfg::trailing_end_gap{})));
+
+    std::vector<std::string> sequences1{};
+    std::vector<std::string> sequences2{};
+    for (size_t index = 0; index < 40; ++index) {
+        sequences1.push_back(random_sequence(0, 150));
+        sequences2.push_back(random_sequence(0, 150));
+    }
+
+    std::vector<int32_t> scores(sequences1.size());
+    aligner.compute_scores(sequences1, sequences2, std::span{scores});
+    for (size_t index = 0; index < scores.size(); ++index)
+        EXPECT_EQ(scores[index], edit_score(sequences1[index], sequences2[index])) << "index: " << index;
+}
+
+TEST_F(edit_distance_test, invalid_gap_model)
+{
+    std::vector<std::string> const sequences{"ACGT"};
+
+    auto linear_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_edit_distance(
+        pa::cfg::method_global(pa::cfg::gap_model_linear(-2), pa::cfg::leading_end_gap{},
+                               pa::cfg::trailing_end_gap{})));
+    EXPECT_THROW(linear_aligner.compute(sequences, sequences), std::invalid_argument);
+
+    auto affine_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_edit_distance(
+        pa::cfg::method_global(pa::cfg::gap_model_affine(-1, -1), pa::cfg::leading_end_gap{},
+                               pa::cfg::trailing_end_gap{})));
+    EXPECT_THROW(affine_aligner.compute(sequences, sequences), std::invalid_argument);
+}
@@ -0,0 +1,63 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace pairwise_aligner::test {
+// ----------------------------------------------------------------------------
+// Random sequences over a given alphabet with a fixed seed
+// ----------------------------------------------------------------------------
+
+inline constexpr std::string_view dna_alphabet{"ACGT"};
+
+struct random_sequence_generator
+{
+    std::string_view alphabet{dna_alphabet};
+    std::mt19937 random_engine{42};
+
+    // A sequence of the given size.
+    std::string operator()(size_t const size, std::string_view const symbols)
+    {
+        std::uniform_int_distribution<size_t> symbol_distribution{0, symbols.size() - 1};
+
+        std::string sequence(size, 'A');
+        std::ranges::generate(sequence, [&] () { return symbols[symbol_distribution(random_engine)]; });
+        return sequence;
+    }
+
+    std::string operator()(size_t const size)
+    {
+        return (*this)(size, alphabet);
+    }
+
+    // A sequence whose size is drawn uniformly from [min_size, max_size].
+    std::string operator()(size_t const min_size, size_t const max_size, std::string_view const symbols)
+    {
+        std::uniform_int_distribution<size_t> size_distribution{min_size, max_size};
+        return (*this)(size_distribution(random_engine), symbols);
+    }
+
+    std::string operator()(size_t const min_size, size_t const max_size)
+    {
+        return (*this)(min_size, max_size, alphabet);
+    }
+
+    std::vector<std::string> collection(size_t const count, size_t const min_size, size_t const max_size)
+    {
+        std::vector<std::string> sequences(count);
+        std::ranges::generate(sequences, [&] () { return (*this)(min_size, max_size); });
+        return sequences;
+    }
+};
+
+} // namespace pairwise_aligner::test
@@ -0,0 +1,249 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <pairwise_aligner/configuration/end_gap_policy.hpp>
+
+namespace pairwise_aligner::test {
+// ----------------------------------------------------------------------------
+// Naive Gotoh recursion with all cells in memory to validate the aligners
+// ----------------------------------------------------------------------------
+
+// A gap of size k scores open + k * extension.
+struct affine_gap
+{
+    int32_t open{};
+    int32_t extension{};
+};
+
+using dp_matrix_t = std::vector<std::vector<int32_t>>;
+
+namespace detail {
+
+// The cells for which is_masked returns true keep minus infinity, such that no alignment passes through them.
+template <typename substitution_fn_t, size_t gap_count, typename mask_fn_t>
+dp_matrix_t masked_gotoh(std::string const & sequence1,
+                         std::string const & sequence2,
+                         substitution_fn_t && substitution_score,
+                         std::array<affine_gap, gap_count> const & gaps,
+                         bool const is_local,
+                         seqan::pairwise_aligner::cfg::leading_end_gap const leading_gap,
+                         mask_fn_t && is_masked)
+{
+    using seqan::pairwise_aligner::cfg::end_gap;
+
+    int32_t const infinity = std::numeric_limits<int32_t>::lowest() / 2;
+    size_t const rows = sequence1.size();
+    size_t const columns = sequence2.size();
+
+    dp_matrix_t best(rows + 1, std::vector<int32_t>(columns + 1, infinity));
+    std::array<dp_matrix_t, gap_count> vertical{};
+    std::array<dp_matrix_t, gap_count> horizontal{};
+    std::ranges::fill(vertical, best);
+    std::ranges::fill(horizontal, best);
+
+    auto gap_score = [&] (size_t const gap_size) {
+        int32_t score = infinity;
+        for (affine_gap const & gap : gaps)
+            score = std::max(score, gap.open + static_cast<int32_t>(gap_size) * gap.extension);
+        return (gap_size == 0) ? 0 : score;
+    };
+
+    bool const free_first_column = is_local || leading_gap.first_column == end_gap::free;
+    bool const free_first_row = is_local || leading_gap.first_row == end_gap::free;
+
+    for (size_t i = 0; i <= rows; ++i)
+        best[i][0] = is_masked(i, 0) ? infinity : (free_first_column ? 0 : gap_score(i));
+    for (size_t j = 0; j <= columns; ++j)
+        best[0][j] = is_masked(0, j) ? infinity : (free_first_row ? 0 : gap_score(j));
+
+    for (size_t i = 1; i <= rows; ++i) {
+        for (size_t j = 1; j <= columns; ++j) {
+            if (is_masked(i, j))
+                continue;
+
+            int32_t diagonal = best[i - 1][j - 1] + substitution_score(sequence1[i - 1], sequence2[j - 1]);
+            best[i][j] = is_local ? std::max(diagonal, 0) : diagonal;
+
+            for (size_t gap = 0; gap < gap_count; ++gap) {
+                vertical[gap][i][j] = std::max(vertical[gap][i - 1][j], best[i - 1][j] + gaps[gap].open) +
+                                      gaps[gap].extension;
+                horizontal[gap][i][j] = std::max(horizontal[gap][i][j - 1], best[i][j - 1] + gaps[gap].open) +
+                                        gaps[gap].extension;
+                best[i][j] = std::max({best[i][j], vertical[gap][i][j], horizontal[gap][i][j]});
+            }
+        }
+    }
+    return best;
+}
+
+} // namespace detail
+
+// The best score of every cell, where every gap is scored with the best of the given affine gaps.
+template <typename substitution_fn_t, size_t gap_count>
+dp_matrix_t gotoh(std::string const & sequence1,
+                  std::string const & sequence2,
+                  substitution_fn_t && substitution_score,
+                  std::array<affine_gap, gap_count> const & gaps,
+                  bool const is_local,
+                  seqan::pairwise_aligner::cfg::leading_end_gap const leading_gap = {})
+{
+    return detail::masked_gotoh(sequence1, sequence2, substitution_score, gaps, is_local, leading_gap,
+                                [] (size_t, size_t) { return false; });
+}
+
+template <typename substitution_fn_t>
+dp_matrix_t gotoh(std::string const & sequence1,
+                  std::string const & sequence2,
+                  substitution_fn_t && substitution_score,
+                  affine_gap const gap,
+                  bool const is_local,
+                  seqan::pairwise_aligner::cfg::leading_end_gap const leading_gap = {})
+{
+    return gotoh(sequence1, sequence2, substitution_score, std::array{gap}, is_local, leading_gap);
+}
+
+// The best score of every cell inside the band of the diagonals j - i from lower_diagonal to upper_diagonal.
+// The cells outside of the band are masked.
+template <typename substitution_fn_t>
+dp_matrix_t banded_gotoh(std::string const & sequence1,
+                         std::string const & sequence2,
+                         substitution_fn_t && substitution_score,
+                         affine_gap const gap,
+                         std::ptrdiff_t const lower_diagonal,
+                         std::ptrdiff_t const upper_diagonal)
+{
+    return detail::masked_gotoh(sequence1, sequence2, substitution_score, std::array{gap}, false, {},
+                                [=] (size_t const i, size_t const j) {
+        std::ptrdiff_t const diagonal = static_cast<std::ptrdiff_t>(j) - static_cast<std::ptrdiff_t>(i);
+        return diagonal < lower_diagonal || upper_diagonal < diagonal;
+    });
+}
+
+// The optimal score, which ends in any cell for local alignments and in the free trailing gaps for global ones.
+inline int32_t optimal_score(dp_matrix_t const & best,
+                             bool const is_local,
+                             seqan::pairwise_aligner::cfg::trailing_end_gap const trailing_gap = {})
+{
+    using seqan::pairwise_aligner::cfg::end_gap;
+
+    if (is_local) {
+        int32_t score = 0;
+        for (std::vector<int32_t> const & row : best)
+            score = std::max(score, std::ranges::max(row));
+        return score;
+    }
+
+    size_t const rows = best.size() - 1;
+    size_t const columns = best[rows].size() - 1;
+    int32_t score = best[rows][columns];
+    if (trailing_gap.last_row == end_gap::free)
+        score = std::max(score, std::ranges::max(best[rows]));
+    if (trailing_gap.last_column == end_gap::free) {
+        for (size_t i = 0; i <= rows; ++i)
+            score = std::max(score, best[i][columns]);
+    }
+    return score;
+}
+
+// The optimal local score, computed in linear memory for sequences too long to keep all cells.
+template <typename substitution_fn_t>
+int32_t local_score(std::string const & sequence1,
+                    std::string const & sequence2,
+                    substitution_fn_t && substitution_score,
+                    affine_gap const gap)
+{
+    int32_t const infinity = std::numeric_limits<int32_t>::lowest() / 2;
+    std::vector<int32_t> best(sequence2.size() + 1, 0);
+    std::vector<int32_t> horizontal(sequence2.size() + 1, infinity);
+
+    int32_t max_score = 0;
+    for (size_t i = 1; i <= sequence1.size(); ++i) {
+        int32_t diagonal = best[0];
+        int32_t vertical = infinity;
+        for (size_t j = 1; j <= sequence2.size(); ++j) {
+            horizontal[j] = std::max(horizontal[j], best[j] + gap.open) + gap.extension;
+            vertical = std::max(vertical, best[j - 1] + gap.open) + gap.extension;
+            int32_t const cell = std::max({0,
+                                           diagonal + substitution_score(sequence1[i - 1], sequence2[j - 1]),
+                                           horizontal[j],
+                                           vertical});
+            diagonal = best[j];
+            best[j] = cell;
+            max_score = std::max(max_score, cell);
+        }
+    }
+    return max_score;
+}
+
+// ----------------------------------------------------------------------------
+// CIGAR replay to validate the alignment output
+// ----------------------------------------------------------------------------
+
+// The score of a replayed CIGAR string and the cell after its last operation.
+struct cigar_replay
+{
+    int32_t score{};
+    size_t sequence1_position{};
+    size_t sequence2_position{};
+};
+
+// Replays the CIGAR string from the given cell, where 'D' consumes the first and 'I' the second sequence only.
+template <typename substitution_fn_t>
+cigar_replay replay_cigar(std::string_view const cigar,
+                          std::string const & sequence1,
+                          std::string const & sequence2,
+                          size_t const sequence1_position,
+                          size_t const sequence2_position,
+                          substitution_fn_t && substitution_score,
+                          affine_gap const gap)
+{
+    cigar_replay replay{.sequence1_position = sequence1_position, .sequence2_position = sequence2_position};
+    size_t count = 0;
+    for (char const operation : cigar) {
+        if (std::isdigit(static_cast<unsigned char>(operation))) {
+            count = count * 10 + (operation - '0');
+            continue;
+        }
+
+        switch (operation) {
+            case 'M': {
+                for (size_t k = 0; k < count; ++k, ++replay.sequence1_position, ++replay.sequence2_position)
+                    replay.score += substitution_score(sequence1.at(replay.sequence1_position),
+                                                       sequence2.at(replay.sequence2_position));
+                break;
+            }
+            case 'D': {
+                replay.score += gap.open + static_cast<int32_t>(count) * gap.extension;
+                replay.sequence1_position += count;
+                break;
+            }
+            case 'I': {
+                replay.score += gap.open + static_cast<int32_t>(count) * gap.extension;
+                replay.sequence2_position += count;
+                break;
+            }
+            default: throw std::invalid_argument{std::string{"Unexpected CIGAR operation: "} + operation};
+        }
+        count = 0;
+    }
+    return replay;
+}
+
+} // namespace pairwise_aligner::test
@@ -0,0 +1,141 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/method_global.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd_saturated.hpp>
+
+#include "../fixture/random_sequence.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+inline constexpr auto base_config =
+    pa::cfg::method_global(
+        pa::cfg::gap_model_affine(-10, -1),
+        pa::cfg::leading_end_gap{}, pa::cfg::trailing_end_gap{}
+    );
+
+struct interface_many_to_many_batch_test : public ::testing::Test
+{
+    std::vector<std::string> sequence_collection1{};
+    std::vector<std::string> sequence_collection2{};
+
+    pairwise_aligner::test::random_sequence_generator random_sequence{};
+
+    void generate_sequences(size_t const count, size_t const min_size = 10, size_t const max_size = 150)
+    {
+        std::ranges::generate_n(std::back_inserter(sequence_collection1), count,
+                                [&] () { return random_sequence(min_size, max_size); });
+        std::ranges::generate_n(std::back_inserter(sequence_collection2), count,
+                                [&] () { return random_sequence(min_size, max_size); });
+    }
+
+    template <typename batch_aligner_t>
+    void run_and_compare(batch_aligner_t & batch_aligner)
+    {
+        auto scalar_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(base_config, 4, -5));
+
+        auto results = batch_aligner.compute(sequence_collection1, sequence_collection2);
+
+        ASSERT_EQ(results.size(), sequence_collection1.size());
+        for (size_t index = 0; index < results.size(); ++index) {
+            EXPECT_EQ(results[index].sequence1(), sequence_collection1[index]) << "index: " << index;
+            EXPECT_EQ(results[index].sequence2(), sequence_collection2[index]) << "index: " << index;
+            EXPECT_EQ(static_cast<int32_t>(results[index].score()),
+                      scalar_aligner.compute(sequence_collection1[index], sequence_collection2[index]).score())
+                << "index: " << index;
+        }
+
+        EXPECT_GE(batch_aligner.statistics().padded_cell_ratio(), 0.0);
+        EXPECT_LT(batch_aligner.statistics().padded_cell_ratio(), 1.0);
+    }
+
+    void run_and_compare()
+    {
+        auto batch_aligner = pa::cfg::configure_aligner(
+                                pa::cfg::score_model_unitary_simd_saturated(base_config, (int32_t)4, (int32_t)-5));
+        run_and_compare(batch_aligner);
+    }
+};
+
+inline constexpr size_t bulk_size = pa::simd_score<int8_t>::size_v;
+
+TEST_F(interface_many_to_many_batch_test, empty)
+{
+    generate_sequences(0);
+    run_and_compare();
+}
+
+TEST_F(interface_many_to_many_batch_test, partial_bulk)
+{
+    generate_sequences(bulk_size / 2 + 1);
+    run_and_compare();
+}
+
+TEST_F(interface_many_to_many_batch_test, full_bulks)
+{
+    generate_sequences(bulk_size * 3);
+    run_and_compare();
+}
+
+TEST_F(interface_many_to_many_batch_test, ragged_tail)
+{
+    generate_sequences(bulk_size * 3 + 7);
+    run_and_compare();
+}
+
+TEST_F(interface_many_to_many_batch_test, length_binned_bulks)
+{
+    // Interleave short and long pairs such that consecutive pairs in the input have different sizes.
+    for (size_t index = 0; index < bulk_size; ++index) {
+        generate_sequences(1, 20, 20);
+        generate_sequences(1, 300, 300);
+    }
+
+    auto batch_aligner = pa::cfg::configure_aligner(
+                            pa::cfg::score_model_unitary_simd_saturated(base_config, (int32_t)4, (int32_t)-5));
+    run_and_compare(batch_aligner);
+
+    // Every bulk only holds pairs of the same size, so no cell is computed for padding.
+    EXPECT_EQ(batch_aligner.statistics().padded_cell_count, 0u);
+    EXPECT_EQ(batch_aligner.statistics().cell_count, bulk_size * (20 * 20 + 300 * 300));
+    EXPECT_EQ(batch_aligner.statistics().padded_cell_ratio(), 0.0);
+}
+
+TEST_F(interface_many_to_many_batch_test, compute_scores)
+{
+    generate_sequences(bulk_size * 3 + 7);
+
+    auto batch_aligner = pa::cfg::configure_aligner(
+                            pa::cfg::score_model_unitary_simd_saturated(base_config, (int32_t)4, (int32_t)-5));
+    auto scalar_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(base_config, 4, -5));
+
+    // The second call reuses the dp vectors of the first one.
+    for (size_t repetition = 0; repetition < 2; ++repetition) {
+        std::vector<int32_t> scores(sequence_collection1.size());
+        std::vector<pa::alignment_coordinate> end_coordinates(sequence_collection1.size());
+        batch_aligner.compute_scores(sequence_collection1,
+                                     sequence_collection2,
+                                     std::span{scores},
+                                     std::span{end_coordinates});
+
+        for (size_t index = 0; index < scores.size(); ++index) {
+            auto scalar_result = scalar_aligner.compute(sequence_collection1[index], sequence_collection2[index]);
+            EXPECT_EQ(scores[index], scalar_result.score()) << "index: " << index;
+            EXPECT_EQ(end_coordinates[index], scalar_result.end_coordinate()) << "index: " << index;
+        }
+    }
+}
@@ -0,0 +1,150 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/execution_lane_refill.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/method_global.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd_saturated.hpp>
+#include <pairwise_aligner/interface/interface_many_to_many_parallel.hpp>
+
+#include "../fixture/random_sequence.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+inline constexpr auto base_config =
+    pa::cfg::method_global(
+        pa::cfg::gap_model_affine(-10, -1),
+        pa::cfg::leading_end_gap{}, pa::cfg::trailing_end_gap{}
+    );
+
+struct interface_many_to_many_parallel_test : public ::testing::Test
+{
+    std::vector<std::string> sequence_collection1{};
+    std::vector<std::string> sequence_collection2{};
+
+    void SetUp() override
+    {
+        pairwise_aligner::test::random_sequence_generator random_sequence{};
+        sequence_collection1 = random_sequence.collection(1000, 10, 150);
+        sequence_collection2 = random_sequence.collection(1000, 10, 150);
+    }
+
+    template <typename parallel_aligner_t>
+    void run_and_compare(parallel_aligner_t & parallel_aligner)
+    {
+        auto scalar_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(base_config, 4, -5));
+
+        auto results = parallel_aligner.compute(sequence_collection1, sequence_collection2);
+
+        ASSERT_EQ(results.size(), sequence_collection1.size());
+        for (size_t index = 0; index < results.size(); ++index) {
+            EXPECT_TRUE(std::ranges::equal(results[index].sequence1(), sequence_collection1[index]));
+            EXPECT_TRUE(std::ranges::equal(results[index].sequence2(), sequence_collection2[index]));
+            EXPECT_EQ(static_cast<int32_t>(results[index].score()),
+                      scalar_aligner.compute(sequence_collection1[index], sequence_collection2[index]).score())
+                << "index: " << index;
+        }
+    }
+};
+
+TEST_F(interface_many_to_many_parallel_test, single_thread)
+{
+    auto parallel_aligner = pa::interface_many_to_many_parallel_factory(
+        pa::cfg::configure_aligner(pa::cfg::score_model_unitary_simd_saturated(base_config, (int32_t)4, (int32_t)-5)),
+        pa::parallel_options{.thread_count = 1, .task_size = 100});
+
+    EXPECT_EQ(parallel_aligner.options().thread_count, 1u);
+    run_and_compare(parallel_aligner);
+}
+
+TEST_F(interface_many_to_many_parallel_test, multiple_threads)
+{
+    auto parallel_aligner = pa::interface_many_to_many_parallel_factory(
+        pa::cfg::configure_aligner(pa::cfg::score_model_unitary_simd_saturated(base_config, (int32_t)4, (int32_t)-5)),
+        pa::parallel_options{.thread_count = 4, .task_size = 64});
+
+    run_and_compare(parallel_aligner);
+}
+
+TEST_F(interface_many_to_many_parallel_test, more_threads_than_tasks)
+{
+    auto parallel_aligner = pa::interface_many_to_many_parallel_factory(
+        pa::cfg::configure_aligner(pa::cfg::score_model_unitary_simd_saturated(base_config, (int32_t)4, (int32_t)-5)),
+        pa::parallel_options{.thread_count = 16, .pin_threads = true, .task_size = 300});
+
+    run_and_compare(parallel_aligner);
+}
+
+// The threads are kept between the calls, also if a later call uses fewer of them.
+TEST_F(interface_many_to_many_parallel_test, repeated_calls)
+{
+    auto parallel_aligner = pa::interface_many_to_many_parallel_factory(
+        pa::cfg::configure_aligner(pa::cfg::score_model_unitary_simd_saturated(base_config, (int32_t)4, (int32_t)-5)),
+        pa::parallel_options{.thread_count = 4, .task_size = 64});
+
+    run_and_compare(parallel_aligner);
+    run_and_compare(parallel_aligner);
+
+    sequence_collection1.resize(100);
+    sequence_collection2.resize(100);
+    run_and_compare(parallel_aligner);
+
+    auto copied_aligner = parallel_aligner;
+    run_and_compare(copied_aligner);
+    run_and_compare(parallel_aligner);
+}
+
+TEST_F(interface_many_to_many_parallel_test, lane_refill)
+{
+    auto parallel_aligner = pa::interface_many_to_many_parallel_factory(
+        pa::cfg::configure_aligner(
+            pa::cfg::execution_lane_refill(pa::cfg::score_model_unitary_simd_saturated(base_config,
+                                                                                       (int32_t)4,
+                                                                                       (int32_t)-5))),
+        pa::parallel_options{.thread_count = 3, .task_size = 128});
+
+    run_and_compare(parallel_aligner);
+}
+
+TEST_F(interface_many_to_many_parallel_test, empty)
+{
+    sequence_collection1.clear();
+    sequence_collection2.clear();
+
+    auto parallel_aligner = pa::interface_many_to_many_parallel_factory(
+        pa::cfg::configure_aligner(pa::cfg::score_model_unitary_simd_saturated(base_config, (int32_t)4, (int32_t)-5)));
+
+    EXPECT_GT(parallel_aligner.options().thread_count, 0u);
+    run_and_compare(parallel_aligner);
+}
+
+struct throwing_aligner
+{
+    template <typename sequence_collection1_t, typename sequence_collection2_t>
+    std::vector<int> compute(sequence_collection1_t &&, sequence_collection2_t &&)
+    {
+        throw std::runtime_error{"error"};
+    }
+};
+
+TEST_F(interface_many_to_many_parallel_test, rethrow_exception)
+{
+    auto parallel_aligner = pa::interface_many_to_many_parallel_factory(throwing_aligner{},
+                                                                        pa::parallel_options{.thread_count = 4});
+
+    EXPECT_THROW(parallel_aligner.compute(sequence_collection1, sequence_collection2), std::runtime_error);
+    EXPECT_THROW(parallel_aligner.compute(sequence_collection1, sequence_collection2), std::runtime_error);
+}
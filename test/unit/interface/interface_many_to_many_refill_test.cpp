@@ -0,0 +1,242 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/execution_lane_refill.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/method_global.hpp>
+#include <pairwise_aligner/configuration/method_local.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd_saturated.hpp>
+
+#include "../fixture/random_sequence.hpp"
+#include "../fixture/reference_aligner.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+inline constexpr auto global_config =
+    pa::cfg::method_global(
+        pa::cfg::gap_model_affine(-10, -1),
+        pa::cfg::leading_end_gap{}, pa::cfg::trailing_end_gap{}
+    );
+
+inline constexpr auto semi_global_config =
+    pa::cfg::method_global(
+        pa::cfg::gap_model_affine(-10, -1),
+        pa::cfg::leading_end_gap{.first_column = pa::cfg::end_gap::free, .first_row = pa::cfg::end_gap::penalised},
+        pa::cfg::trailing_end_gap{.last_column = pa::cfg::end_gap::free, .last_row = pa::cfg::end_gap::penalised}
+    );
+
+inline constexpr auto local_config = pa::cfg::method_local(pa::cfg::gap_model_affine(-10, -1));
+
+struct interface_many_to_many_refill_test : public ::testing::Test
+{
+    std::vector<std::string> sequence_collection1{};
+    std::vector<std::string> sequence_collection2{};
+    pairwise_aligner::test::random_sequence_generator random_sequence{};
+
+    void generate_sequences(size_t const count, size_t const min_size, size_t const max_size)
+    {
+        std::ranges::generate_n(std::back_inserter(sequence_collection1), count,
+                                [&] () { return random_sequence(min_size, max_size); });
+        std::ranges::generate_n(std::back_inserter(sequence_collection2), count,
+                                [&] () { return random_sequence(min_size, max_size); });
+    }
+
+    // Mixes many short pairs with a few long ones, such that a fixed bulk would be dominated by its longest pair.
+    void generate_skewed_sequences(size_t const count)
+    {
+        for (size_t index = 0; index < count; ++index) {
+            if (index % 8 == 0)
+                generate_sequences(1, 200, 400);
+            else
+                generate_sequences(1, 10, 60);
+        }
+    }
+
+    template <typename refill_aligner_t, typename scalar_config_t>
+    void run_and_compare(refill_aligner_t & refill_aligner, scalar_config_t const & scalar_config)
+    {
+        auto scalar_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(scalar_config, 4, -5));
+
+        auto results = refill_aligner.compute(sequence_collection1, sequence_collection2);
+
+        ASSERT_EQ(results.size(), sequence_collection1.size());
+        for (size_t index = 0; index < results.size(); ++index) {
+            EXPECT_TRUE(std::ranges::equal(results[index].sequence1(), sequence_collection1[index]));
+            EXPECT_TRUE(std::ranges::equal(results[index].sequence2(), sequence_collection2[index]));
+            EXPECT_EQ(static_cast<int32_t>(results[index].score()),
+                      scalar_aligner.compute(sequence_collection1[index], sequence_collection2[index]).score())
+                << "index: " << index;
+        }
+    }
+};
+
+TEST_F(interface_many_to_many_refill_test, empty)
+{
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::execution_lane_refill(pa::cfg::score_model_unitary_simd(global_config, (int32_t)4, (int32_t)-5)));
+
+    run_and_compare(aligner, global_config);
+    EXPECT_EQ(aligner.statistics().cell_count, 0u);
+}
+
+TEST_F(interface_many_to_many_refill_test, global)
+{
+    generate_skewed_sequences(100);
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::execution_lane_refill(pa::cfg::score_model_unitary_simd(global_config, (int32_t)4, (int32_t)-5),
+                                       16));
+    run_and_compare(aligner, global_config);
+}
+
+TEST_F(interface_many_to_many_refill_test, global_empty_sequences)
+{
+    generate_sequences(20, 0, 30);
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::execution_lane_refill(pa::cfg::score_model_unitary_simd(global_config, (int32_t)4, (int32_t)-5),
+                                       8));
+    run_and_compare(aligner, global_config);
+}
+
+TEST_F(interface_many_to_many_refill_test, semi_global)
+{
+    generate_skewed_sequences(100);
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::execution_lane_refill(pa::cfg::score_model_unitary_simd(semi_global_config,
+                                                                         (int32_t)4,
+                                                                         (int32_t)-5),
+                                       16));
+    run_and_compare(aligner, semi_global_config);
+}
+
+TEST_F(interface_many_to_many_refill_test, local)
+{
+    generate_skewed_sequences(100);
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::execution_lane_refill(pa::cfg::score_model_unitary_simd(local_config, (int32_t)4, (int32_t)-5),
+                                       16));
+    run_and_compare(aligner, local_config);
+}
+
+TEST_F(interface_many_to_many_refill_test, global_saturated)
+{
+    generate_skewed_sequences(100);
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::execution_lane_refill(pa::cfg::score_model_unitary_simd_saturated(global_config,
+                                                                                   (int32_t)4,
+                                                                                   (int32_t)-5),
+                                       32));
+    run_and_compare(aligner, global_config);
+}
+
+TEST_F(interface_many_to_many_refill_test, less_padding_than_batch)
+{
+    generate_skewed_sequences(200);
+
+    auto batch_aligner = pa::cfg::configure_aligner(
+        pa::cfg::score_model_unitary_simd_saturated(global_config, (int32_t)4, (int32_t)-5));
+    auto refill_aligner = pa::cfg::configure_aligner(
+        pa::cfg::execution_lane_refill(pa::cfg::score_model_unitary_simd_saturated(global_config,
+                                                                                   (int32_t)4,
+                                                                                   (int32_t)-5),
+                                       32));
+
+    batch_aligner.compute(sequence_collection1, sequence_collection2);
+    run_and_compare(refill_aligner, global_config);
+
+    EXPECT_LT(refill_aligner.statistics().padded_cell_ratio(), batch_aligner.statistics().padded_cell_ratio());
+}
+
+TEST_F(interface_many_to_many_refill_test, repeated_compute)
+{
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::execution_lane_refill(pa::cfg::score_model_unitary_simd_saturated(global_config,
+                                                                                   (int32_t)4,
+                                                                                   (int32_t)-5),
+                                       32));
+
+    // The workspace of the aligner is reused by every call, first growing and then shrinking the collections.
+    generate_skewed_sequences(50);
+    run_and_compare(aligner, global_config);
+
+    generate_skewed_sequences(100);
+    run_and_compare(aligner, global_config);
+
+    sequence_collection1.resize(10);
+    sequence_collection2.resize(10);
+    run_and_compare(aligner, global_config);
+}
+
+TEST_F(interface_many_to_many_refill_test, compute_scores)
+{
+    generate_skewed_sequences(100);
+    auto aligner = pa::cfg::configure_aligner(
+        pa::cfg::execution_lane_refill(pa::cfg::score_model_unitary_simd(local_config, (int32_t)4, (int32_t)-5),
+                                       16));
+    auto scalar_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(local_config, 4, -5));
+
+    std::vector<int32_t> scores(sequence_collection1.size() + 1, 7);
+    aligner.compute_scores(sequence_collection1, sequence_collection2, std::span{scores});
+
+    for (size_t index = 0; index < sequence_collection1.size(); ++index) {
+        EXPECT_EQ(scores[index],
+                  scalar_aligner.compute(sequence_collection1[index], sequence_collection2[index]).score())
+            << "index: " << index;
+    }
+    EXPECT_EQ(scores.back(), 7); // elements after the last pair are not touched.
+}
+
+// The end coordinates are taken from the segment of the optimal score and refer to the whole second sequence.
+// Several cells may hold the optimal score, so the reference matrix checks the cell instead of the scalar aligner.
+TEST_F(interface_many_to_many_refill_test, compute_end_coordinates)
+{
+    generate_skewed_sequences(100);
+
+    auto check = [&] (auto & aligner, bool const is_local, pa::cfg::leading_end_gap const leading_gap) {
+        std::vector<int32_t> scores(sequence_collection1.size());
+        std::vector<pa::alignment_coordinate> end_coordinates(sequence_collection1.size());
+        aligner.compute_scores(sequence_collection1, sequence_collection2, std::span{scores}, std::span{end_coordinates});
+
+        for (size_t index = 0; index < sequence_collection1.size(); ++index) {
+            pairwise_aligner::test::dp_matrix_t const best =
+                pairwise_aligner::test::gotoh(sequence_collection1[index],
+                                              sequence_collection2[index],
+                                              [] (char const lhs, char const rhs) { return (lhs == rhs) ? 4 : -5; },
+                                              {-10, -1},
+                                              is_local,
+                                              leading_gap);
+            pa::alignment_coordinate const & end = end_coordinates[index];
+
+            ASSERT_LT(end.sequence1_position, best.size()) << "index: " << index;
+            ASSERT_LT(end.sequence2_position, best[0].size()) << "index: " << index;
+            EXPECT_EQ(best[end.sequence1_position][end.sequence2_position], scores[index]) << "index: " << index;
+            if (!is_local) { // the optimum lies in the last column.
+                EXPECT_EQ(end.sequence2_position, sequence_collection2[index].size()) << "index: " << index;
+            }
+        }
+    };
+
+    auto local_aligner = pa::cfg::configure_aligner(
+        pa::cfg::execution_lane_refill(pa::cfg::score_model_unitary_simd(local_config, (int32_t)4, (int32_t)-5), 16));
+    check(local_aligner, true, pa::cfg::leading_end_gap{});
+
+    auto semi_global_aligner = pa::cfg::configure_aligner(
+        pa::cfg::execution_lane_refill(pa::cfg::score_model_unitary_simd(semi_global_config, (int32_t)4, (int32_t)-5),
+                                       16));
+    check(semi_global_aligner,
+          false,
+          pa::cfg::leading_end_gap{.first_column = pa::cfg::end_gap::free, .first_row = pa::cfg::end_gap::penalised});
+}
@@ -0,0 +1,119 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <pairwise_aligner/configuration/band_static.hpp>
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/gap_model_linear.hpp>
+#include <pairwise_aligner/configuration/method_global.hpp>
+#include <pairwise_aligner/configuration/method_local.hpp>
+#include <pairwise_aligner/configuration/score_model_matrix.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary.hpp>
+#include <pairwise_aligner/score_model/substitution_matrix.hpp>
+
+#include "../fixture/random_sequence.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+inline constexpr pa::cfg::trailing_end_gap free_trailing_gap{.last_column = pa::cfg::end_gap::free,
+                                                             .last_row = pa::cfg::end_gap::free};
+
+// The linear gap model must compute the same scores as the affine gap model without gap open score.
+struct linear_scalar_test : public ::testing::Test
+{
+    pairwise_aligner::test::random_sequence_generator random_sequence{};
+
+    template <typename linear_aligner_t, typename affine_aligner_t>
+    void compare(linear_aligner_t & linear_aligner,
+                 affine_aligner_t & affine_aligner,
+                 std::string_view const alphabet = "ACGT")
+    {
+        for (size_t index = 0; index < 50; ++index) {
+            std::string sequence1 = random_sequence(0, 150, alphabet);
+            std::string sequence2 = random_sequence(0, 150, alphabet);
+
+            EXPECT_EQ(linear_aligner.compute(sequence1, sequence2).score(),
+                      affine_aligner.compute(sequence1, sequence2).score()) << "index: " << index;
+        }
+    }
+};
+
+TEST_F(linear_scalar_test, global)
+{
+    auto linear_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(
+        pa::cfg::method_global(pa::cfg::gap_model_linear(-3), pa::cfg::leading_end_gap{}, pa::cfg::trailing_end_gap{}),
+        4, -5));
+    auto affine_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(
+        pa::cfg::method_global(pa::cfg::gap_model_affine(0, -3), pa::cfg::leading_end_gap{},
+                               pa::cfg::trailing_end_gap{}),
+        4, -5));
+
+    compare(linear_aligner, affine_aligner);
+}
+
+TEST_F(linear_scalar_test, global_edit_distance)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(
+        pa::cfg::method_global(pa::cfg::gap_model_linear(-1), pa::cfg::leading_end_gap{}, pa::cfg::trailing_end_gap{}),
+        0, -1));
+
+    EXPECT_EQ(aligner.compute(std::string{"kitten"}, std::string{"sitting"}).score(), -3);
+    EXPECT_EQ(aligner.compute(std::string{""}, std::string{"sitting"}).score(), -7);
+    EXPECT_EQ(aligner.compute(std::string{"kitten"}, std::string{""}).score(), -6);
+}
+
+TEST_F(linear_scalar_test, overlap)
+{
+    auto linear_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(
+        pa::cfg::method_global(pa::cfg::gap_model_linear(-3), pa::cfg::leading_end_gap{}, free_trailing_gap),
+        4, -5));
+    auto affine_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(
+        pa::cfg::method_global(pa::cfg::gap_model_affine(0, -3), pa::cfg::leading_end_gap{}, free_trailing_gap),
+        4, -5));
+
+    compare(linear_aligner, affine_aligner);
+}
+
+TEST_F(linear_scalar_test, local)
+{
+    auto linear_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(
+        pa::cfg::method_local(pa::cfg::gap_model_linear(-3)), 4, -5));
+    auto affine_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(
+        pa::cfg::method_local(pa::cfg::gap_model_affine(0, -3)), 4, -5));
+
+    compare(linear_aligner, affine_aligner);
+}
+
+TEST_F(linear_scalar_test, substitution_matrix)
+{
+    auto linear_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_matrix(
+        pa::cfg::method_global(pa::cfg::gap_model_linear(-4), pa::cfg::leading_end_gap{}, pa::cfg::trailing_end_gap{}),
+        pa::blosum62_standard<>));
+    auto affine_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_matrix(
+        pa::cfg::method_global(pa::cfg::gap_model_affine(0, -4), pa::cfg::leading_end_gap{},
+                               pa::cfg::trailing_end_gap{}),
+        pa::blosum62_standard<>));
+
+    compare(linear_aligner, affine_aligner, "ACDEFGHIKLMNPQRSTVWXY");
+}
+
+TEST_F(linear_scalar_test, static_band)
+{
+    auto linear_aligner = pa::cfg::configure_aligner(pa::cfg::band_static(pa::cfg::score_model_unitary(
+        pa::cfg::method_global(pa::cfg::gap_model_linear(-3), pa::cfg::leading_end_gap{}, pa::cfg::trailing_end_gap{}),
+        4, -5), -20, 20));
+    auto affine_aligner = pa::cfg::configure_aligner(pa::cfg::band_static(pa::cfg::score_model_unitary(
+        pa::cfg::method_global(pa::cfg::gap_model_affine(0, -3), pa::cfg::leading_end_gap{},
+                               pa::cfg::trailing_end_gap{}),
+        4, -5), -20, 20));
+
+    compare(linear_aligner, affine_aligner);
+}
@@ -0,0 +1,42 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+// The kernel is compiled once for every simd isa, see the CMakeLists.txt of the parent directory.
+
+#include <span>
+
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/method_global.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary.hpp>
+#include <pairwise_aligner/configuration/score_model_unitary_simd.hpp>
+
+#include "simd_kernel_dispatch_kernel.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+extern "C" pa::simd_isa PAIRWISE_ALIGNER_SIMD_KERNEL_NAME(simd_kernel_dispatch)(
+    std::vector<std::string> const & sequences1,
+    std::vector<std::string> const & sequences2,
+    int32_t * scores)
+{
+    auto method = pa::cfg::method_global(pa::cfg::gap_model_affine(-10, -1),
+                                         pa::cfg::leading_end_gap{},
+                                         pa::cfg::trailing_end_gap{});
+
+    // The simd score models require at least SSE4.
+    if constexpr (pa::detail::compiled_simd_isa == pa::simd_isa::none) {
+        auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary(method, 4, -5));
+        for (size_t index = 0; index < sequences1.size(); ++index)
+            scores[index] = aligner.compute(sequences1[index], sequences2[index]).score();
+    } else {
+        auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_unitary_simd(method, 4, -5));
+        aligner.compute_scores(sequences1, sequences2, std::span{scores, sequences1.size()});
+    }
+
+    return pa::detail::compiled_simd_isa;
+}
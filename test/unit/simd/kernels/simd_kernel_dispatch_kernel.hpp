@@ -0,0 +1,34 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <pairwise_aligner/simd/simd_isa.hpp>
+
+namespace pairwise_aligner::test {
+// ----------------------------------------------------------------------------
+// Entry points of the kernel compiled by pairwise_aligner_add_simd_kernels
+// ----------------------------------------------------------------------------
+
+// Writes the global scores of the pairs and returns the simd isa the kernel was compiled for.
+using simd_kernel_dispatch_t = seqan::pairwise_aligner::simd_isa(std::vector<std::string> const & sequences1,
+                                                                 std::vector<std::string> const & sequences2,
+                                                                 int32_t * scores);
+} // namespace pairwise_aligner::test
+
+extern "C"
+{
+pairwise_aligner::test::simd_kernel_dispatch_t simd_kernel_dispatch_none;
+pairwise_aligner::test::simd_kernel_dispatch_t simd_kernel_dispatch_sse4;
+pairwise_aligner::test::simd_kernel_dispatch_t simd_kernel_dispatch_avx2;
+pairwise_aligner::test::simd_kernel_dispatch_t simd_kernel_dispatch_avx512bw;
+pairwise_aligner::test::simd_kernel_dispatch_t simd_kernel_dispatch_avx512vbmi;
+}
@@ -0,0 +1,75 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <stdexcept>
+
+#define PAIRWISE_ALIGNER_SIMD_KERNEL_ISA avx2
+#include <pairwise_aligner/simd/simd_isa.hpp>
+
+namespace pa = seqan::pairwise_aligner;
+
+int kernel_none() { return 0; }
+int kernel_sse4() { return 1; }
+int PAIRWISE_ALIGNER_SIMD_KERNEL_NAME(kernel)() { return 2; }
+int kernel_avx512bw() { return 3; }
+
+using kernel_t = int();
+
+// ----------------------------------------------------------------------------
+// Test Cases
+// ----------------------------------------------------------------------------
+
+TEST(simd_isa_test, host_supports_compiled_isa)
+{
+    EXPECT_GE(pa::host_simd_isa(), pa::detail::compiled_simd_isa);
+}
+
+TEST(simd_isa_test, kernel_name)
+{
+    EXPECT_EQ(kernel_avx2(), 2);
+}
+
+TEST(simd_isa_test, select_best_supported_kernel)
+{
+    std::array<pa::simd_kernel<kernel_t>, 4> kernels{{{pa::simd_isa::avx2, &kernel_avx2},
+                                                      {pa::simd_isa::none, &kernel_none},
+                                                      {pa::simd_isa::avx512bw, &kernel_avx512bw},
+                                                      {pa::simd_isa::sse4, &kernel_sse4}}};
+
+    EXPECT_EQ(pa::select_simd_kernel(kernels, pa::simd_isa::none)(), 0);
+    EXPECT_EQ(pa::select_simd_kernel(kernels, pa::simd_isa::sse4)(), 1);
+    EXPECT_EQ(pa::select_simd_kernel(kernels, pa::simd_isa::avx2)(), 2);
+    EXPECT_EQ(pa::select_simd_kernel(kernels, pa::simd_isa::avx512bw)(), 3);
+    EXPECT_EQ(pa::select_simd_kernel(kernels, pa::simd_isa::avx512vbmi)(), 3);
+}
+
+TEST(simd_isa_test, select_host_kernel)
+{
+    std::array<pa::simd_kernel<kernel_t>, 2> kernels{{{pa::simd_isa::none, &kernel_none},
+                                                      {pa::detail::compiled_simd_isa, &kernel_avx512bw}}};
+
+    EXPECT_EQ(pa::select_simd_kernel(kernels)(), (pa::detail::compiled_simd_isa == pa::simd_isa::none) ? 0 : 3);
+}
+
+TEST(simd_isa_test, skip_missing_kernel)
+{
+    std::array<pa::simd_kernel<kernel_t>, 2> kernels{{{pa::simd_isa::sse4, &kernel_sse4},
+                                                      {pa::simd_isa::avx2, nullptr}}};
+
+    EXPECT_EQ(pa::select_simd_kernel(kernels, pa::simd_isa::avx2)(), 1);
+}
+
+TEST(simd_isa_test, no_supported_kernel)
+{
+    std::array<pa::simd_kernel<kernel_t>, 2> kernels{{{pa::simd_isa::avx2, &kernel_avx2},
+                                                      {pa::simd_isa::avx512bw, &kernel_avx512bw}}};
+
+    EXPECT_THROW(pa::select_simd_kernel(kernels, pa::simd_isa::sse4), std::runtime_error);
+}
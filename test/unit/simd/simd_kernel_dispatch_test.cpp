@@ -0,0 +1,110 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+#include <pairwise_aligner/simd/simd_isa.hpp>
+
+#include "../fixture/random_sequence.hpp"
+#include "kernels/simd_kernel_dispatch_kernel.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+// The kernels of the isas that pairwise_aligner_add_simd_kernels did not compile are left empty.
+#ifdef PAIRWISE_ALIGNER_HAS_SIMD_KERNEL_SSE4
+#   define SIMD_KERNEL_DISPATCH_SSE4 &simd_kernel_dispatch_sse4
+#else
+#   define SIMD_KERNEL_DISPATCH_SSE4 nullptr
+#endif
+
+#ifdef PAIRWISE_ALIGNER_HAS_SIMD_KERNEL_AVX2
+#   define SIMD_KERNEL_DISPATCH_AVX2 &simd_kernel_dispatch_avx2
+#else
+#   define SIMD_KERNEL_DISPATCH_AVX2 nullptr
+#endif
+
+#ifdef PAIRWISE_ALIGNER_HAS_SIMD_KERNEL_AVX512BW
+#   define SIMD_KERNEL_DISPATCH_AVX512BW &simd_kernel_dispatch_avx512bw
+#else
+#   define SIMD_KERNEL_DISPATCH_AVX512BW nullptr
+#endif
+
+#ifdef PAIRWISE_ALIGNER_HAS_SIMD_KERNEL_AVX512VBMI
+#   define SIMD_KERNEL_DISPATCH_AVX512VBMI &simd_kernel_dispatch_avx512vbmi
+#else
+#   define SIMD_KERNEL_DISPATCH_AVX512VBMI nullptr
+#endif
+
+// The kernel of kernels/simd_kernel_dispatch_kernel.cpp, compiled for every isa by pairwise_aligner_add_simd_kernels.
+// The kernel for none is always compiled, since it is the lowest isa of the CMakeLists.txt.
+struct simd_kernel_dispatch_test : public ::testing::Test
+{
+    using kernel_t = pairwise_aligner::test::simd_kernel_dispatch_t;
+
+    static constexpr std::array<pa::simd_kernel<kernel_t>, 5> kernels{
+        {{pa::simd_isa::none, &simd_kernel_dispatch_none},
+         {pa::simd_isa::sse4, SIMD_KERNEL_DISPATCH_SSE4},
+         {pa::simd_isa::avx2, SIMD_KERNEL_DISPATCH_AVX2},
+         {pa::simd_isa::avx512bw, SIMD_KERNEL_DISPATCH_AVX512BW},
+         {pa::simd_isa::avx512vbmi, SIMD_KERNEL_DISPATCH_AVX512VBMI}}
+    };
+
+    pairwise_aligner::test::random_sequence_generator random_sequence{};
+    std::vector<std::string> sequences1{random_sequence.collection(100, 1, 200)};
+    std::vector<std::string> sequences2{random_sequence.collection(100, 1, 200)};
+
+    // The highest compiled isa that does not exceed the given one.
+    static pa::simd_isa expected_isa(pa::simd_isa const supported_isa)
+    {
+        pa::simd_isa isa{pa::simd_isa::none};
+        for (pa::simd_kernel<kernel_t> const & candidate : kernels) {
+            if (candidate.kernel != nullptr && candidate.isa <= supported_isa)
+                isa = std::max(isa, candidate.isa);
+        }
+        return isa;
+    }
+};
+
+TEST_F(simd_kernel_dispatch_test, selects_host_kernel)
+{
+    std::vector<int32_t> scores(sequences1.size());
+    kernel_t * kernel = pa::select_simd_kernel(kernels);
+
+    EXPECT_EQ(kernel(sequences1, sequences2, scores.data()), expected_isa(pa::host_simd_isa()));
+}
+
+TEST_F(simd_kernel_dispatch_test, supported_kernels)
+{
+    // Every kernel runs the code compiled for its own isa and computes the same scores.
+    std::vector<int32_t> expected_scores(sequences1.size());
+    EXPECT_EQ(simd_kernel_dispatch_none(sequences1, sequences2, expected_scores.data()), pa::simd_isa::none);
+
+    for (pa::simd_kernel<kernel_t> const & candidate : kernels) {
+        if (candidate.kernel == nullptr || candidate.isa > pa::host_simd_isa())
+            continue;
+
+        std::vector<int32_t> scores(sequences1.size());
+        EXPECT_EQ(candidate.kernel(sequences1, sequences2, scores.data()), candidate.isa);
+        EXPECT_TRUE(std::ranges::equal(scores, expected_scores)) << "isa: " << static_cast<int>(candidate.isa);
+    }
+}
+
+TEST_F(simd_kernel_dispatch_test, restricted_kernels)
+{
+    std::vector<int32_t> scores(sequences1.size());
+    for (pa::simd_isa const isa : {pa::simd_isa::none, pa::simd_isa::sse4, pa::simd_isa::avx2}) {
+        if (isa > pa::host_simd_isa())
+            continue;
+
+        EXPECT_EQ(pa::select_simd_kernel(kernels, isa)(sequences1, sequences2, scores.data()), expected_isa(isa));
+    }
+}
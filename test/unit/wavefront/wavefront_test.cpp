@@ -0,0 +1,179 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/rrahn/pairwise_aligner/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <pairwise_aligner/configuration/configure_aligner.hpp>
+#include <pairwise_aligner/configuration/gap_model_affine.hpp>
+#include <pairwise_aligner/configuration/gap_model_linear.hpp>
+#include <pairwise_aligner/configuration/method_global.hpp>
+#include <pairwise_aligner/configuration/score_model_wavefront.hpp>
+#include <pairwise_aligner/configuration/score_model_wavefront_simd.hpp>
+
+#include "../fixture/random_sequence.hpp"
+#include "../fixture/reference_aligner.hpp"
+
+namespace pa = seqan::pairwise_aligner;
+
+struct wavefront_test : public ::testing::Test
+{
+    pairwise_aligner::test::random_sequence_generator random_sequence{};
+
+    // Changes about one in `rate` symbols, such that the penalties are small compared to the sizes.
+    std::string mutate(std::string sequence, size_t const rate)
+    {
+        std::uniform_int_distribution<size_t> operation_distribution{0, 3 * rate - 1};
+        std::string mutated{};
+        for (char const symbol : sequence) {
+            switch (operation_distribution(random_sequence.random_engine)) {
+                case 0: mutated.push_back('A'); break; // substitution
+                case 1: break; // deletion
+                case 2: mutated.append("CG"); mutated.push_back(symbol); break; // insertion
+                default: mutated.push_back(symbol);
+            }
+        }
+        return mutated;
+    }
+
+    // Gotoh's algorithm with a gap of size k scoring gap_open_score + k * gap_extension_score.
+    static int32_t global_score(std::string const & sequence1,
+                                std::string const & sequence2,
+                                int32_t const match_score,
+                                int32_t const mismatch_score,
+                                int32_t const gap_open_score,
+                                int32_t const gap_extension_score)
+    {
+        auto unitary_score = [&] (char const symbol1, char const symbol2) {
+            return (symbol1 == symbol2) ? match_score : mismatch_score;
+        };
+        return pairwise_aligner::test::gotoh(sequence1,
+                                             sequence2,
+                                             unitary_score,
+                                             {gap_open_score, gap_extension_score},
+                                             false).back().back();
+    }
+
+    static auto affine_config(int32_t const gap_open_score, int32_t const gap_extension_score)
+    {
+        return pa::cfg::method_global(pa::cfg::gap_model_affine(gap_open_score, gap_extension_score),
+                                      pa::cfg::leading_end_gap{},
+                                      pa::cfg::trailing_end_gap{});
+    }
+};
+
+TEST_F(wavefront_test, high_identity)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_wavefront(affine_config(-10, -1), 4, -5));
+
+    for (size_t index = 0; index < 30; ++index) {
+        std::string sequence1 = random_sequence(1, 1000);
+        std::string sequence2 = mutate(sequence1, 100);
+
+        auto result = aligner.compute(sequence1, sequence2);
+        EXPECT_EQ(result.score(), global_score(sequence1, sequence2, 4, -5, -10, -1)) << "index: " << index;
+        EXPECT_EQ(result.end_coordinate(), (pa::alignment_coordinate{sequence1.size(), sequence2.size()}));
+    }
+}
+
+TEST_F(wavefront_test, random_pairs)
+{
+    // Besides the scores of the unitary tests also odd match scores and scores without a common divisor.
+    std::vector<std::array<int32_t, 4>> const score_settings{{4, -5, -10, -1}, {1, -1, -2, -1}, {3, -2, -5, -2},
+                                                             {0, -1, 0, -1}, {2, 1, -1, 0}};
+
+    for (auto const & [match_score, mismatch_score, gap_open_score, gap_extension_score] : score_settings) {
+        auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_wavefront(
+            affine_config(gap_open_score, gap_extension_score), match_score, mismatch_score));
+
+        for (size_t index = 0; index < 20; ++index) {
+            std::string sequence1 = random_sequence(0, 150);
+            std::string sequence2 = (index % 2 == 0) ? mutate(sequence1, 5) : random_sequence(0, 150);
+
+            EXPECT_EQ(aligner.compute(sequence1, sequence2).score(),
+                      global_score(sequence1, sequence2, match_score, mismatch_score, gap_open_score,
+                                   gap_extension_score))
+                << "match: " << match_score << ", mismatch: " << mismatch_score << ", gap open: " << gap_open_score
+                << ", gap extension: " << gap_extension_score << ", index: " << index;
+        }
+    }
+}
+
+TEST_F(wavefront_test, linear_gap_model)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_wavefront(
+        pa::cfg::method_global(pa::cfg::gap_model_linear(-3), pa::cfg::leading_end_gap{},
+                               pa::cfg::trailing_end_gap{}), 2, -3));
+
+    for (size_t index = 0; index < 20; ++index) {
+        std::string sequence1 = random_sequence(1, 300);
+        std::string sequence2 = mutate(sequence1, 20);
+        EXPECT_EQ(aligner.compute(sequence1, sequence2).score(), global_score(sequence1, sequence2, 2, -3, 0, -3))
+            << "index: " << index;
+    }
+}
+
+TEST_F(wavefront_test, empty_sequences)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_wavefront(affine_config(-10, -1), 4, -5));
+
+    EXPECT_EQ(aligner.compute(std::string{}, std::string{}).score(), 0);
+    EXPECT_EQ(aligner.compute(std::string{"ACG"}, std::string{}).score(), -13);
+    EXPECT_EQ(aligner.compute(std::string{}, std::string{"ACGT"}).score(), -14);
+}
+
+TEST_F(wavefront_test, simd)
+{
+    auto aligner = pa::cfg::configure_aligner(pa::cfg::score_model_wavefront_simd(affine_config(-10, -1), 4, -5));
+
+    // More pairs than lanes with different penalties, such that the lanes finish at different wavefronts.
+    std::vector<std::string> sequences1{};
+    std::vector<std::string> sequences2{};
+    for (size_t index = 0; index < 40; ++index) {
+        sequences1.push_back(random_sequence(0, 800));
+        sequences2.push_back((index % 7 == 3) ? random_sequence(0, 50) : mutate(sequences1.back(), 10 + index));
+    }
+
+    auto results = aligner.compute(sequences1, sequences2);
+    ASSERT_EQ(results.size(), sequences1.size());
+    for (size_t index = 0; index < results.size(); ++index) {
+        EXPECT_EQ(results[index].score(), global_score(sequences1[index], sequences2[index], 4, -5, -10, -1))
+            << "index: " << index;
+        EXPECT_EQ(results[index].end_coordinate(),
+                  (pa::alignment_coordinate{sequences1[index].size(), sequences2[index].size()}));
+    }
+
+    std::vector<int32_t> scores(sequences1.size());
+    aligner.compute_scores(sequences1, sequences2, std::span{scores});
+    for (size_t index = 0; index < scores.size(); ++index)
+        EXPECT_EQ(scores[index], results[index].score()) << "index: " << index;
+}
+
+TEST_F(wavefront_test, invalid_settings)
+{
+    std::string const sequence{"ACGT"};
+
+    // The mismatch score must be below the match score.
+    auto mismatch_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_wavefront(affine_config(-10, -1), 1, 1));
+    EXPECT_THROW(mismatch_aligner.compute(sequence, sequence), std::invalid_argument);
+
+    // The gap extension score must be below half of the match score.
+    auto extension_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_wavefront(affine_config(-10, 2), 4, -5));
+    EXPECT_THROW(extension_aligner.compute(sequence, sequence), std::invalid_argument);
+
+    auto free_end_gap_aligner = pa::cfg::configure_aligner(pa::cfg::score_model_wavefront(
+        pa::cfg::method_global(pa::cfg::gap_model_affine(-10, -1),
+                               pa::cfg::leading_end_gap{.first_column = pa::cfg::end_gap::free},
+                               pa::cfg::trailing_end_gap{}), 4, -5));
+    EXPECT_THROW(free_end_gap_aligner.compute(sequence, sequence), std::invalid_argument);
+}